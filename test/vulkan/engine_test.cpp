@@ -0,0 +1,416 @@
+// Tests for the engine services that work without a GPU (sdf_engine.hpp)
+// Built two ways from the repo root:
+//   make test-engine      against stubs/ and stubs/gpu: the fake shaderc counts
+//                         compiles, so cache hits are checked exactly, and the
+//                         fake driver (vulkan_fake.hpp) runs the async compile
+//                         worker end to end
+//   make test-engine-sdk  against the real Vulkan SDK and libshaderc (only
+//                         SDL3 and ImGui stubbed): bundled shaders go through
+//                         glslang for real
+// Compile: c++ -std=c++20 -O2 -pthread -Istubs -Istubs/gpu -I../../vulkan engine_test.cpp -o engine_test
+// Run: ./engine_test [filter]   (from the repo root; shaders are read from vulkan_kim)
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sdf_engine.hpp"
+
+#ifdef SDFX_STUB_VULKAN
+#include "vulkan_fake.hpp"
+#endif
+
+static int g_checks = 0;
+static int g_failures = 0;
+
+#define CHECK(cond) \
+    do { \
+        g_checks++; \
+        if (!(cond)) { \
+            g_failures++; \
+            std::cerr << "  FAILED " << __FILE__ << ":" << __LINE__ << ": " #cond << std::endl; \
+        } \
+    } while (0)
+
+#define CHECK_EQ(a, b) \
+    do { \
+        g_checks++; \
+        auto va_ = (a); \
+        auto vb_ = (b); \
+        if (!(va_ == vb_)) { \
+            g_failures++; \
+            std::cerr << "  FAILED " << __FILE__ << ":" << __LINE__ << ": " #a " == " #b \
+                      << " (" << va_ << " vs " << vb_ << ")" << std::endl; \
+        } \
+    } while (0)
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static const char* kShaderDir = "vulkan_kim";
+
+// Temporary directory, removed with everything in it
+struct ScratchDir {
+    std::string path;
+
+    explicit ScratchDir(const char* name) {
+        path = (std::filesystem::temp_directory_path() /
+                (std::string(name) + "-" + std::to_string(getpid()))).string();
+        std::filesystem::remove_all(path);
+        std::filesystem::create_directories(path);
+    }
+    ~ScratchDir() { std::filesystem::remove_all(path); }
+};
+
+static void writeFile(const std::string& path, const std::string& text) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << text;
+}
+
+static int countFiles(const std::string& dir, const char* suffix) {
+    int n = 0;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(dir, ec)) {
+        std::string name = entry.path().filename().string();
+        if (name.size() >= strlen(suffix) && name.compare(name.size() - strlen(suffix), strlen(suffix), suffix) == 0) {
+            n++;
+        }
+    }
+    return n;
+}
+
+static void setMtime(const std::string& path, time_t mtime) {
+    struct utimbuf times{mtime, mtime};
+    utime(path.c_str(), &times);
+}
+
+static time_t mtimeOf(const std::string& path) {
+    struct stat st;
+    return stat(path.c_str(), &st) == 0 ? st.st_mtime : 0;
+}
+
+// Fresh engine (never initialized, no device) reading shaders from shaderDir
+// and caching SPIR-V in cacheDir
+static sdfx::Engine* useEngine(const std::string& shaderDir, const std::string& cacheDir) {
+    delete sdfx::get_engine();
+    auto* e = new sdfx::Engine();
+    e->shaderDir = shaderDir;
+    e->spirvCacheDir = cacheDir;
+    sdfx::get_engine() = e;
+    return e;
+}
+
+static int fakeCompiles() {
+#ifdef SDFX_STUB_SHADERC
+    return shaderc::fake::compileCount().load();
+#else
+    return 0;
+#endif
+}
+
+static const char* kToyShader =
+    "#version 450\n"
+    "layout(local_size_x = 1) in;\n"
+    "layout(std430, binding = 0) buffer Out { float v[]; };\n"
+    "#include \"toy_lib.glsl\"\n"
+    "void main() { v[0] = toyValue(); }\n";
+
+// ============================================================================
+// SPIR-V CACHE
+// ============================================================================
+
+// Miss, then hit with identical words; a changed include is a new key; errors
+// and a disabled cache leave no entries
+static void testSpirvCache() {
+    ScratchDir dir("sdfx_spirv_cache");
+    std::string cacheDir = dir.path + "/cache";
+    auto* e = useEngine(dir.path, cacheDir);
+    writeFile(dir.path + "/toy_lib.glsl", "float toyValue() { return 1.0; }\n");
+
+    int compiles = fakeCompiles();
+    auto first = sdfx::compile_glsl_to_spirv(kToyShader, "toy.comp", shaderc_compute_shader);
+    CHECK(first.size() > 5);
+    CHECK(!first.empty() && first[0] == sdfx::SPIRV_MAGIC);
+    CHECK_EQ(e->spirvCacheMisses.load(), 1u);
+    CHECK_EQ(e->spirvCacheHits.load(), 0u);
+    CHECK_EQ(countFiles(cacheDir, ".spv"), 1);
+
+    auto second = sdfx::compile_glsl_to_spirv(kToyShader, "toy.comp", shaderc_compute_shader);
+    CHECK(second == first);
+    CHECK_EQ(e->spirvCacheHits.load(), 1u);
+    CHECK_EQ(e->spirvCacheMisses.load(), 1u);
+#ifdef SDFX_STUB_SHADERC
+    CHECK_EQ(fakeCompiles() - compiles, 1);
+#endif
+    (void)compiles;
+
+    // A hit marks the entry as recently used
+    std::string entry = std::filesystem::directory_iterator(cacheDir)->path().string();
+    setMtime(entry, time(nullptr) - 10 * 24 * 3600);
+    sdfx::compile_glsl_to_spirv(kToyShader, "toy.comp", shaderc_compute_shader);
+    CHECK_EQ(e->spirvCacheHits.load(), 2u);
+    CHECK(time(nullptr) - mtimeOf(entry) < 3600);
+
+    // Editing only the include changes the key
+    writeFile(dir.path + "/toy_lib.glsl", "float toyValue() { return 2.0; }\n");
+    auto edited = sdfx::compile_glsl_to_spirv(kToyShader, "toy.comp", shaderc_compute_shader);
+    CHECK(!edited.empty());
+    CHECK(edited != first);
+    CHECK_EQ(e->spirvCacheMisses.load(), 2u);
+    CHECK_EQ(countFiles(cacheDir, ".spv"), 2);
+
+    // Both versions stay cached
+    writeFile(dir.path + "/toy_lib.glsl", "float toyValue() { return 1.0; }\n");
+    CHECK(sdfx::compile_glsl_to_spirv(kToyShader, "toy.comp", shaderc_compute_shader) == first);
+    CHECK_EQ(e->spirvCacheHits.load(), 3u);
+
+    // Compile errors are reported as an empty module and not cached
+    auto broken = sdfx::compile_glsl_to_spirv(std::string(kToyShader) + "#error broken\n", "toy.comp",
+                                              shaderc_compute_shader);
+    CHECK(broken.empty());
+    CHECK_EQ(countFiles(cacheDir, ".spv"), 2);
+    CHECK_EQ(countFiles(cacheDir, ".tmp"), 0);
+
+    // Disabled: always compiles, never counts or writes
+    sdfx::set_spirv_cache_enabled(false);
+    writeFile(dir.path + "/toy_lib.glsl", "float toyValue() { return 3.0; }\n");
+    CHECK(!sdfx::compile_glsl_to_spirv(kToyShader, "toy.comp", shaderc_compute_shader).empty());
+    CHECK_EQ(e->spirvCacheHits.load() + e->spirvCacheMisses.load(), 5u);
+    CHECK_EQ(countFiles(cacheDir, ".spv"), 2);
+
+    delete sdfx::get_engine();
+    sdfx::get_engine() = nullptr;
+}
+
+// Age limit first, then least recently used beyond the size limit; only .spv
+// files are touched
+static void testSpirvCacheEviction() {
+    ScratchDir dir("sdfx_spirv_evict");
+    time_t now = time(nullptr);
+    std::string kb(1024, 'x');
+    const char* names[] = {"a.spv", "b.spv", "c.spv", "d.spv"};
+    const time_t ages[] = {40 * 24 * 3600, 3600, 2 * 3600, 3 * 3600};
+    for (int i = 0; i < 4; i++) {
+        writeFile(dir.path + "/" + names[i], kb);
+        setMtime(dir.path + "/" + names[i], now - ages[i]);
+    }
+    writeFile(dir.path + "/pipeline.cache", kb);
+    setMtime(dir.path + "/pipeline.cache", now - 90 * 24 * 3600);
+
+    CHECK_EQ(sdfx::prune_spirv_cache(dir.path, 2048, 30 * 24 * 3600), 2);
+    CHECK(!std::filesystem::exists(dir.path + "/a.spv"));   // Too old
+    CHECK(std::filesystem::exists(dir.path + "/b.spv"));
+    CHECK(std::filesystem::exists(dir.path + "/c.spv"));
+    CHECK(!std::filesystem::exists(dir.path + "/d.spv"));   // Least recent over the size limit
+    CHECK(std::filesystem::exists(dir.path + "/pipeline.cache"));
+
+    CHECK_EQ(sdfx::prune_spirv_cache(dir.path, 2048, 30 * 24 * 3600), 0);
+    CHECK_EQ(sdfx::prune_spirv_cache(dir.path + "/missing", 0, 0), 0);
+
+    useEngine(dir.path, dir.path);
+    CHECK_EQ(sdfx::clear_spirv_cache(), 2);
+    CHECK_EQ(countFiles(dir.path, ".spv"), 0);
+    CHECK(std::filesystem::exists(dir.path + "/pipeline.cache"));
+    delete sdfx::get_engine();
+    sdfx::get_engine() = nullptr;
+}
+
+// The bundled scene shaders compile through the engine path and hit the
+// cache the second time round
+static void testSceneShaders() {
+    ScratchDir cache("sdfx_scene_shaders");
+    auto* e = useEngine(kShaderDir, cache.path);
+    const char* scenes[] = {"sdf_scene", "hand_cigarette"};
+    std::vector<std::vector<uint32_t>> modules;
+    for (const char* name : scenes) {
+        modules.push_back(sdfx::compile_compute_shader(e, name));
+        CHECK(modules.back().size() > 5);
+        CHECK(!modules.back().empty() && modules.back()[0] == sdfx::SPIRV_MAGIC);
+    }
+    CHECK_EQ(e->spirvCacheMisses.load(), 2u);
+    for (size_t i = 0; i < modules.size(); i++) {
+        CHECK(sdfx::compile_compute_shader(e, scenes[i]) == modules[i]);
+    }
+    CHECK_EQ(e->spirvCacheHits.load(), 2u);
+    delete sdfx::get_engine();
+    sdfx::get_engine() = nullptr;
+}
+
+// ============================================================================
+// ASYNC SHADER COMPILE (fake driver only)
+// ============================================================================
+
+#ifdef SDFX_STUB_VULKAN
+
+// Wait until the compile worker has nothing queued or running
+static bool waitForCompileWorker(sdfx::Engine* e) {
+    for (int i = 0; i < 10000; i++) {
+        {
+            std::lock_guard<std::mutex> lock(e->shaderCompile.mutex);
+            if (!e->shaderCompile.busy && e->shaderCompile.requested.empty()) return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+static uint32_t compilesOf(sdfx::Engine* e) {
+    return e->spirvCacheHits.load() + e->spirvCacheMisses.load();
+}
+
+// Swap at a frame boundary with deferred destruction, failed builds keeping
+// the old pipeline, newest-request-wins coalescing, cancellation by a
+// synchronous load and shutdown, all without leaking or double-freeing handles
+static void testAsyncShaderCompile() {
+    ScratchDir cache("sdfx_async_compile");
+    auto* e = useEngine(kShaderDir, cache.path);
+    e->initialized = true;
+    e->shaderList = {"sdf_scene", "hand_cigarette"};
+    e->currentShaderName = "sdf_scene";
+    e->computeShaderModule = vkfake::create<VkShaderModule>();
+    e->computePipelineLayout = vkfake::create<VkPipelineLayout>();
+    e->computePipeline = vkfake::create<VkPipeline>();
+    const VkPipeline initial = e->computePipeline;
+    const size_t baseLive = vkfake::liveObjects();
+    const int fences = sdfx::MAX_FRAMES_IN_FLIGHT;
+
+    CHECK_EQ(sdfx::request_shader_compile(""), 0);
+    CHECK_EQ(sdfx::get_shader_compile_status(), 0);
+
+    // Built in the background, swapped in by the frame-boundary half; the old
+    // pipeline lives until the frames that may still use it have completed
+    e->frameIndex = 10;
+    CHECK(sdfx::request_shader_compile("hand_cigarette") > 0);
+    CHECK(waitForCompileWorker(e));
+    CHECK_EQ(sdfx::get_shader_compile_status(), 1);
+    CHECK(e->computePipeline == initial);
+    sdfx::apply_shader_compile_result(e);
+    CHECK(e->computePipeline != initial);
+    CHECK(vkfake::isLive(e->computePipeline));
+    CHECK_EQ(e->currentShaderName, std::string("hand_cigarette"));
+    CHECK_EQ(e->currentShaderIndex, 1);
+    CHECK_EQ(sdfx::get_shader_compile_status(), 0);
+    CHECK_EQ(e->retiredPipelines.size(), size_t(1));
+    e->frameIndex = 10 + fences - 2;
+    sdfx::apply_shader_compile_result(e);
+    CHECK(vkfake::isLive(initial));
+    e->frameIndex = 10 + fences - 1;
+    sdfx::apply_shader_compile_result(e);
+    CHECK(!vkfake::isLive(initial));
+    CHECK(e->retiredPipelines.empty());
+    CHECK_EQ(vkfake::liveObjects(), baseLive);
+
+    // Failed builds report status 2, keep the current pipeline and leave
+    // nothing allocated
+    VkPipeline current = e->computePipeline;
+    vkfake::setFailPipelines(true);
+    CHECK(sdfx::request_shader_compile("sdf_scene") > 0);
+    CHECK(waitForCompileWorker(e));
+    vkfake::setFailPipelines(false);
+    CHECK_EQ(sdfx::get_shader_compile_status(), 2);
+    sdfx::apply_shader_compile_result(e);
+    CHECK(e->computePipeline == current);
+    CHECK_EQ(e->currentShaderName, std::string("hand_cigarette"));
+    CHECK_EQ(vkfake::liveObjects(), baseLive);
+
+    CHECK(sdfx::request_shader_compile("no_such_shader") > 0);
+    CHECK(waitForCompileWorker(e));
+    CHECK_EQ(sdfx::get_shader_compile_status(), 2);
+    CHECK_EQ(vkfake::liveObjects(), baseLive);
+
+    // Requests queued while the worker is busy collapse to the newest one
+    uint32_t compilesBefore = compilesOf(e);
+    int pipelinesBefore = vkfake::driver().pipelinesCreated;
+    vkfake::setHoldPipelines(true);
+    int first = sdfx::request_shader_compile("hand_cigarette");
+    vkfake::waitForHeldPipeline();
+    sdfx::request_shader_compile("no_such_shader");
+    int last = sdfx::request_shader_compile("sdf_scene");
+    CHECK(last > first);
+    CHECK_EQ(sdfx::get_shader_compile_status(), 1);
+    vkfake::setHoldPipelines(false);
+    CHECK(waitForCompileWorker(e));
+    CHECK_EQ(compilesOf(e) - compilesBefore, 2u);
+    CHECK_EQ(vkfake::driver().pipelinesCreated - pipelinesBefore, 2);
+    sdfx::apply_shader_compile_result(e);
+    CHECK_EQ(e->currentShaderName, std::string("sdf_scene"));
+    CHECK_EQ(e->currentShaderIndex, 0);
+    CHECK_EQ(sdfx::get_shader_compile_status(), 0);
+    e->frameIndex += fences;
+    sdfx::apply_shader_compile_result(e);
+    CHECK_EQ(vkfake::liveObjects(), baseLive);
+
+    // A synchronous load cancels a build that has not been swapped in yet
+    current = e->computePipeline;
+    CHECK(sdfx::request_shader_compile("hand_cigarette") > 0);
+    CHECK(waitForCompileWorker(e));
+    e->shaderCompile.cancel();
+    sdfx::apply_shader_compile_result(e);
+    CHECK(e->computePipeline == current);
+    CHECK_EQ(e->currentShaderName, std::string("sdf_scene"));
+    CHECK_EQ(sdfx::get_shader_compile_status(), 0);
+    CHECK_EQ(vkfake::liveObjects(), baseLive);
+
+    // Shutdown joins the worker and frees retired and unswapped builds
+    CHECK(sdfx::request_shader_compile("hand_cigarette") > 0);
+    CHECK(waitForCompileWorker(e));
+    sdfx::apply_shader_compile_result(e);
+    CHECK(sdfx::request_shader_compile("sdf_scene") > 0);
+    CHECK(waitForCompileWorker(e));
+    CHECK_EQ(e->retiredPipelines.size(), size_t(1));
+    sdfx::shutdown_shader_compiler(e);
+    CHECK(!e->shaderCompile.worker.joinable());
+    CHECK(!e->shaderCompile.ready);
+    CHECK(e->retiredPipelines.empty());
+    CHECK_EQ(vkfake::liveObjects(), baseLive);
+
+    vkfake::destroy(e->computePipeline);
+    vkfake::destroy(e->computePipelineLayout);
+    vkfake::destroy(e->computeShaderModule);
+    CHECK_EQ(vkfake::liveObjects(), baseLive - 3);
+    CHECK_EQ(vkfake::driver().badDestroys, 0);
+    delete sdfx::get_engine();
+    sdfx::get_engine() = nullptr;
+}
+
+#endif  // SDFX_STUB_VULKAN
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+struct TestCase {
+    const char* name;
+    void (*run)();
+};
+
+int main(int argc, char** argv) {
+    const TestCase tests[] = {
+        {"spirv_cache", testSpirvCache},
+        {"spirv_cache_eviction", testSpirvCacheEviction},
+        {"scene_shaders", testSceneShaders},
+#ifdef SDFX_STUB_VULKAN
+        {"async_shader_compile", testAsyncShaderCompile},
+#endif
+    };
+
+    const char* filter = argc > 1 ? argv[1] : nullptr;
+    int run = 0;
+    for (const TestCase& t : tests) {
+        if (filter && !std::strstr(t.name, filter)) continue;
+        int failuresBefore = g_failures;
+        std::cout << "[ RUN  ] " << t.name << std::endl;
+        t.run();
+        std::cout << (g_failures == failuresBefore ? "[  OK  ] " : "[ FAIL ] ") << t.name << std::endl;
+        run++;
+    }
+    std::cout << run << " tests, " << g_checks << " checks, " << g_failures << " failures" << std::endl;
+    return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,1305 @@
+// Regression tests for the headless mesh pipeline (marching_cubes.hpp, sdf_cpu.hpp, sdf_cpu_scenes.hpp)
+// No Vulkan device needed: scenes are sampled with the CPU SDF evaluator.
+// Compile: c++ -std=c++17 -O2 -pthread -I../../vulkan mesh_test.cpp -o mesh_test
+// Run: ./mesh_test [filter]   (or `make test-mesh` from the repo root)
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "sdf_cpu_scenes.hpp"
+
+static int g_checks = 0;
+static int g_failures = 0;
+
+#define CHECK(cond) \
+    do { \
+        g_checks++; \
+        if (!(cond)) { \
+            g_failures++; \
+            std::cerr << "  FAILED " << __FILE__ << ":" << __LINE__ << ": " #cond << std::endl; \
+        } \
+    } while (0)
+
+#define CHECK_EQ(a, b) \
+    do { \
+        g_checks++; \
+        auto va_ = (a); \
+        auto vb_ = (b); \
+        if (!(va_ == vb_)) { \
+            g_failures++; \
+            std::cerr << "  FAILED " << __FILE__ << ":" << __LINE__ << ": " #a " == " #b \
+                      << " (" << va_ << " vs " << vb_ << ")" << std::endl; \
+        } \
+    } while (0)
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static const mc::Vec3 kMin{-2, -2, -2};
+static const mc::Vec3 kMax{2, 2, 2};
+
+// Sphere blended with a box, plus a separate torus: curved, flat and
+// genus-one pieces in one grid
+static sdfcpu::Tape testScene() {
+    using namespace sdfcpu;
+    Expr blob = smoothUnion(sphere(1.0f), translate(box(0.5f, 0.5f, 0.5f), 1.0f, 0, 0), 0.1f);
+    return compile(min(blob, torus(0.8f, 0.2f, 0, -1.2f, 0)));
+}
+
+using Position = std::tuple<float, float, float>;
+using TriangleKey = std::array<Position, 3>;
+
+static Position key(const mc::Vec3& v) { return {v.x, v.y, v.z}; }
+
+// Triangles as sorted position triples, each rotated so its smallest corner
+// comes first (winding kept), so meshes can be compared independent of
+// vertex numbering and triangle order
+static std::vector<TriangleKey> triangleKeys(const mc::Mesh& mesh) {
+    std::vector<TriangleKey> keys;
+    auto corner = [&](size_t i) {
+        return key(mesh.indices.empty() ? mesh.vertices[i] : mesh.vertices[mesh.indices[i]]);
+    };
+    size_t count = mesh.indices.empty() ? mesh.vertices.size() : mesh.indices.size();
+    for (size_t i = 0; i + 2 < count; i += 3) {
+        TriangleKey t = {corner(i), corner(i + 1), corner(i + 2)};
+        std::rotate(t.begin(), std::min_element(t.begin(), t.end()), t.end());
+        keys.push_back(t);
+    }
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+static size_t triangleCount(const mc::Mesh& mesh) {
+    return mesh.indices.empty() ? mesh.vertices.size() / 3 : mesh.indices.size() / 3;
+}
+
+// Positive when the triangles use MC winding around the enclosed volume
+// (clockwise seen from outside, see mc::computeNormals)
+static double signedVolume(const mc::Mesh& mesh) {
+    double volume = 0.0;
+    auto corner = [&](size_t i) { return mesh.indices.empty() ? mesh.vertices[i] : mesh.vertices[mesh.indices[i]]; };
+    size_t count = mesh.indices.empty() ? mesh.vertices.size() : mesh.indices.size();
+    for (size_t i = 0; i + 2 < count; i += 3) {
+        mc::Vec3 a = corner(i), b = corner(i + 1), c = corner(i + 2);
+        volume += a.dot(c.cross(b)) / 6.0;
+    }
+    return volume;
+}
+
+// Fraction of vertex normals within 60 degrees of the SDF gradient
+static double normalsAlongGradient(const sdfcpu::Tape& tape, const mc::Mesh& mesh) {
+    const float h = 1e-3f;
+    std::vector<mc::Vec3> probes;
+    for (const mc::Vec3& v : mesh.vertices) {
+        for (int a = 0; a < 3; a++) {
+            mc::Vec3 d(a == 0 ? h : 0, a == 1 ? h : 0, a == 2 ? h : 0);
+            probes.push_back(v + d);
+            probes.push_back(v - d);
+        }
+    }
+    std::vector<float> d = sdfcpu::evaluate(tape, probes);
+    size_t along = 0;
+    for (size_t i = 0; i < mesh.vertices.size(); i++) {
+        const float* p = &d[6 * i];
+        mc::Vec3 gradient = mc::Vec3(p[0] - p[1], p[2] - p[3], p[4] - p[5]).normalized();
+        along += mesh.normals[i].dot(gradient) > 0.5f;
+    }
+    return mesh.vertices.empty() ? 0.0 : double(along) / mesh.vertices.size();
+}
+
+static bool closedManifold(const mc::Mesh& mesh) {
+    mc::ManifoldReport report = mc::checkManifold(mesh);
+    return report.watertight();
+}
+
+static std::string readFile(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+static std::string tempPath(const char* name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+// The iostream OBJ writer exportOBJ replaced, kept verbatim as the reference
+// for its output
+static bool baselineExportOBJ(const std::string& filename, const mc::Mesh& mesh,
+                              bool includeColors = false, bool includeUVs = false) {
+    if (mesh.vertices.empty()) return false;
+
+    std::ofstream file(filename);
+    if (!file.is_open()) return false;
+
+    // Use C locale to avoid thousands separators in numbers
+    file.imbue(std::locale::classic());
+
+    file << "# Generated by Marching Cubes (Parallel)\n";
+    file << "# Vertices: " << mesh.vertices.size() << "\n";
+    file << "# Triangles: " << mesh.indices.size() / 3 << "\n";
+    if (includeColors && mesh.hasColors()) file << "# With vertex colors\n";
+    if (includeUVs && mesh.hasUVs()) file << "# With UV coordinates\n";
+    file << "\n";
+
+    // Write vertices (optionally with colors)
+    bool writeColors = includeColors && mesh.hasColors();
+    for (size_t i = 0; i < mesh.vertices.size(); i++) {
+        const mc::Vec3& v = mesh.vertices[i];
+        if (writeColors) {
+            const mc::Color3& c = mesh.colors[i];
+            file << "v " << v.x << " " << v.y << " " << v.z
+                 << " " << c.r << " " << c.g << " " << c.b << "\n";
+        } else {
+            file << "v " << v.x << " " << v.y << " " << v.z << "\n";
+        }
+    }
+
+    // Write texture coordinates
+    if (includeUVs && mesh.hasUVs()) {
+        file << "\n";
+        for (const auto& uv : mesh.uvs) {
+            file << "vt " << uv.u << " " << uv.v << "\n";
+        }
+    }
+
+    // Write normals
+    if (mesh.hasNormals()) {
+        file << "\n";
+        for (const auto& n : mesh.normals) {
+            file << "vn " << n.x << " " << n.y << " " << n.z << "\n";
+        }
+    }
+
+    // Write faces (winding order flipped for correct OBJ convention: CCW = front face)
+    file << "\n";
+    bool hasUV = includeUVs && mesh.hasUVs();
+    bool hasN = mesh.hasNormals();
+
+    for (size_t i = 0; i < mesh.indices.size(); i += 3) {
+        // Flip winding: i0, i2, i1 instead of i0, i1, i2
+        uint32_t i0 = mesh.indices[i] + 1;
+        uint32_t i1 = mesh.indices[i+2] + 1;  // Swapped
+        uint32_t i2 = mesh.indices[i+1] + 1;  // Swapped
+
+        if (hasUV && hasN) {
+            file << "f " << i0 << "/" << i0 << "/" << i0 << " "
+                        << i1 << "/" << i1 << "/" << i1 << " "
+                        << i2 << "/" << i2 << "/" << i2 << "\n";
+        } else if (hasN) {
+            file << "f " << i0 << "//" << i0 << " "
+                        << i1 << "//" << i1 << " "
+                        << i2 << "//" << i2 << "\n";
+        } else if (hasUV) {
+            file << "f " << i0 << "/" << i0 << " "
+                        << i1 << "/" << i1 << " "
+                        << i2 << "/" << i2 << "\n";
+        } else {
+            file << "f " << i0 << " " << i1 << " " << i2 << "\n";
+        }
+    }
+
+    file.close();
+    return true;
+}
+
+// GLB container around hand-written JSON and BIN chunks, for loader fixtures
+static void writeGLBFile(const std::string& path, std::string json, std::vector<uint8_t> bin) {
+    json.resize((json.size() + 3) & ~size_t(3), ' ');
+    bin.resize((bin.size() + 3) & ~size_t(3), 0);
+    uint32_t header[5] = {0x46546C67, 2, (uint32_t)(12 + 8 + json.size() + 8 + bin.size()),
+                          (uint32_t)json.size(), 0x4E4F534A};
+    uint32_t binHeader[2] = {(uint32_t)bin.size(), 0x004E4942};
+    std::ofstream out(path, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(header), sizeof(header));
+    out.write(json.data(), (std::streamsize)json.size());
+    out.write(reinterpret_cast<const char*>(binHeader), sizeof(binHeader));
+    out.write(reinterpret_cast<const char*>(bin.data()), (std::streamsize)bin.size());
+}
+
+// Append raw elements to a BIN chunk at 4-byte alignment, returns their offset
+template<typename T>
+static size_t appendBin(std::vector<uint8_t>& bin, const std::vector<T>& items) {
+    bin.resize((bin.size() + 3) & ~size_t(3), 0);
+    size_t offset = bin.size();
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(items.data());
+    bin.insert(bin.end(), p, p + items.size() * sizeof(T));
+    return offset;
+}
+
+static bool samePoints(const std::vector<mc::Vec3>& a, const std::vector<mc::Vec3>& b) {
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](const mc::Vec3& u, const mc::Vec3& v) {
+        return key(u) == key(v);
+    });
+}
+
+static bool near(const mc::Vec3& a, const mc::Vec3& b, float eps = 1e-5f) {
+    return std::fabs(a.x - b.x) <= eps && std::fabs(a.y - b.y) <= eps && std::fabs(a.z - b.z) <= eps;
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+// Welded, unwelded and slab-streaming marching cubes polygonise the same
+// grid into the same triangles, with bit-identical vertex positions
+static void testMarchingCubesPaths() {
+    sdfcpu::Tape tape = testScene();
+    for (int res : {48, 97}) {
+        std::vector<float> grid = sdfcpu::sampleGrid(tape, res, kMin, kMax);
+        mc::Mesh unwelded = mc::generateMesh(grid, res, kMin, kMax);
+        mc::Mesh welded = mc::generateMesh(grid, res, kMin, kMax, 0.0f, true);
+        mc::Mesh streamed = mc::generateMeshStreaming([&](int z, float* dst) {
+            std::memcpy(dst, &grid[(size_t)z * res * res], sizeof(float) * res * res);
+            return true;
+        }, res, kMin, kMax);
+
+        CHECK(triangleCount(welded) > 0);
+        CHECK_EQ(triangleCount(unwelded), triangleCount(welded));
+        CHECK(triangleKeys(unwelded) == triangleKeys(welded));
+        CHECK(triangleKeys(streamed) == triangleKeys(welded));
+        CHECK_EQ(streamed.vertices.size(), welded.vertices.size());
+        CHECK(welded.vertices.size() * 3 < unwelded.vertices.size());
+        CHECK(closedManifold(welded));
+        CHECK(closedManifold(streamed));
+    }
+}
+
+// Repairing the unwelded MC soup welds it down to the indexed mesh, and
+// triangles repeated after welding are dropped (same winding) or only
+// counted (opposite winding). At 97 some samples sit exactly on the
+// surface, where the indexed mesh keeps distinct coincident vertices (one
+// per edge of that corner) that a positional weld merges, so there the
+// indexed mesh is repaired too.
+static void testRepairMesh() {
+    sdfcpu::Tape tape = testScene();
+    for (int res : {48, 64, 97}) {
+        std::vector<float> grid = sdfcpu::sampleGrid(tape, res, kMin, kMax);
+        mc::Mesh welded = mc::generateMesh(grid, res, kMin, kMax, 0.0f, true);
+        mc::Mesh repaired = mc::generateMesh(grid, res, kMin, kMax);
+        mc::MeshRepairReport report = mc::repairMesh(repaired);
+        if (res == 97) mc::repairMesh(welded);
+        CHECK(report.manifold.watertight());
+        CHECK_EQ(report.duplicateTriangles, (size_t)0);
+        CHECK_EQ(repaired.vertices.size(), welded.vertices.size());
+        CHECK(triangleKeys(repaired) == triangleKeys(welded));
+    }
+
+    // Stack copies of the first triangles, once more as a separate
+    // unindexed patch so welding has to merge it first
+    std::vector<float> grid = sdfcpu::sampleGrid(tape, 48, kMin, kMax);
+    mc::Mesh welded = mc::generateMesh(grid, 48, kMin, kMax, 0.0f, true);
+    const size_t copies = 10;
+    mc::Mesh stacked = welded;
+    for (size_t t = 0; t < copies; t++) {
+        for (int k = 0; k < 3; k++) stacked.indices.push_back(welded.indices[3 * t + k]);
+    }
+    for (size_t t = 0; t < copies; t++) {
+        for (int k = 0; k < 3; k++) {
+            stacked.indices.push_back((uint32_t)stacked.vertices.size());
+            stacked.vertices.push_back(welded.vertices[welded.indices[3 * t + (k + 1) % 3]]);
+        }
+    }
+    const uint32_t* first = &welded.indices[0];
+    stacked.indices.insert(stacked.indices.end(), {first[0], first[2], first[1]});
+    mc::MeshRepairReport report = mc::repairMesh(stacked);
+    CHECK_EQ(report.duplicateTriangles, 2 * copies);
+    CHECK_EQ(report.opposedTriangles, (size_t)1);
+    CHECK_EQ(triangleCount(stacked), triangleCount(welded) + 1);
+    CHECK_EQ(stacked.vertices.size(), welded.vertices.size());
+    CHECK(!report.manifold.manifold());
+    stacked.indices.resize(stacked.indices.size() - 3);
+    CHECK(triangleKeys(stacked) == triangleKeys(welded));
+    CHECK(stacked.indices == welded.indices);  // First of each group kept, in order
+}
+
+// Meshing is deterministic: the per-tile parts are merged in tile order, so
+// running the same grid again, and again on one or three workers, gives
+// byte-identical vertex, normal and index arrays on every path that merges
+// tiles (unwelded, welded, welded with grid normals)
+static void testMeshDeterminism() {
+    sdfcpu::Tape tape = testScene();
+    const int res = 97;  // Tiles of uneven size at the far faces
+    std::vector<float> grid = sdfcpu::sampleGrid(tape, res, kMin, kMax);
+    auto identical = [](const mc::Mesh& a, const mc::Mesh& b) {
+        auto bytes = [](const std::vector<mc::Vec3>& x, const std::vector<mc::Vec3>& y) {
+            return x.size() == y.size() && std::memcmp(x.data(), y.data(), x.size() * sizeof(mc::Vec3)) == 0;
+        };
+        return bytes(a.vertices, b.vertices) && bytes(a.normals, b.normals) && a.indices == b.indices;
+    };
+    mc::ThreadPool& pool = mc::ThreadPool::instance();
+    for (int path = 0; path < 3; path++) {
+        auto mesh = [&]() { return mc::generateMesh(grid, res, kMin, kMax, 0.0f, path > 0, nullptr, path == 2); };
+        mc::Mesh first = mesh();
+        CHECK(triangleCount(first) > 0);
+        CHECK(identical(mesh(), first));
+        for (unsigned limit : {1u, 3u}) {
+            pool.setWorkerLimit(limit);
+            mc::Mesh limited = mesh();
+            pool.setWorkerLimit(0);
+            CHECK(identical(limited, first));
+        }
+    }
+}
+
+// The scene-translation primitives follow the sdf_scene.comp formulas
+static void testCpuPrimitives() {
+    using namespace sdfcpu;
+    auto clamp01 = [](float v) { return std::min(std::max(v, 0.0f), 1.0f); };
+    Expr a = sphere(0.5f, 0.2f, 0, 0), b = box(0.3f, 0.4f, 0.2f);
+    Tape tape = compile(ellipsoid(0.3f, 0.5f, 0.2f, 0.1f, -0.2f, 0));
+    Tape cap = compile(capsule(-0.2f, 0.1f, 0, 0.3f, -0.4f, 0.2f, 0.1f));
+    Tape su = compile(opSmoothUnion(a, b, 0.2f)), ss = compile(opSmoothSubtract(a, b, 0.2f));
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> u(-1.0f, 1.0f);
+    std::vector<mc::Vec3> points(1000);
+    for (mc::Vec3& p : points) p = mc::Vec3(u(rng), u(rng), u(rng));
+    std::vector<float> de = evaluate(tape, points), dc = evaluate(cap, points);
+    std::vector<float> du = evaluate(su, points), ds = evaluate(ss, points);
+    std::vector<float> da = evaluate(compile(a), points), db = evaluate(compile(b), points);
+    float worst = 0.0f;
+    for (size_t i = 0; i < points.size(); i++) {
+        mc::Vec3 p = points[i] - mc::Vec3(0.1f, -0.2f, 0);
+        float k0 = mc::Vec3(p.x / 0.3f, p.y / 0.5f, p.z / 0.2f).length();
+        float k1 = mc::Vec3(p.x / 0.09f, p.y / 0.25f, p.z / 0.04f).length();
+        worst = std::max(worst, std::fabs(de[i] - k0 * (k0 - 1.0f) / k1) / std::max(1.0f, std::fabs(de[i])));
+
+        mc::Vec3 pa = points[i] - mc::Vec3(-0.2f, 0.1f, 0), ba(0.5f, -0.5f, 0.2f);
+        float h = clamp01(pa.dot(ba) / ba.dot(ba));
+        worst = std::max(worst, std::fabs(dc[i] - ((pa - ba * h).length() - 0.1f)));
+
+        float d1 = da[i], d2 = db[i];
+        float hu = clamp01(0.5f + 0.5f * (d2 - d1) / 0.2f);
+        worst = std::max(worst, std::fabs(du[i] - (d2 * (1 - hu) + d1 * hu - 0.2f * hu * (1 - hu))));
+        float hs = clamp01(0.5f - 0.5f * (d2 + d1) / 0.2f);
+        worst = std::max(worst, std::fabs(ds[i] - (d2 * (1 - hs) - d1 * hs + 0.2f * hs * (1 - hs))));
+    }
+    CHECK(worst < 1e-5f);
+
+    // Every bundled translation compiles and meshes to a closed surface
+    // inside its bounds (the ground plane is cut open at the bounds)
+    Expr scene;
+    mc::Vec3 bmin, bmax;
+    CHECK(sceneForShader("sdf_scene", scene, bmin, bmax));
+    CHECK(!sceneForShader("no_such_shader", scene, bmin, bmax));
+    mc::Mesh mesh = meshScene(compile(scene), 96, bmin, bmax);
+    CHECK(triangleCount(mesh) > 0);
+    CHECK(mc::checkManifold(mesh).manifold());
+}
+
+// QEF solves: corner, crease and flat-plane cells land on their known
+// points (a crease or plane keeps the mass point along its free axes), two
+// nearly parallel planes are truncated to the mass point instead of jumping
+// to their far intersection, and the batched solver gives bit-identical
+// results to one-cell solves
+static void testQEFSolve() {
+    const mc::Vec3 lo{0, 0, 0}, hi{1, 1, 1};
+    auto solve = [&](const std::vector<std::pair<mc::Vec3, mc::Vec3>>& samples) {
+        mc::QEF q;
+        for (const auto& [p, n] : samples) q.add(p, n);
+        return q.solve(lo, hi);
+    };
+
+    // Corner of three tilted planes through f, two samples on each
+    mc::Vec3 f{0.4f, 0.5f, 0.6f};
+    mc::Vec3 n0{1, 1, 0}, n1{1, -1, 0.2f}, n2{0.1f, 0, 1};
+    CHECK(near(solve({{f + mc::Vec3(-0.1f, 0.1f, 0.2f), n0}, {f + mc::Vec3(0.1f, -0.1f, -0.1f), n0},
+                      {f + mc::Vec3(0.1f, 0.1f, 0), n1}, {f + mc::Vec3(-0.05f, -0.05f, 0), n1},
+                      {f + mc::Vec3(0, 0.2f, 0), n2}, {f + mc::Vec3(0.1f, 0, -0.01f), n2}}),
+               f, 1e-4f));
+
+    // Crease x = 0.3, y = 0.6 along Z: the mass point's z = 0.5 is kept
+    CHECK(near(solve({{{0.3f, 0.1f, 0.2f}, {1, 0, 0}}, {{0.3f, 0.9f, 0.8f}, {1, 0, 0}},
+                      {{0.1f, 0.6f, 0.3f}, {0, 1, 0}}, {{0.9f, 0.6f, 0.7f}, {0, 1, 0}}}),
+               {0.3f, 0.6f, 0.5f}, 1e-4f));
+
+    // Plane z = 0.4: the mass point, already on it
+    CHECK(near(solve({{{0.2f, 0.3f, 0.4f}, {0, 0, 1}}, {{0.8f, 0.5f, 0.4f}, {0, 0, 1}}}),
+               {0.5f, 0.4f, 0.4f}, 1e-4f));
+
+    // Planes x = 0.5 and x = 0.52 - 0.05 (y - 0.5) meet at y = 0.9, but the
+    // second singular value is far below QEF_SVD_TRUNCATION of the first,
+    // so y and z stay at the mass point (0.51, 0.5, 0.5)
+    mc::Vec3 tilted{1, 0.05f, 0};
+    mc::Vec3 x = solve({{{0.5f, 0.3f, 0.4f}, {1, 0, 0}}, {{0.5f, 0.7f, 0.6f}, {1, 0, 0}},
+                        {{0.525f, 0.4f, 0.5f}, tilted}, {{0.515f, 0.6f, 0.5f}, tilted}});
+    CHECK(x.x > 0.5f && x.x < 0.52f);
+    CHECK(std::fabs(x.y - 0.5f) < 0.01f);
+    CHECK(std::fabs(x.z - 0.5f) < 1e-4f);
+
+    // An odd count leaves a partly filled last batch
+    mc::QEFBenchmark bench = mc::benchmarkQEFSolve(3 * 21845);
+    CHECK_EQ(bench.mismatches, (size_t)0);
+    CHECK(bench.cornerError < 1e-3);
+}
+
+// Adaptive DC only merges topology-safe nodes: every tolerance keeps the
+// mesh closed, manifold and outward-facing with the same Euler
+// characteristic, and a larger tolerance never adds triangles
+static void testAdaptiveDC() {
+    sdfcpu::Tape torus = sdfcpu::compile(sdfcpu::torus(1.0f, 0.4f));
+    sdfcpu::Tape scene = testScene();
+    for (const sdfcpu::Tape* tape : {&torus, &scene}) {
+        int64_t euler = tape == &torus ? 0 : 2;
+        for (int res : {64, 128}) {
+            std::vector<float> grid = sdfcpu::sampleGrid(*tape, res, kMin, kMax);
+            size_t previous = SIZE_MAX;
+            for (float tolerance : {0.0f, 0.001f, 0.01f, 0.05f, 0.1f, 0.3f, 1.0f}) {
+                mc::Mesh mesh = mc::generateMeshDC(grid, res, kMin, kMax, 0.0f, false, 1.0f, tolerance);
+                mc::ManifoldReport report = mc::checkManifold(mesh);
+                size_t triangles = triangleCount(mesh);
+                CHECK(report.watertight());
+                CHECK_EQ(report.eulerCharacteristic, euler);
+                CHECK(signedVolume(mesh) > 0.0);
+                CHECK(triangles <= previous);
+                previous = triangles;
+            }
+            CHECK(previous * 10 < triangleCount(mc::generateMeshDC(grid, res, kMin, kMax)));
+        }
+    }
+}
+
+// The preview's block cache assembles the same mesh as welded MC, and after
+// an edit re-meshes only the blocks in the dirty box - a group of blocks per
+// fetch - into the same mesh as rebuilding the edited scene from scratch
+static void testMeshChunkCache() {
+    using namespace sdfcpu;
+    Tape before = testScene();
+    Tape after = compile(min(smoothUnion(sphere(1.0f), translate(box(0.5f, 0.5f, 0.5f), 1.0f, 0, 0), 0.1f),
+                             torus(0.8f, 0.2f, 0.3f, -1.2f, 0)));
+    for (int res : {97, 160}) {
+        auto fetchSlices = [&](const Tape& tape) {
+            return [&, res](int zStart, int zCount, float* dst) {
+                return sampleSlices(tape, dst, res, kMin, kMax, zStart, zCount);
+            };
+        };
+        mc::MeshChunkCache chunks;
+        chunks.reset(res, kMin, kMax);
+        CHECK(chunks.rebuild(fetchSlices(before)));
+        mc::Mesh welded = mc::generateMesh(sampleGrid(before, res, kMin, kMax), res, kMin, kMax, 0.0f, true);
+        CHECK(triangleKeys(chunks.assemble()) == triangleKeys(welded));
+
+        // The torus moved 0.3 along X: its old and new bounds
+        size_t dirty = chunks.invalidate({-1.1f, -1.5f, -1.1f}, {1.4f, -0.9f, 1.1f});
+        size_t fetches = 0;
+        CHECK(chunks.update([&](const int lo[3], const int dims[3], float* dst) {
+            return sampleBox(after, dst, res, kMin, kMax, lo, dims);
+        }, &fetches));
+        CHECK(dirty > 1);
+        CHECK(fetches > 0 && fetches < dirty);
+        CHECK_EQ(chunks.dirtyCount(), (size_t)0);
+
+        mc::MeshChunkCache fresh;
+        fresh.reset(res, kMin, kMax);
+        CHECK(fresh.rebuild(fetchSlices(after)));
+        mc::Mesh updated = chunks.assemble();
+        CHECK(triangleKeys(updated) == triangleKeys(fresh.assemble()));
+        CHECK(closedManifold(updated));
+    }
+}
+
+// Every mesher winds the same way and every normal source points out of the
+// surface: gradient normals, computeNormals over MC, streaming, block-cache
+// and (adaptive) DC meshes, and DC cube mode
+static void testNormalConvention() {
+    sdfcpu::Tape tape = testScene();
+    const int res = 64;
+    std::vector<float> grid = sdfcpu::sampleGrid(tape, res, kMin, kMax);
+    auto withFaceNormals = [](mc::Mesh mesh) {
+        mc::computeNormals(mesh);
+        return mesh;
+    };
+
+    mc::Mesh streamed = mc::generateMeshStreaming([&](int z, float* dst) {
+        std::memcpy(dst, &grid[(size_t)z * res * res], sizeof(float) * res * res);
+        return true;
+    }, res, kMin, kMax);
+    mc::MeshChunkCache chunks;
+    chunks.reset(res, kMin, kMax);
+    CHECK(chunks.rebuild([&](int zStart, int zCount, float* dst) {
+        std::memcpy(dst, &grid[(size_t)zStart * res * res], sizeof(float) * res * res * zCount);
+        return true;
+    }));
+    mc::Mesh gradient = streamed;
+    sdfcpu::computeGradientNormals(tape, gradient, 1e-3f);
+
+    const std::pair<const char*, mc::Mesh> meshes[] = {
+        {"mc grid normals", mc::generateMesh(grid, res, kMin, kMax, 0.0f, true, nullptr, true)},
+        {"mc", withFaceNormals(mc::generateMesh(grid, res, kMin, kMax, 0.0f, true))},
+        {"streaming", withFaceNormals(streamed)},
+        {"block cache", withFaceNormals(chunks.assemble())},
+        {"sdf gradient", gradient},
+        {"dc", withFaceNormals(mc::generateMeshDC(grid, res, kMin, kMax))},
+        {"adaptive dc", withFaceNormals(mc::generateMeshDC(grid, res, kMin, kMax, 0.0f, false, 1.0f, 0.05f))},
+    };
+    for (const auto& [name, mesh] : meshes) {
+        double along = normalsAlongGradient(tape, mesh);
+        if (along < 0.98) std::cerr << "  " << name << ": " << along << " of normals along the gradient" << std::endl;
+        CHECK(mesh.hasNormals());
+        CHECK(along >= 0.98);
+        CHECK(signedVolume(mesh) > 0.0);
+    }
+    CHECK(signedVolume(mc::generateMeshDC(grid, res, kMin, kMax, 0.0f, true)) > 0.0);
+}
+
+// Simplification keeps welded MC and DC meshes closed, manifold and outward-facing
+// with the same topology, and reaches the requested triangle count
+static void testSimplify() {
+    sdfcpu::Tape torus = sdfcpu::compile(sdfcpu::torus(1.0f, 0.4f));
+    sdfcpu::Tape scene = testScene();
+    for (const sdfcpu::Tape* tape : {&torus, &scene}) {
+        int64_t euler = tape == &torus ? 0 : 2;
+        for (int res : {64, 129}) {
+            // Brick-map MC at one resolution, uniform DC at the other
+            mc::Mesh mesh = res == 64 ? sdfcpu::meshScene(*tape, res, kMin, kMax)
+                                      : mc::generateMeshDC(sdfcpu::sampleGrid(*tape, res, kMin, kMax), res, kMin, kMax);
+            if (!mesh.hasNormals()) mc::computeNormals(mesh);
+            size_t triangles = triangleCount(mesh);
+            for (size_t divisor : {2, 8, 32}) {
+                mc::Mesh simplified = mc::simplifyMesh(mesh, triangles / divisor);
+                mc::ManifoldReport report = mc::checkManifold(simplified);
+                CHECK(report.watertight());
+                CHECK(report.manifold());
+                CHECK_EQ(report.eulerCharacteristic, euler);
+                CHECK(signedVolume(simplified) > 0.0);
+                CHECK(triangleCount(simplified) <= triangles / divisor + triangles / 100);
+                CHECK_EQ(simplified.normals.size(), simplified.vertices.size());
+            }
+            // maxError bounds how far the surface may move
+            mc::Mesh bounded = mc::simplifyMesh(mesh, 0, 0.002f);
+            CHECK(triangleCount(bounded) < triangles);
+            CHECK(mc::checkManifold(bounded).watertight());
+        }
+    }
+}
+
+// GPU optimization only reorders: ACMR does not get worse, the triangles
+// are the same up to rotation (winding kept), every vertex keeps its own
+// normal, color and UV through the renumbering, and an unreferenced vertex
+// is dropped
+static void testOptimizeMeshForGPU() {
+    sdfcpu::Tape tape = testScene();
+    mc::Mesh mesh = mc::generateMesh(sdfcpu::sampleGrid(tape, 64, kMin, kMax), 64, kMin, kMax, 0.0f, true);
+    mc::computeUVs(mesh);
+    mesh.colors.resize(mesh.vertices.size());
+    for (size_t i = 0; i < mesh.vertices.size(); i++) {
+        const mc::Vec3& v = mesh.vertices[i];
+        mesh.colors[i] = {0.25f * (v.x + 2), 0.25f * (v.y + 2), 0.25f * (v.z + 2)};
+    }
+    mc::Mesh original = mesh;
+    mesh.vertices.push_back({9, 9, 9});
+    mesh.normals.push_back({0, 0, 1});
+    mesh.colors.push_back({1, 1, 1});
+    mesh.uvs.push_back({0, 0});
+
+    float acmrBefore = mc::computeACMR(mesh.indices.data(), mesh.indices.size(), mesh.vertices.size());
+    mc::optimizeMeshForGPU(mesh);
+    float acmrAfter = mc::computeACMR(mesh.indices.data(), mesh.indices.size(), mesh.vertices.size());
+    CHECK(acmrAfter <= acmrBefore);
+    CHECK(acmrAfter < 1.0f);
+    CHECK(triangleKeys(mesh) == triangleKeys(original));
+    CHECK_EQ(mesh.vertices.size(), original.vertices.size());
+
+    std::map<Position, uint32_t> byPosition;
+    for (size_t i = 0; i < original.vertices.size(); i++) byPosition[key(original.vertices[i])] = (uint32_t)i;
+    CHECK_EQ(byPosition.size(), original.vertices.size());
+    CHECK(mesh.normals.size() == mesh.vertices.size() && mesh.colors.size() == mesh.vertices.size() &&
+          mesh.uvs.size() == mesh.vertices.size());
+    size_t mismatched = 0;
+    for (size_t i = 0; i < mesh.vertices.size() && i < mesh.uvs.size(); i++) {
+        auto it = byPosition.find(key(mesh.vertices[i]));
+        if (it == byPosition.end()) { mismatched++; continue; }
+        uint32_t o = it->second;
+        mismatched += std::memcmp(&mesh.normals[i], &original.normals[o], sizeof(mc::Vec3)) != 0 ||
+                      std::memcmp(&mesh.colors[i], &original.colors[o], sizeof(mc::Color3)) != 0 ||
+                      std::memcmp(&mesh.uvs[i], &original.uvs[o], sizeof(mc::Vec2)) != 0;
+    }
+    CHECK_EQ(mismatched, (size_t)0);
+}
+
+// Mesh clusters tile the reordered index buffer in full clusters (only the
+// last one short), hold every input triangle exactly once (winding kept,
+// offset applied), bound their vertices, and every triangle's normal lies
+// inside its cluster's cone, so a cluster reported backfacing from an eye
+// has no triangle facing it
+static void testMeshClusters() {
+    sdfcpu::Tape tape = testScene();
+    mc::Mesh mesh = mc::generateMesh(sdfcpu::sampleGrid(tape, 96, kMin, kMax), 96, kMin, kMax, 0.0f, true);
+    const uint32_t offset = 5;
+    auto sortedTriangles = [](const uint32_t* indices, size_t count, uint32_t subtract) {
+        std::vector<std::array<uint32_t, 3>> triangles;
+        for (size_t i = 0; i + 2 < count; i += 3) {
+            std::array<uint32_t, 3> t = {indices[i] - subtract, indices[i + 1] - subtract, indices[i + 2] - subtract};
+            std::rotate(t.begin(), std::min_element(t.begin(), t.end()), t.end());
+            triangles.push_back(t);
+        }
+        std::sort(triangles.begin(), triangles.end());
+        return triangles;
+    };
+    auto expected = sortedTriangles(mesh.indices.data(), mesh.indices.size(), 0);
+
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> far(-6.0f, 6.0f);
+    for (size_t perCluster : {(size_t)64, mc::MESH_CLUSTER_TRIANGLES}) {
+        for (bool optimizeCache : {false, true}) {
+            std::vector<uint32_t> out(mesh.indices.size(), UINT32_MAX);
+            std::vector<mc::MeshCluster> clusters = mc::buildMeshClusters(
+                mesh.vertices, mesh.indices.data(), mesh.indices.size(), out.data(), offset, optimizeCache, perCluster);
+            CHECK_EQ(clusters.size(), (triangleCount(mesh) + perCluster - 1) / perCluster);
+
+            size_t next = 0, badSizes = 0, outside = 0, unbounded = 0, coned = 0;
+            for (size_t ci = 0; ci < clusters.size(); ci++) {
+                const mc::MeshCluster& c = clusters[ci];
+                bool last = ci + 1 == clusters.size();
+                badSizes += c.firstIndex != next || c.indexCount == 0 || c.indexCount % 3 ||
+                            c.indexCount > 3 * perCluster || (!last && c.indexCount != 3 * perCluster);
+                next = c.firstIndex + c.indexCount;
+                if (next > out.size()) break;
+
+                float minCos = std::sqrt(std::max(0.0f, 1.0f - c.coneCutoff * c.coneCutoff));
+                coned += c.coneCutoff < 1.0f;
+                for (uint32_t i = c.firstIndex; i < next; i += 3) {
+                    const mc::Vec3& p0 = mesh.vertices[out[i] - offset];
+                    const mc::Vec3& p1 = mesh.vertices[out[i + 1] - offset];
+                    const mc::Vec3& p2 = mesh.vertices[out[i + 2] - offset];
+                    for (const mc::Vec3* p : {&p0, &p1, &p2}) {
+                        unbounded += (*p - c.center).length() > c.radius * 1.0001f + 1e-6f;
+                    }
+                    mc::Vec3 n = (p2 - p0).cross(p1 - p0);
+                    float len = n.length();
+                    if (c.coneCutoff >= 1.0f || len == 0.0f) continue;
+                    outside += n.dot(c.coneAxis) < (minCos - 1e-4f) * len;  // normalized() gives +Y for tiny faces
+                }
+            }
+            CHECK_EQ(badSizes, (size_t)0);
+            CHECK_EQ(next, out.size());
+            CHECK(sortedTriangles(out.data(), out.size(), offset) == expected);
+            CHECK_EQ(unbounded, (size_t)0);
+            CHECK_EQ(outside, (size_t)0);
+            CHECK(coned > clusters.size() / 2);
+
+            // Backface culling from random eyes never drops a front face
+            size_t culled = 0, visible = 0;
+            for (int e = 0; e < 64; e++) {
+                mc::Vec3 eye(far(rng), far(rng), far(rng));
+                for (const mc::MeshCluster& c : clusters) {
+                    if (!mc::clusterBackfacing(c, eye)) continue;
+                    culled++;
+                    for (uint32_t i = c.firstIndex; i < c.firstIndex + c.indexCount; i += 3) {
+                        const mc::Vec3& p0 = mesh.vertices[out[i] - offset];
+                        mc::Vec3 n = (mesh.vertices[out[i + 2] - offset] - p0).cross(mesh.vertices[out[i + 1] - offset] - p0);
+                        visible += (eye - p0).dot(n) > 1e-6f;
+                    }
+                }
+            }
+            CHECK(culled > 0);
+            CHECK_EQ(visible, (size_t)0);
+        }
+    }
+}
+
+// Brick map built the way the GPU sampler builds it: SDF at the brick
+// centres first, then only the bricks those cannot rule out
+static mc::BrickMap centreCulledBrickMap(const sdfcpu::Tape& tape, int res,
+                                         float bandCells = mc::BRICK_BAND_CELLS, float lipschitz = 1.0f) {
+    mc::BrickMap shape;
+    shape.reset(res, kMin, kMax);
+    int nb = shape.bricksPerAxis;
+    std::vector<mc::Vec3> centers;
+    mc::Vec3 c0 = shape.centerMin(), step = shape.cellSize * (float)mc::BRICK_SIZE;
+    for (int z = 0; z < nb; z++)
+        for (int y = 0; y < nb; y++)
+            for (int x = 0; x < nb; x++)
+                centers.push_back(c0 + mc::Vec3(step.x * x, step.y * y, step.z * z));
+    return mc::buildBrickMap(res, kMin, kMax, sdfcpu::evaluate(tape, centers),
+        [&](const int lo[3], const int dims[3], float* dst) {
+            return sdfcpu::sampleBox(tape, dst, res, kMin, kMax, lo, dims);
+        }, bandCells, lipschitz);
+}
+
+// Brick-map MC (interval-culled sampling, dense build and centre-culled
+// build) and MC on the interval-culled dense grid give the same triangles
+// as welded MC on the dense grid, with
+// grids that are and are not a multiple of BRICK_SIZE. A field 8x steeper
+// than an SDF only matches once the band (and the centre reach) is widened
+// by the same factor.
+static void testBrickMapMC() {
+    sdfcpu::Tape tape = testScene();
+    for (int res : {64, 101, 200}) {
+        std::vector<float> grid = sdfcpu::sampleGrid(tape, res, kMin, kMax);
+        auto dense = triangleKeys(mc::generateMesh(grid, res, kMin, kMax, 0.0f, true));
+        CHECK(!dense.empty());
+        CHECK(triangleKeys(mc::generateMeshBricks(sdfcpu::sampleBricks(tape, res, kMin, kMax))) == dense);
+        CHECK(triangleKeys(mc::generateMeshBricks(mc::buildBrickMap(grid, res, kMin, kMax))) == dense);
+
+        CHECK(triangleKeys(mc::generateMeshBricks(centreCulledBrickMap(tape, res))) == dense);
+
+        // The dense grid the hierarchical sampler builds from culled bricks
+        // keeps every in-band sample and only swaps far ones for +-farValue
+        std::vector<float> culled = sdfcpu::sampleGridCulled(tape, res, kMin, kMax);
+        CHECK_EQ(culled.size(), grid.size());
+        float band = mc::BRICK_BAND_CELLS * (kMax.x - kMin.x) / (res - 1);
+        size_t replaced = 0, wrong = 0;
+        for (size_t i = 0; i < grid.size() && i < culled.size(); i++) {
+            if (culled[i] == grid[i]) continue;
+            replaced++;
+            wrong += std::fabs(grid[i]) <= band || (culled[i] < 0) != (grid[i] < 0);
+        }
+        CHECK(replaced > 0);
+        CHECK_EQ(wrong, (size_t)0);
+        CHECK(triangleKeys(mc::generateMesh(culled, res, kMin, kMax, 0.0f, true)) == dense);
+    }
+
+    using namespace sdfcpu;
+    Tape steep = compile((smoothUnion(sphere(1.0f), translate(box(0.5f, 0.5f, 0.5f), 1.0f, 0, 0), 0.1f) - 0.3f) * 8.0f);
+    const int res = 101;
+    std::vector<float> grid = sampleGrid(steep, res, kMin, kMax);
+    auto dense = triangleKeys(mc::generateMesh(grid, res, kMin, kMax, 0.0f, true));
+    const float wide = 8.0f * mc::BRICK_BAND_CELLS;
+    CHECK(triangleKeys(mc::generateMeshBricks(mc::buildBrickMap(grid, res, kMin, kMax))) != dense);
+    CHECK(triangleKeys(mc::generateMeshBricks(mc::buildBrickMap(grid, res, kMin, kMax, wide))) == dense);
+    CHECK(triangleKeys(mc::generateMeshBricks(centreCulledBrickMap(steep, res, wide, 1.0f))) != dense);
+    CHECK(triangleKeys(mc::generateMeshBricks(centreCulledBrickMap(steep, res, wide, 8.0f))) == dense);
+}
+
+// The LOD chain built from a widened brick map and its brick pyramid has the
+// same triangles as the chain from the dense grid's pyramid, and every level
+// is closed and manifold
+static void testBrickLODs() {
+    sdfcpu::Tape tape = testScene();
+    const int levels = 4;
+    for (int res : {97, 128}) {
+        std::vector<float> grid = sdfcpu::sampleGrid(tape, res, kMin, kMax);
+        std::vector<mc::Mesh> dense = mc::generateMeshLODs(grid, res, kMin, kMax, levels);
+        mc::BrickMap map = sdfcpu::sampleBricks(tape, res, kMin, kMax, 0.0f, mc::brickPyramidBandCells(levels));
+        std::vector<mc::Mesh> sparse = mc::generateMeshLODs(map, levels);
+
+        CHECK_EQ(sparse.size(), dense.size());
+        for (size_t l = 0; l < std::min(sparse.size(), dense.size()); l++) {
+            CHECK(triangleCount(sparse[l]) > 0);
+            CHECK(triangleKeys(sparse[l]) == triangleKeys(dense[l]));
+            CHECK(closedManifold(sparse[l]));
+            CHECK(mc::checkManifold(sparse[l]).manifold());
+            CHECK(signedVolume(sparse[l]) > 0.0);
+            CHECK_EQ(sparse[l].normals.size(), sparse[l].vertices.size());
+            CHECK(normalsAlongGradient(tape, sparse[l]) >= 0.95);
+        }
+    }
+}
+
+// formatFloat prints exactly what printf("%g") prints: edge cases, values
+// straddling every rounding boundary and random bit patterns
+static void testFormatFloat() {
+    std::vector<float> values = {0.0f, -0.0f, 1.0f, -1.0f, 0.5f, 1e-4f, 9.99999e-5f, 1e6f, 999999.f,
+                                 999999.5f, 9.999995f, 0.000999999f, 123456.5f, 1e-45f, FLT_MAX, -FLT_MAX,
+                                 FLT_MIN, INFINITY, -INFINITY, 0.1f, 0.3f, 2.5f, 3.5f};
+    for (int e = -6; e <= 7; e++) {
+        for (float m : {1.0f, 9.999995f, 9.9999949f, 1.0000005f, 4.999995f, 5.000005f}) {
+            float v = m * std::pow(10.0f, (float)e);
+            for (int step = -3; step <= 3; step++) {
+                float w = v;
+                for (int k = 0; k < std::abs(step); k++) w = std::nextafter(w, step > 0 ? INFINITY : 0.0f);
+                values.push_back(w);
+                values.push_back(-w);
+            }
+        }
+    }
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<float> uniform(-4.0f, 4.0f);
+    for (int i = 0; i < 200000; i++) {
+        uint32_t bits = rng();
+        float v;
+        std::memcpy(&v, &bits, sizeof(v));
+        if (!std::isnan(v)) values.push_back(v);
+        values.push_back(uniform(rng));
+    }
+
+    size_t mismatches = 0;
+    for (float v : values) {
+        char expected[32], actual[32];
+        snprintf(expected, sizeof(expected), "%g", v);
+        *mc::formatFloat(actual, v) = '\0';
+        if (std::strcmp(expected, actual) != 0 && mismatches++ < 5) {
+            std::cerr << "  formatFloat(" << expected << ") wrote " << actual << std::endl;
+        }
+    }
+    CHECK_EQ(mismatches, (size_t)0);
+}
+
+// exportOBJ writes the same bytes as the iostream writer it replaced, for
+// every combination of colors, UVs and normals
+static void testExportOBJ() {
+    sdfcpu::Tape tape = testScene();
+    const int res = 200;  // Over EXPORT_CHUNK_ITEMS vertices, so chunk seams are covered
+    mc::Mesh mesh = mc::generateMesh(sdfcpu::sampleGrid(tape, res, kMin, kMax), res, kMin, kMax, 0.0f, true);
+    CHECK(mesh.vertices.size() > mc::EXPORT_CHUNK_ITEMS);
+    mc::computeUVs(mesh);
+    mesh.colors.resize(mesh.vertices.size());
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    for (mc::Color3& c : mesh.colors) c = {unit(rng), unit(rng), unit(rng)};
+    mc::Mesh bare = mesh;
+    bare.normals.clear();
+
+    std::string expectedPath = tempPath("mesh_test_expected.obj");
+    std::string actualPath = tempPath("mesh_test_actual.obj");
+    for (const mc::Mesh* m : {&mesh, &bare}) {
+        for (int flags = 0; flags < 4; flags++) {
+            bool colors = flags & 1, uvs = flags & 2;
+            CHECK(baselineExportOBJ(expectedPath, *m, colors, uvs));
+            CHECK(mc::exportOBJ(actualPath, *m, colors, uvs));
+            std::string expected = readFile(expectedPath);
+            CHECK(expected.size() > 1000);
+            CHECK(readFile(actualPath) == expected);
+        }
+    }
+    std::filesystem::remove(expectedPath);
+    std::filesystem::remove(actualPath);
+}
+
+// Binary STL and PLY read back: header, counts, every triangle written CCW
+// (last two corners swapped from MC winding, so outward by the right-hand
+// rule) and, in PLY, the normal and RGB8 color properties present exactly
+// when requested and available
+static void testExportSTLPLY() {
+    sdfcpu::Tape tape = testScene();
+    mc::Mesh mesh = mc::generateMesh(sdfcpu::sampleGrid(tape, 48, kMin, kMax), 48, kMin, kMax,
+                                     0.0f, true, nullptr, true);
+    mesh.colors.resize(mesh.vertices.size());
+    for (size_t i = 0; i < mesh.vertices.size(); i++) {
+        const mc::Vec3& v = mesh.vertices[i];
+        mesh.colors[i] = {0.25f * (v.x + 2), 0.25f * (v.y + 2), 0.25f * (v.z + 2)};
+    }
+    const size_t triangles = triangleCount(mesh);
+    auto ccw = [&](size_t t, int k) { return mesh.indices[3 * t + (k == 0 ? 0 : 3 - k)]; };
+    auto same = [](const char* bytes, const void* value, size_t size) { return std::memcmp(bytes, value, size) == 0; };
+
+    std::string path = tempPath("mesh_test.stl");
+    CHECK(mc::exportSTL(path, mesh));
+    std::string stl = readFile(path);
+    CHECK_EQ(stl.size(), 84 + 50 * triangles);
+    if (stl.size() == 84 + 50 * triangles) {
+        CHECK(stl.compare(0, 5, "solid") != 0);  // Binary readers sniff for ASCII "solid"
+        uint32_t count;
+        std::memcpy(&count, &stl[80], 4);
+        CHECK_EQ((size_t)count, triangles);
+        size_t moved = 0, inward = 0;
+        double volume = 0.0;
+        for (size_t t = 0; t < triangles; t++) {
+            const char* facet = &stl[84 + 50 * t];
+            mc::Vec3 n, p[3];
+            std::memcpy(&n, facet, 12);
+            for (int k = 0; k < 3; k++) {
+                std::memcpy(&p[k], facet + 12 + 12 * k, 12);
+                moved += !same(facet + 12 + 12 * k, &mesh.vertices[ccw(t, k)], 12);
+            }
+            moved += facet[48] != 0 || facet[49] != 0;
+            mc::Vec3 face = (p[1] - p[0]).cross(p[2] - p[0]);
+            inward += face.length() > 1e-5f && n.dot(face) <= 0.0f;
+            volume += p[0].dot(p[1].cross(p[2])) / 6.0;
+        }
+        CHECK_EQ(moved, (size_t)0);
+        CHECK_EQ(inward, (size_t)0);
+        CHECK(volume > 0.0);  // CCW around the enclosed volume
+    }
+
+    path = tempPath("mesh_test.ply");
+    mc::Mesh bare = mesh;
+    bare.normals.clear();
+    for (int variant = 0; variant < 3; variant++) {
+        const mc::Mesh& m = variant == 2 ? bare : mesh;
+        bool colors = variant != 1, normals = variant != 2;
+        CHECK(mc::exportPLY(path, m, variant != 1));
+        std::string ply = readFile(path);
+        std::string header = "ply\nformat binary_little_endian 1.0\n"
+                             "comment Generated by Marching Cubes (Parallel)\n"
+                             "element vertex " + std::to_string(m.vertices.size()) + "\n"
+                             "property float x\nproperty float y\nproperty float z\n" +
+                             (normals ? "property float nx\nproperty float ny\nproperty float nz\n" : "") +
+                             (colors ? "property uchar red\nproperty uchar green\nproperty uchar blue\n" : "") +
+                             "element face " + std::to_string(triangles) + "\n"
+                             "property list uchar uint vertex_indices\nend_header\n";
+        size_t vertexBytes = 12 + (normals ? 12 : 0) + (colors ? 3 : 0);
+        CHECK(ply.compare(0, header.size(), header) == 0);
+        CHECK_EQ(ply.size(), header.size() + vertexBytes * m.vertices.size() + 13 * triangles);
+        if (ply.size() != header.size() + vertexBytes * m.vertices.size() + 13 * triangles) continue;
+
+        size_t mismatched = 0;
+        const char* vertex = ply.data() + header.size();
+        for (size_t i = 0; i < m.vertices.size(); i++, vertex += vertexBytes) {
+            mismatched += !same(vertex, &m.vertices[i], 12) || (normals && !same(vertex + 12, &m.normals[i], 12));
+            if (colors) {
+                const uint8_t* rgb = reinterpret_cast<const uint8_t*>(vertex + (normals ? 24 : 12));
+                const mc::Color3& c = m.colors[i];
+                mismatched += rgb[0] != mc::unorm8(c.r) || rgb[1] != mc::unorm8(c.g) || rgb[2] != mc::unorm8(c.b);
+            }
+        }
+        const char* face = vertex;
+        for (size_t t = 0; t < triangles; t++, face += 13) {
+            uint32_t expected[3] = {ccw(t, 0), ccw(t, 1), ccw(t, 2)};
+            mismatched += face[0] != 3 || !same(face + 1, expected, 12);
+        }
+        CHECK_EQ(mismatched, (size_t)0);
+    }
+    std::filesystem::remove(path);
+    std::filesystem::remove(tempPath("mesh_test.stl"));
+}
+
+// GLB loading: exporter round trip (single mesh and LOD chain), an
+// interleaved vertex buffer with VEC4 UNSIGNED_BYTE colors and 8-bit
+// indices, VEC4 float colors with 16-bit indices, and node transforms
+// (TRS, matrix, mirroring, instancing, several scenes)
+static void testLoadGLB() {
+    std::string path = tempPath("mesh_test.glb");
+
+    // Exporter output reads back exactly; a LOD file reads as LOD0
+    sdfcpu::Tape tape = testScene();
+    std::vector<float> grid = sdfcpu::sampleGrid(tape, 48, kMin, kMax);
+    std::vector<mc::Mesh> lods = mc::generateMeshLODs(grid, 48, kMin, kMax, 3);
+    for (mc::Mesh& lod : lods) mc::setUniformColor(lod, 0.25f, 0.5f, 0.75f);
+    mc::Mesh loaded;
+    CHECK(mc::exportGLB(path, lods[0], true));
+    CHECK(mc::loadGLB(path, loaded));
+    CHECK(samePoints(loaded.vertices, lods[0].vertices));
+    CHECK(samePoints(loaded.normals, lods[0].normals));
+    CHECK(loaded.indices == lods[0].indices);
+    CHECK_EQ(loaded.colors.size(), lods[0].colors.size());
+    CHECK(!loaded.colors.empty() && loaded.colors.back().g == 0.5f);
+    CHECK(mc::exportGLB(path, lods, true));
+    CHECK(mc::loadGLB(path, loaded));
+    CHECK(samePoints(loaded.vertices, lods[0].vertices));
+    CHECK(loaded.indices == lods[0].indices);
+
+    // A quad written CCW as glTF requires: face normal (v1-v0)x(v2-v0) = +Z.
+    // It loads in MC winding, with the last two corners swapped.
+    const std::vector<mc::Vec3> quad = {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}};
+    const std::vector<uint32_t> fileIndices = {0, 1, 2, 0, 2, 3};
+    const std::vector<uint32_t> quadIndices = {0, 2, 1, 0, 3, 2};
+    const std::string asset = "\"asset\":{\"version\":\"2.0\"},";
+
+    // Interleaved position/normal/RGBA8 color, 8-bit indices, no scenes
+    {
+        std::vector<uint8_t> vertexData(quad.size() * 28);
+        for (size_t i = 0; i < quad.size(); i++) {
+            float pn[6] = {quad[i].x, quad[i].y, quad[i].z, 0, 0, 1};
+            uint8_t rgba[4] = {(uint8_t)(60 * i), 255, 0, 128};
+            std::memcpy(&vertexData[i * 28], pn, sizeof(pn));
+            std::memcpy(&vertexData[i * 28 + 24], rgba, sizeof(rgba));
+        }
+        std::vector<uint8_t> bin;
+        appendBin(bin, vertexData);
+        size_t indexOffset = appendBin(bin, std::vector<uint8_t>(fileIndices.begin(), fileIndices.end()));
+        std::string json = "{" + asset +
+            "\"nodes\":[{\"mesh\":0}],\"meshes\":[{\"primitives\":[{\"attributes\":"
+            "{\"POSITION\":0,\"NORMAL\":1,\"COLOR_0\":2},\"indices\":3}]}],"
+            "\"accessors\":["
+            "{\"bufferView\":0,\"componentType\":5126,\"count\":4,\"type\":\"VEC3\"},"
+            "{\"bufferView\":0,\"byteOffset\":12,\"componentType\":5126,\"count\":4,\"type\":\"VEC3\"},"
+            "{\"bufferView\":0,\"byteOffset\":24,\"componentType\":5121,\"normalized\":true,\"count\":4,\"type\":\"VEC4\"},"
+            "{\"bufferView\":1,\"componentType\":5121,\"count\":6,\"type\":\"SCALAR\"}],"
+            "\"bufferViews\":[{\"buffer\":0,\"byteLength\":112,\"byteStride\":28},"
+            "{\"buffer\":0,\"byteOffset\":" + std::to_string(indexOffset) + ",\"byteLength\":6}],"
+            "\"buffers\":[{\"byteLength\":" + std::to_string(bin.size()) + "}]}";
+        writeGLBFile(path, json, bin);
+        CHECK(mc::loadGLB(path, loaded));
+        CHECK(samePoints(loaded.vertices, quad));
+        CHECK(loaded.indices == quadIndices);
+        CHECK(loaded.hasNormals() && near(loaded.normals[3], {0, 0, 1}));
+        CHECK(loaded.hasColors() && std::fabs(loaded.colors[2].r - 120 / 255.0f) < 1e-6f &&
+              loaded.colors[2].g == 1.0f && loaded.colors[2].b == 0.0f);
+    }
+
+    // Separate arrays, VEC4 float colors, 16-bit indices
+    {
+        std::vector<uint8_t> bin;
+        size_t positions = appendBin(bin, quad);
+        size_t colors = appendBin(bin, std::vector<float>{1, 0, 0, 1, 0, 1, 0, 1, 0, 0, 1, 1, 1, 1, 1, 0.5f});
+        size_t indices = appendBin(bin, std::vector<uint16_t>(fileIndices.begin(), fileIndices.end()));
+        std::string json = "{" + asset +
+            "\"meshes\":[{\"primitives\":[{\"attributes\":{\"POSITION\":0,\"COLOR_0\":1},\"indices\":2}]}],"
+            "\"accessors\":["
+            "{\"bufferView\":0,\"componentType\":5126,\"count\":4,\"type\":\"VEC3\"},"
+            "{\"bufferView\":1,\"componentType\":5126,\"count\":4,\"type\":\"VEC4\"},"
+            "{\"bufferView\":2,\"componentType\":5123,\"count\":6,\"type\":\"SCALAR\"}],"
+            "\"bufferViews\":["
+            "{\"buffer\":0,\"byteOffset\":" + std::to_string(positions) + ",\"byteLength\":48},"
+            "{\"buffer\":0,\"byteOffset\":" + std::to_string(colors) + ",\"byteLength\":64},"
+            "{\"buffer\":0,\"byteOffset\":" + std::to_string(indices) + ",\"byteLength\":12}],"
+            "\"buffers\":[{\"byteLength\":" + std::to_string(bin.size()) + "}]}";
+        writeGLBFile(path, json, bin);
+        CHECK(mc::loadGLB(path, loaded));
+        CHECK(samePoints(loaded.vertices, quad));
+        CHECK(loaded.indices == quadIndices);
+        CHECK(!loaded.hasNormals());
+        CHECK(loaded.hasColors() && loaded.colors[1].g == 1.0f && loaded.colors[2].b == 1.0f &&
+              loaded.colors[3].r == 1.0f && loaded.colors[0].g == 0.0f);
+    }
+
+    // Node transforms. Scene 0: node 0 scales by 2, turns 90 degrees about Z
+    // and translates; its child node 1 mirrors X and moves 5 along Z with a
+    // matrix. Scene 1: node 2 instances the mesh untransformed. Mesh 1 is in
+    // no node.
+    {
+        std::vector<uint8_t> bin;
+        size_t positions = appendBin(bin, quad);
+        size_t normals = appendBin(bin, std::vector<mc::Vec3>(4, mc::Vec3(0, 0, 1)));
+        size_t indices = appendBin(bin, fileIndices);
+        float h = std::sqrt(0.5f);
+        char rotation[64];
+        snprintf(rotation, sizeof(rotation), "[0,0,%.9g,%.9g]", h, h);
+        std::string prim = "{\"primitives\":[{\"attributes\":{\"POSITION\":0,\"NORMAL\":1},\"indices\":2}]}";
+        std::string json = "{" + asset +
+            "\"scene\":0,\"scenes\":[{\"nodes\":[0]},{\"nodes\":[2]}],"
+            "\"nodes\":[{\"mesh\":0,\"children\":[1],\"translation\":[1,2,3],\"rotation\":" + rotation +
+            ",\"scale\":[2,2,2]},"
+            "{\"mesh\":0,\"matrix\":[-1,0,0,0, 0,1,0,0, 0,0,1,0, 0,0,5,1]},"
+            "{\"mesh\":0}],"
+            "\"meshes\":[" + prim + "," + prim + "],"
+            "\"accessors\":["
+            "{\"bufferView\":0,\"componentType\":5126,\"count\":4,\"type\":\"VEC3\"},"
+            "{\"bufferView\":1,\"componentType\":5126,\"count\":4,\"type\":\"VEC3\"},"
+            "{\"bufferView\":2,\"componentType\":5125,\"count\":6,\"type\":\"SCALAR\"}],"
+            "\"bufferViews\":["
+            "{\"buffer\":0,\"byteOffset\":" + std::to_string(positions) + ",\"byteLength\":48},"
+            "{\"buffer\":0,\"byteOffset\":" + std::to_string(normals) + ",\"byteLength\":48},"
+            "{\"buffer\":0,\"byteOffset\":" + std::to_string(indices) + ",\"byteLength\":24}],"
+            "\"buffers\":[{\"byteLength\":" + std::to_string(bin.size()) + "}]}";
+        writeGLBFile(path, json, bin);
+
+        // node 0: (x, y, z) -> (1 - 2y, 2 + 2x, 3 + 2z); node 1 mirrors X and
+        // adds 5 to Z first; nodes 2 and the unplaced mesh are identity
+        auto node0 = [](mc::Vec3 p) { return mc::Vec3(1 - 2 * p.y, 2 + 2 * p.x, 3 + 2 * p.z); };
+        auto node1 = [&](mc::Vec3 p) { return node0(mc::Vec3(-p.x, p.y, p.z + 5)); };
+        CHECK(mc::loadGLB(path, loaded));
+        CHECK_EQ(loaded.vertices.size(), (size_t)16);
+        CHECK_EQ(loaded.indices.size(), (size_t)24);
+        bool placed = loaded.vertices.size() == 16;
+        for (size_t i = 0; placed && i < 4; i++) {
+            placed = near(loaded.vertices[i], node0(quad[i])) && near(loaded.vertices[4 + i], node1(quad[i])) &&
+                     key(loaded.vertices[8 + i]) == key(quad[i]) && key(loaded.vertices[12 + i]) == key(quad[i]);
+        }
+        CHECK(placed);
+        // Normals stay unit length and on the faces' outward side; the
+        // mirrored instance's triangles are flipped to keep it that way
+        for (size_t t = 0; t + 2 < loaded.indices.size(); t += 3) {
+            const mc::Vec3& a = loaded.vertices[loaded.indices[t]];
+            const mc::Vec3& b = loaded.vertices[loaded.indices[t + 1]];
+            const mc::Vec3& c = loaded.vertices[loaded.indices[t + 2]];
+            mc::Vec3 face = (c - a).cross(b - a).normalized();
+            const mc::Vec3& n = loaded.normals[loaded.indices[t]];
+            CHECK(std::fabs(n.length() - 1.0f) < 1e-5f);
+            CHECK(near(face, n));
+        }
+
+        CHECK(mc::loadGLB(path, loaded, 0));
+        CHECK_EQ(loaded.vertices.size(), (size_t)8);
+        CHECK(mc::loadGLB(path, loaded, 1));
+        CHECK(samePoints(loaded.vertices, quad));
+        CHECK(!mc::loadGLB(path, loaded, 2));
+    }
+
+    // Malformed accessors: counts whose extent wraps 64 bits (2^62 elements
+    // of stride 4 or 8), one past the view, and one beyond int64 are refused
+    // instead of being read or decoded past the mapping
+    {
+        std::vector<uint8_t> bin;
+        size_t positions = appendBin(bin, quad);
+        size_t quantized = appendBin(bin, std::vector<int16_t>(16, 0));
+        size_t indices = appendBin(bin, fileIndices);
+        auto glbWith = [&](const std::string& positionCount, const std::string& indexCount, bool quantizedPositions) {
+            std::string positionAccessor = quantizedPositions
+                ? "{\"bufferView\":1,\"componentType\":5122,\"normalized\":true,\"count\":" + positionCount +
+                  ",\"type\":\"VEC3\"},"
+                : "{\"bufferView\":0,\"componentType\":5126,\"count\":" + positionCount + ",\"type\":\"VEC3\"},";
+            std::string json = "{" + asset +
+                "\"meshes\":[{\"primitives\":[{\"attributes\":{\"POSITION\":0},\"indices\":1}]}],"
+                "\"accessors\":[" + positionAccessor +
+                "{\"bufferView\":2,\"componentType\":5125,\"count\":" + indexCount + ",\"type\":\"SCALAR\"}],"
+                "\"bufferViews\":["
+                "{\"buffer\":0,\"byteOffset\":" + std::to_string(positions) + ",\"byteLength\":48},"
+                "{\"buffer\":0,\"byteOffset\":" + std::to_string(quantized) + ",\"byteLength\":32,\"byteStride\":8},"
+                "{\"buffer\":0,\"byteOffset\":" + std::to_string(indices) + ",\"byteLength\":24}],"
+                "\"buffers\":[{\"byteLength\":" + std::to_string(bin.size()) + "}]}";
+            writeGLBFile(path, json, bin);
+        };
+        const std::string wrap = "4611686018427387904";  // 2^62
+        glbWith("4", "6", false);
+        CHECK(mc::loadGLB(path, loaded));
+        glbWith("4", "6", true);
+        CHECK(mc::loadGLB(path, loaded));
+        glbWith("4", wrap, false);
+        CHECK(!mc::loadGLB(path, loaded));
+        glbWith(wrap, "6", true);
+        CHECK(!mc::loadGLB(path, loaded));
+        glbWith("4", "7", false);
+        CHECK(!mc::loadGLB(path, loaded));
+        glbWith("5", "6", true);
+        CHECK(!mc::loadGLB(path, loaded));
+        glbWith("1e30", "6", false);
+        CHECK(!mc::loadGLB(path, loaded));
+    }
+    std::filesystem::remove(path);
+}
+
+// Whether every non-degenerate triangle in the GLB's index accessors, read as
+// stored, is counter-clockwise seen from the side its vertex normals point to
+static bool glbTrianglesCCW(const std::string& path) {
+    mc::GLBFile file;
+    std::vector<mc::GLBPrimitive> prims;
+    if (!file.open(path) || !file.primitives(prims) || prims.empty()) return false;
+    for (const mc::GLBPrimitive& p : prims) {
+        if (!p.indices.data || p.normals.empty()) return false;
+        for (size_t t = 0; t + 2 < p.indices.count; t += 3) {
+            uint32_t a = p.indices.index(t), b = p.indices.index(t + 1), c = p.indices.index(t + 2);
+            mc::Vec3 face = (p.positions[b] - p.positions[a]).cross(p.positions[c] - p.positions[a]);
+            if (face.dot(face) == 0.0f) continue;  // Collapsed onto the quantization grid
+            if (face.dot(p.normals[a] + p.normals[b] + p.normals[c]) <= 0.0f) return false;
+        }
+    }
+    return true;
+}
+
+// Preview vertices (packVertex into the 16-byte CompactVertex) decode to
+// within half a position step, 0.01 degrees of the normal and half a color
+// step; a missing color packs as zero
+static void testCompactVertex() {
+    sdfcpu::Tape tape = testScene();
+    mc::Mesh mesh = mc::generateMesh(sdfcpu::sampleGrid(tape, 64, kMin, kMax), 64, kMin, kMax,
+                                     0.0f, true, nullptr, true);
+    mc::PositionQuantizer q = mc::PositionQuantizer::fit(mesh.vertices, mesh.vertices.size());
+    float position = 0, normal = 0, color = 0;  // Normal error in degrees
+    size_t opaque = 0;
+    for (size_t i = 0; i < mesh.vertices.size(); i++) {
+        const mc::Vec3& v = mesh.vertices[i];
+        mc::Color3 c(0.25f * (v.x + 2), 0.25f * (v.y + 2), 0.25f * (v.z + 2));
+        mc::Vec3 n = mesh.normals[i].normalized();
+        mc::CompactVertex packed = mc::packVertex(q, v, n, &c);
+        mc::Vec3 d = q.decode(packed.position) - v;
+        position = std::max({position, std::fabs(d.x), std::fabs(d.y), std::fabs(d.z)});
+        mc::Vec3 decoded = mc::decodeOctahedral(packed.normal);
+        normal = std::max(normal, std::atan2(decoded.cross(n).length(), decoded.dot(n)) * 57.29578f);
+        const uint8_t* rgba = packed.color;
+        color = std::max({color, std::fabs(rgba[0] / 255.0f - c.r), std::fabs(rgba[1] / 255.0f - c.g),
+                          std::fabs(rgba[2] / 255.0f - c.b)});
+        opaque += rgba[3] == 255;
+    }
+    CHECK_EQ(opaque, mesh.vertices.size());
+    CHECK(position <= 0.5f * q.step * 1.01f);
+    CHECK(normal < 0.01f);
+    CHECK(color <= 0.5f / 255.0f + 1e-6f);
+    mc::CompactVertex bare = mc::packVertex(q, mesh.vertices[0], mesh.normals[0]);
+    CHECK(bare.color[0] == 0 && bare.color[1] == 0 && bare.color[2] == 0 && bare.color[3] == 0);
+}
+
+// GLB export round trip with float (q=0) and KHR_mesh_quantization (q=1)
+// attributes: q=0 is exact, q=1 keeps positions within half a quantization
+// step, normals within a byte's precision, colors within 1/255, and the
+// indices (16-bit when they fit, 32-bit otherwise), stored CCW in both
+static void testGLBQuantization() {
+    std::string path = tempPath("mesh_test_q.glb");
+    sdfcpu::Tape tape = testScene();
+    for (int res : {48, 200}) {  // 200³ has more than 65535 vertices
+        mc::Mesh mesh = mc::generateMesh(sdfcpu::sampleGrid(tape, res, kMin, kMax), res, kMin, kMax,
+                                         0.0f, true, nullptr, true);
+        mesh.colors.resize(mesh.vertices.size());
+        for (size_t i = 0; i < mesh.vertices.size(); i++) {
+            const mc::Vec3& v = mesh.vertices[i];
+            mesh.colors[i] = {0.25f * (v.x + 2), 0.25f * (v.y + 2), 0.25f * (v.z + 2)};
+        }
+        CHECK_EQ(res == 200, mesh.vertices.size() > UINT16_MAX);
+
+        mc::Mesh loaded;
+        CHECK(mc::exportGLB(path, mesh, true, false));
+        CHECK(glbTrianglesCCW(path));
+        CHECK(mc::loadGLB(path, loaded));
+        CHECK(samePoints(loaded.vertices, mesh.vertices));
+        CHECK(samePoints(loaded.normals, mesh.normals));
+        CHECK(loaded.indices == mesh.indices);
+        CHECK(loaded.colors.size() == mesh.colors.size() &&
+              std::memcmp(loaded.colors.data(), mesh.colors.data(), mesh.colors.size() * sizeof(mc::Color3)) == 0);
+
+        CHECK(mc::exportGLB(path, mesh, true, true));
+        CHECK(glbTrianglesCCW(path));
+        CHECK(mc::loadGLB(path, loaded));
+        CHECK(loaded.indices == mesh.indices);
+        CHECK_EQ(loaded.vertices.size(), mesh.vertices.size());
+        CHECK_EQ(loaded.normals.size(), mesh.vertices.size());
+        CHECK_EQ(loaded.colors.size(), mesh.vertices.size());
+        if (loaded.vertices.size() != mesh.vertices.size() || loaded.normals.size() != mesh.vertices.size() ||
+            loaded.colors.size() != mesh.vertices.size()) {
+            continue;
+        }
+        float step = mc::PositionQuantizer::fit(mesh.vertices, mesh.vertices.size()).step;
+        float position = 0, normal = 1, color = 0;
+        for (size_t i = 0; i < mesh.vertices.size(); i++) {
+            mc::Vec3 d = loaded.vertices[i] - mesh.vertices[i];
+            position = std::max({position, std::fabs(d.x), std::fabs(d.y), std::fabs(d.z)});
+            normal = std::min(normal, loaded.normals[i].dot(mesh.normals[i]));
+            const mc::Color3 &a = loaded.colors[i], &b = mesh.colors[i];
+            color = std::max({color, std::fabs(a.r - b.r), std::fabs(a.g - b.g), std::fabs(a.b - b.b)});
+        }
+        CHECK(position <= 0.5f * step * 1.01f);
+        CHECK(normal > 0.999f);
+        CHECK(color <= 0.5f / 255.0f + 1e-6f);
+        CHECK(closedManifold(loaded));
+    }
+    std::filesystem::remove(path);
+}
+
+// ============================================================================
+
+struct TestCase {
+    const char* name;
+    void (*run)();
+};
+
+int main(int argc, char** argv) {
+    const TestCase tests[] = {
+        {"marching_cubes_paths", testMarchingCubesPaths},
+        {"repair_mesh", testRepairMesh},
+        {"mesh_determinism", testMeshDeterminism},
+        {"cpu_primitives", testCpuPrimitives},
+        {"qef_solve", testQEFSolve},
+        {"adaptive_dc", testAdaptiveDC},
+        {"mesh_chunk_cache", testMeshChunkCache},
+        {"normal_convention", testNormalConvention},
+        {"simplify", testSimplify},
+        {"optimize_mesh_for_gpu", testOptimizeMeshForGPU},
+        {"mesh_clusters", testMeshClusters},
+        {"brick_map_mc", testBrickMapMC},
+        {"brick_lods", testBrickLODs},
+        {"format_float", testFormatFloat},
+        {"export_obj", testExportOBJ},
+        {"export_stl_ply", testExportSTLPLY},
+        {"load_glb", testLoadGLB},
+        {"compact_vertex", testCompactVertex},
+        {"glb_quantization", testGLBQuantization},
+    };
+
+    const char* filter = argc > 1 ? argv[1] : nullptr;
+    int run = 0;
+    for (const TestCase& t : tests) {
+        if (filter && !std::strstr(t.name, filter)) continue;
+        int failuresBefore = g_failures;
+        std::cout << "[ RUN  ] " << t.name << std::endl;
+        t.run();
+        std::cout << (g_failures == failuresBefore ? "[  OK  ] " : "[ FAIL ] ") << t.name << std::endl;
+        run++;
+    }
+    std::cout << run << " tests, " << g_checks << " checks, " << g_failures << " failures" << std::endl;
+    return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,94 @@
+// Minimal SDL3 subset for the headless engine tests (see gpu/vulkan/vulkan.h).
+#pragma once
+
+#include <cstdint>
+
+typedef uint8_t Uint8;
+typedef uint16_t Uint16;
+typedef uint32_t Uint32;
+typedef uint64_t Uint64;
+typedef Uint64 SDL_WindowFlags;
+typedef Uint32 SDL_InitFlags;
+typedef Uint32 SDL_Keycode;
+typedef Uint16 SDL_Keymod;
+typedef Uint64 SDL_FingerID;
+typedef struct SDL_Window SDL_Window;
+
+#define SDL_INIT_VIDEO 0x00000020u
+#define SDL_INIT_EVENTS 0x00004000u
+#define SDL_WINDOW_VULKAN 0x0000000010000000ull
+#define SDL_WINDOW_HIGH_PIXEL_DENSITY 0x0000000000002000ull
+
+#define SDL_BUTTON_LEFT 1
+#define SDL_BUTTON_MIDDLE 2
+#define SDL_BUTTON_RIGHT 3
+
+#define SDL_KMOD_SHIFT 0x0003u
+#define SDL_KMOD_GUI 0x0c00u
+
+#define SDLK_BACKSPACE 0x00000008u
+#define SDLK_ESCAPE 0x0000001bu
+#define SDLK_0 0x00000030u
+#define SDLK_1 0x00000031u
+#define SDLK_9 0x00000039u
+#define SDLK_D 0x00000064u
+#define SDLK_E 0x00000065u
+#define SDLK_R 0x00000072u
+#define SDLK_Z 0x0000007au
+#define SDLK_DELETE 0x0000007fu
+#define SDLK_PAGEUP 0x4000004bu
+#define SDLK_PAGEDOWN 0x4000004eu
+#define SDLK_RIGHT 0x4000004fu
+#define SDLK_LEFT 0x40000050u
+
+typedef enum SDL_EventType {
+    SDL_EVENT_QUIT = 0x100,
+    SDL_EVENT_KEY_DOWN = 0x300,
+    SDL_EVENT_KEY_UP,
+    SDL_EVENT_MOUSE_MOTION = 0x400,
+    SDL_EVENT_MOUSE_BUTTON_DOWN,
+    SDL_EVENT_MOUSE_BUTTON_UP,
+    SDL_EVENT_MOUSE_WHEEL,
+    SDL_EVENT_FINGER_DOWN = 0x700,
+    SDL_EVENT_FINGER_UP,
+    SDL_EVENT_FINGER_MOTION,
+} SDL_EventType;
+
+typedef struct SDL_KeyboardEvent {
+    Uint32 type; Uint32 reserved; Uint64 timestamp; Uint32 windowID; Uint32 which;
+    Uint32 scancode; SDL_Keycode key; SDL_Keymod mod; Uint16 raw; bool down; bool repeat;
+} SDL_KeyboardEvent;
+typedef struct SDL_MouseMotionEvent {
+    Uint32 type; Uint32 reserved; Uint64 timestamp; Uint32 windowID; Uint32 which;
+    Uint32 state; float x; float y; float xrel; float yrel;
+} SDL_MouseMotionEvent;
+typedef struct SDL_MouseButtonEvent {
+    Uint32 type; Uint32 reserved; Uint64 timestamp; Uint32 windowID; Uint32 which;
+    Uint8 button; bool down; Uint8 clicks; Uint8 padding; float x; float y;
+} SDL_MouseButtonEvent;
+typedef struct SDL_MouseWheelEvent {
+    Uint32 type; Uint32 reserved; Uint64 timestamp; Uint32 windowID; Uint32 which;
+    float x; float y; int direction; float mouse_x; float mouse_y;
+} SDL_MouseWheelEvent;
+typedef struct SDL_TouchFingerEvent {
+    Uint32 type; Uint32 reserved; Uint64 timestamp; Uint64 touchID; SDL_FingerID fingerID;
+    float x; float y; float dx; float dy; float pressure; Uint32 windowID;
+} SDL_TouchFingerEvent;
+
+typedef union SDL_Event {
+    Uint32 type;
+    SDL_KeyboardEvent key;
+    SDL_MouseMotionEvent motion;
+    SDL_MouseButtonEvent button;
+    SDL_MouseWheelEvent wheel;
+    SDL_TouchFingerEvent tfinger;
+    Uint8 padding[128];
+} SDL_Event;
+
+bool SDL_Init(SDL_InitFlags flags);
+void SDL_Quit(void);
+const char* SDL_GetError(void);
+SDL_Window* SDL_CreateWindow(const char* title, int w, int h, SDL_WindowFlags flags);
+void SDL_DestroyWindow(SDL_Window* window);
+bool SDL_GetWindowSizeInPixels(SDL_Window* window, int* w, int* h);
+bool SDL_PollEvent(SDL_Event* event);
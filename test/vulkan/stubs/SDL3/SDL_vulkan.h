@@ -0,0 +1,9 @@
+// Minimal SDL3 Vulkan subset for the headless engine tests (see gpu/vulkan/vulkan.h).
+#pragma once
+
+#include "SDL.h"
+#include <vulkan/vulkan.h>
+
+char const* const* SDL_Vulkan_GetInstanceExtensions(Uint32* count);
+bool SDL_Vulkan_CreateSurface(SDL_Window* window, VkInstance instance,
+                              const struct VkAllocationCallbacks* allocator, VkSurfaceKHR* surface);
@@ -0,0 +1,189 @@
+// Minimal libshaderc C++ API for the headless engine tests (see ../vulkan/vulkan.h).
+//
+// Same declarations as shaderc.hpp for what sdf_engine.hpp uses, backed by a
+// fake compiler: PreprocessGlsl expands #include "..." lines through the
+// options' includer, and CompileGlslToSpv "compiles" the preprocessed text to
+// a small valid-looking SPIR-V blob (magic + content hash). A source
+// containing "#error" fails. fake::compileCount() counts real compiles, so
+// tests can tell a cache hit from a compile.
+#pragma once
+
+#define SDFX_STUB_SHADERC 1
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+typedef enum {
+    shaderc_vertex_shader,
+    shaderc_fragment_shader,
+    shaderc_compute_shader,
+} shaderc_shader_kind;
+
+typedef enum { shaderc_target_env_vulkan, shaderc_target_env_opengl } shaderc_target_env;
+
+typedef enum {
+    shaderc_env_version_vulkan_1_0 = ((1u << 22)),
+    shaderc_env_version_vulkan_1_1 = ((1u << 22) | (1 << 12)),
+    shaderc_env_version_vulkan_1_2 = ((1u << 22) | (2 << 12)),
+    shaderc_env_version_vulkan_1_3 = ((1u << 22) | (3 << 12)),
+} shaderc_env_version;
+
+typedef enum {
+    shaderc_optimization_level_zero,
+    shaderc_optimization_level_size,
+    shaderc_optimization_level_performance,
+} shaderc_optimization_level;
+
+typedef enum {
+    shaderc_compilation_status_success = 0,
+    shaderc_compilation_status_invalid_stage = 1,
+    shaderc_compilation_status_compilation_error = 2,
+    shaderc_compilation_status_internal_error = 3,
+} shaderc_compilation_status;
+
+typedef enum { shaderc_include_type_relative, shaderc_include_type_standard } shaderc_include_type;
+
+typedef struct shaderc_include_result {
+    const char* source_name;
+    size_t source_name_length;
+    const char* content;
+    size_t content_length;
+    void* user_data;
+} shaderc_include_result;
+
+inline void shaderc_get_spv_version(unsigned int* version, unsigned int* revision) {
+    *version = 0x10600;
+    *revision = 1;
+}
+
+namespace shaderc {
+
+namespace fake {
+inline std::atomic<int>& compileCount() {
+    static std::atomic<int> count{0};
+    return count;
+}
+}  // namespace fake
+
+template <typename OutputElementType>
+class CompilationResult {
+public:
+    typedef OutputElementType element_type;
+    typedef const OutputElementType* const_iterator;
+
+    shaderc_compilation_status GetCompilationStatus() const { return status_; }
+    const std::string& GetErrorMessage() const { return error_; }
+    const_iterator cbegin() const { return data_.data(); }
+    const_iterator cend() const { return data_.data() + data_.size(); }
+    const_iterator begin() const { return cbegin(); }
+    const_iterator end() const { return cend(); }
+
+    shaderc_compilation_status status_ = shaderc_compilation_status_success;
+    std::string error_;
+    std::vector<OutputElementType> data_;
+};
+
+typedef CompilationResult<uint32_t> SpvCompilationResult;
+typedef CompilationResult<char> PreprocessedSourceCompilationResult;
+
+class CompileOptions {
+public:
+    class IncluderInterface {
+    public:
+        virtual shaderc_include_result* GetInclude(const char* requested_source, shaderc_include_type type,
+                                                   const char* requesting_source, size_t include_depth) = 0;
+        virtual void ReleaseInclude(shaderc_include_result* data) = 0;
+        virtual ~IncluderInterface() = default;
+    };
+
+    void SetTargetEnvironment(shaderc_target_env target, uint32_t version) {
+        target_ = target;
+        version_ = version;
+    }
+    void SetOptimizationLevel(shaderc_optimization_level level) { level_ = level; }
+    void SetIncluder(std::unique_ptr<IncluderInterface>&& includer) { includer_ = std::move(includer); }
+
+    shaderc_target_env target_ = shaderc_target_env_vulkan;
+    uint32_t version_ = shaderc_env_version_vulkan_1_0;
+    shaderc_optimization_level level_ = shaderc_optimization_level_zero;
+    std::shared_ptr<IncluderInterface> includer_;
+};
+
+class Compiler {
+public:
+    PreprocessedSourceCompilationResult PreprocessGlsl(const std::string& source, shaderc_shader_kind,
+                                                       const char* input_file_name,
+                                                       const CompileOptions& options) const {
+        PreprocessedSourceCompilationResult result;
+        std::string text;
+        if (!expand(source, input_file_name, options, 0, text, result.error_)) {
+            result.status_ = shaderc_compilation_status_compilation_error;
+            return result;
+        }
+        result.data_.assign(text.begin(), text.end());
+        return result;
+    }
+
+    SpvCompilationResult CompileGlslToSpv(const std::string& source, shaderc_shader_kind kind,
+                                          const char* input_file_name, const CompileOptions& options) const {
+        SpvCompilationResult result;
+        fake::compileCount()++;
+        auto pre = PreprocessGlsl(source, kind, input_file_name, options);
+        if (pre.GetCompilationStatus() != shaderc_compilation_status_success) {
+            result.status_ = pre.status_;
+            result.error_ = pre.error_;
+            return result;
+        }
+        std::string text(pre.cbegin(), pre.cend());
+        if (text.find("#error") != std::string::npos) {
+            result.status_ = shaderc_compilation_status_compilation_error;
+            result.error_ = std::string(input_file_name) + ": error: #error directive";
+            return result;
+        }
+        uint64_t h = 0xcbf29ce484222325ull ^ options.level_ ^ (uint64_t(options.version_) << 8);
+        for (unsigned char c : text) h = (h ^ c) * 0x100000001b3ull;
+        result.data_ = {0x07230203u, 0x00010500u, 0u, 8u, 0u, uint32_t(h), uint32_t(h >> 32)};
+        return result;
+    }
+
+private:
+    static bool expand(const std::string& source, const char* name, const CompileOptions& options,
+                       size_t depth, std::string& out, std::string& error) {
+        std::istringstream in(source);
+        std::string line;
+        while (std::getline(in, line)) {
+            size_t p = line.find("#include");
+            size_t q0 = line.find('"');
+            size_t q1 = q0 == std::string::npos ? q0 : line.find('"', q0 + 1);
+            if (p == std::string::npos || q1 == std::string::npos) {
+                out += line;
+                out += '\n';
+                continue;
+            }
+            if (!options.includer_ || depth > 16) {
+                error = std::string(name) + ": error: cannot resolve include";
+                return false;
+            }
+            std::string requested = line.substr(q0 + 1, q1 - q0 - 1);
+            shaderc_include_result* inc =
+                options.includer_->GetInclude(requested.c_str(), shaderc_include_type_relative, name, depth + 1);
+            bool ok = inc->source_name_length > 0;
+            std::string content(inc->content, inc->content_length);
+            std::string incName(inc->source_name, inc->source_name_length);
+            options.includer_->ReleaseInclude(inc);
+            if (!ok) {
+                error = std::string(name) + ": error: " + content;
+                return false;
+            }
+            if (!expand(content, incName.c_str(), options, depth + 1, out, error)) return false;
+        }
+        return true;
+    }
+};
+
+}  // namespace shaderc
@@ -0,0 +1,132 @@
+// Fake Vulkan driver for the headless engine tests (see vulkan/vulkan.h).
+//
+// Defines the entry points the async shader compile path calls
+// (build_compute_pipeline, destroy_compute_pipeline, shutdown_shader_compiler)
+// on top of the stub declarations. Every create hands out a distinct dummy
+// handle and records it as live, so tests can check that each module, layout
+// and pipeline is destroyed exactly once. Pipeline creation can be made to
+// fail, or to block until the test releases it. Include in exactly one
+// translation unit, after vulkan/vulkan.h.
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <set>
+
+namespace vkfake {
+
+struct Driver {
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::set<uintptr_t> live;
+    uintptr_t nextHandle = 0x1000;
+    int badDestroys = 0;           // Handles destroyed twice or never created
+    int pipelinesCreated = 0;
+    int pipelinesBlocked = 0;      // Creates waiting in hold
+    bool failPipelines = false;    // vkCreateComputePipelines returns an error
+    bool holdPipelines = false;    // vkCreateComputePipelines blocks until released
+};
+
+inline Driver& driver() {
+    static Driver d;
+    return d;
+}
+
+template <typename Handle>
+inline Handle create() {
+    auto& d = driver();
+    std::lock_guard<std::mutex> lock(d.mutex);
+    uintptr_t h = d.nextHandle++;
+    d.live.insert(h);
+    return reinterpret_cast<Handle>(h);
+}
+
+template <typename Handle>
+inline void destroy(Handle handle) {
+    if (handle == VK_NULL_HANDLE) return;
+    auto& d = driver();
+    std::lock_guard<std::mutex> lock(d.mutex);
+    if (d.live.erase(reinterpret_cast<uintptr_t>(handle)) == 0) d.badDestroys++;
+}
+
+template <typename Handle>
+inline bool isLive(Handle handle) {
+    auto& d = driver();
+    std::lock_guard<std::mutex> lock(d.mutex);
+    return d.live.count(reinterpret_cast<uintptr_t>(handle)) != 0;
+}
+
+inline size_t liveObjects() {
+    auto& d = driver();
+    std::lock_guard<std::mutex> lock(d.mutex);
+    return d.live.size();
+}
+
+inline void setFailPipelines(bool fail) {
+    auto& d = driver();
+    std::lock_guard<std::mutex> lock(d.mutex);
+    d.failPipelines = fail;
+}
+
+// Hold pipeline creation (true), or let held and future creates through
+inline void setHoldPipelines(bool hold) {
+    auto& d = driver();
+    {
+        std::lock_guard<std::mutex> lock(d.mutex);
+        d.holdPipelines = hold;
+    }
+    d.changed.notify_all();
+}
+
+// Block until a pipeline create is waiting in hold
+inline void waitForHeldPipeline() {
+    auto& d = driver();
+    std::unique_lock<std::mutex> lock(d.mutex);
+    d.changed.wait(lock, [&d] { return d.pipelinesBlocked > 0; });
+}
+
+}  // namespace vkfake
+
+VkResult vkCreateShaderModule(VkDevice, const VkShaderModuleCreateInfo*, VkAllocPtr, VkShaderModule* module) {
+    *module = vkfake::create<VkShaderModule>();
+    return VK_SUCCESS;
+}
+
+void vkDestroyShaderModule(VkDevice, VkShaderModule module, VkAllocPtr) {
+    vkfake::destroy(module);
+}
+
+VkResult vkCreatePipelineLayout(VkDevice, const VkPipelineLayoutCreateInfo*, VkAllocPtr, VkPipelineLayout* layout) {
+    *layout = vkfake::create<VkPipelineLayout>();
+    return VK_SUCCESS;
+}
+
+void vkDestroyPipelineLayout(VkDevice, VkPipelineLayout layout, VkAllocPtr) {
+    vkfake::destroy(layout);
+}
+
+VkResult vkCreateComputePipelines(VkDevice, VkPipelineCache, uint32_t count, const VkComputePipelineCreateInfo*,
+                                  VkAllocPtr, VkPipeline* pipelines) {
+    auto& d = vkfake::driver();
+    {
+        std::unique_lock<std::mutex> lock(d.mutex);
+        d.pipelinesBlocked++;
+        d.changed.notify_all();
+        d.changed.wait(lock, [&d] { return !d.holdPipelines; });
+        d.pipelinesBlocked--;
+        if (d.failPipelines) return VK_ERROR_INITIALIZATION_FAILED;
+        d.pipelinesCreated += count;
+    }
+    for (uint32_t i = 0; i < count; i++) pipelines[i] = vkfake::create<VkPipeline>();
+    return VK_SUCCESS;
+}
+
+void vkDestroyPipeline(VkDevice, VkPipeline pipeline, VkAllocPtr) {
+    vkfake::destroy(pipeline);
+}
+
+VkResult vkDeviceWaitIdle(VkDevice) {
+    return VK_SUCCESS;
+}
@@ -0,0 +1,27 @@
+// Minimal Dear ImGui subset for the headless engine tests (see gpu/vulkan/vulkan.h).
+#pragma once
+
+#define IMGUI_CHECKVERSION() ((void)0)
+
+typedef int ImGuiConfigFlags;
+enum ImGuiConfigFlags_ { ImGuiConfigFlags_None = 0, ImGuiConfigFlags_NavEnableKeyboard = 1 << 0 };
+
+struct ImDrawData;
+struct ImGuiContext;
+struct ImFontAtlas;
+
+struct ImGuiIO {
+    ImGuiConfigFlags ConfigFlags = 0;
+    bool WantCaptureMouse = false;
+    bool WantCaptureKeyboard = false;
+};
+
+namespace ImGui {
+ImGuiContext* CreateContext(ImFontAtlas* shared_font_atlas = nullptr);
+void DestroyContext(ImGuiContext* ctx = nullptr);
+ImGuiIO& GetIO();
+void StyleColorsDark(void* dst = nullptr);
+void NewFrame();
+void Render();
+ImDrawData* GetDrawData();
+}  // namespace ImGui
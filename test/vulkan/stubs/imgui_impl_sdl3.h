@@ -0,0 +1,12 @@
+// Minimal ImGui SDL3 backend subset for the headless engine tests.
+#pragma once
+
+#include "imgui.h"
+
+struct SDL_Window;
+union SDL_Event;
+
+bool ImGui_ImplSDL3_InitForVulkan(SDL_Window* window);
+void ImGui_ImplSDL3_Shutdown();
+void ImGui_ImplSDL3_NewFrame();
+bool ImGui_ImplSDL3_ProcessEvent(const SDL_Event* event);
@@ -0,0 +1,31 @@
+// Minimal ImGui Vulkan backend subset for the headless engine tests.
+#pragma once
+
+#include "imgui.h"
+#include <vulkan/vulkan.h>
+
+struct ImGui_ImplVulkan_PipelineInfo {
+    VkRenderPass RenderPass = VK_NULL_HANDLE;
+    uint32_t Subpass = 0;
+    VkSampleCountFlagBits MSAASamples = VK_SAMPLE_COUNT_1_BIT;
+};
+
+struct ImGui_ImplVulkan_InitInfo {
+    uint32_t ApiVersion = 0;
+    VkInstance Instance = VK_NULL_HANDLE;
+    VkPhysicalDevice PhysicalDevice = VK_NULL_HANDLE;
+    VkDevice Device = VK_NULL_HANDLE;
+    uint32_t QueueFamily = 0;
+    VkQueue Queue = VK_NULL_HANDLE;
+    VkDescriptorPool DescriptorPool = VK_NULL_HANDLE;
+    uint32_t MinImageCount = 0;
+    uint32_t ImageCount = 0;
+    VkPipelineCache PipelineCache = VK_NULL_HANDLE;
+    ImGui_ImplVulkan_PipelineInfo PipelineInfoMain;
+};
+
+bool ImGui_ImplVulkan_Init(ImGui_ImplVulkan_InitInfo* info);
+void ImGui_ImplVulkan_Shutdown();
+void ImGui_ImplVulkan_NewFrame();
+void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer command_buffer,
+                                     VkPipeline pipeline = VK_NULL_HANDLE);
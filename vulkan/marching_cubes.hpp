@@ -2,42 +2,72 @@
 // Works with GPU-sampled distance fields
 //
 // Features:
-//   - Parallel processing (uses std::thread)
+//   - Parallel processing (persistent work-stealing pool over 16³ cell tiles)
+//   - SIMD cell classification (AVX2/SSE/NEON sign masks, only active cells polygonised)
+//   - Optional vertex welding (one shared vertex per edge crossing)
+//   - Slab streaming (generateMeshStreaming, O(res²) memory)
+//   - Incremental re-meshing of edited blocks (MeshChunkCache)
+//   - Narrow-band brick map grids (BrickMap, buildBrickMap, generateMeshBricks)
+//   - Dual contouring with batched truncated-SVD QEF solves (solveQEFs)
 //   - Optional vertex colors (from color sampling)
 //   - Optional UV coordinates (triplanar mapping)
-//   - Automatic normal computation
+//   - Automatic normal computation (or SDF-gradient normals during MC, gridNormals)
+//   - Parallel quadric-error simplification (simplifyMesh)
+//   - Spatial-hash vertex welding + manifold/watertight check with seam stats (repairMesh)
+//   - LOD chains from one grid by min-pooling (generateMeshLODs, multi-LOD exportGLB)
+//   - Tipsify vertex cache / overdraw / fetch optimization (optimizeMeshForGPU)
+//   - Morton-sorted triangle clusters with culling bounds (buildMeshClusters)
+//   - Buffered parallel OBJ writer, binary STL/PLY (exportSTL, exportPLY)
+//   - Zero-copy GLB writer (JSON chunk + writev straight from the Mesh arrays)
+//   - Quantized vertices: 16-byte CompactVertex (preview buffers), KHR_mesh_quantization GLB
+//   - Memory-mapped GLB reader with typed views over the BIN chunk (GLBFile)
 //
 // Usage:
 //   std::vector<float> distances = sample_sdf_from_gpu(...);
 //   auto mesh = mc::generateMesh(distances, resolution, bounds_min, bounds_max);
+//   auto welded = mc::generateMesh(distances, resolution, bounds_min, bounds_max, 0.0f, true);
+//   mc::MeshArena arena;  // reuse across regenerations: no per-call allocation once warm
+//   auto preview = mc::generateMesh(distances, resolution, bounds_min, bounds_max, 0.0f, true, &arena);
 //   mc::exportOBJ("output.obj", mesh);  // Basic export
 //   mc::exportOBJ("output.obj", mesh, true, true);  // With colors and UVs
+//   mc::exportPLY("output.ply", mesh, true);  // Binary, with colors
+//   mc::exportGLB("output.glb", mesh, true, true);  // Quantized attributes
 
 #pragma once
 
 #include <vector>
+#include <string>
 #include <array>
 #include <fstream>
 #include <iostream>
 #include <cmath>
 #include <cfloat>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <climits>
 #include <locale>
 #include <thread>
 #include <mutex>
+#include <condition_variable>
 #include <atomic>
+#include <memory>
+#include <unordered_map>
+#include <type_traits>
+#include <algorithm>
 #include <chrono>
-
-// tinygltf for GLB export with vertex colors
-// TINYGLTF_IMPLEMENTATION is defined when:
-// - SDF_ENGINE_IMPLEMENTATION is set (AOT impl files like tinygltf_impl.cpp, sdf_engine_impl.cpp)
-// - We're in JIT mode (default - no SDF_AOT_BUILD flag) BUT not iOS JIT (uses sdf_engine_impl.cpp)
-// For AOT builds, compile with -DSDF_AOT_BUILD to prevent duplicate symbols
-#if defined(SDF_ENGINE_IMPLEMENTATION) || (!defined(SDF_AOT_BUILD) && !defined(JANK_IOS_JIT))
-#define TINYGLTF_IMPLEMENTATION
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
 #endif
-#define TINYGLTF_NO_STB_IMAGE
-#define TINYGLTF_NO_STB_IMAGE_WRITE
-#include "tinygltf/tiny_gltf.h"
 
 namespace mc {
 
@@ -433,629 +463,4468 @@ inline Vec2 triplanarUV(const Vec3& pos, const Vec3& normal, float scale = 10.0f
 // Thread-local mesh buffer for parallel processing
 struct ThreadMesh {
     std::vector<Vec3> vertices;
+    std::vector<Vec3> normals;  // Only filled when generating grid normals
     std::vector<uint32_t> indices;
+
+    void clear() { vertices.clear(); normals.clear(); indices.clear(); }
 };
 
-// Generate mesh from a 3D grid of SDF values (PARALLEL VERSION)
-// distances: flattened 3D array of size res*res*res (x varies fastest)
-// res: grid resolution in each dimension
-// bounds_min, bounds_max: world-space bounds
-inline Mesh generateMesh(
-    const std::vector<float>& distances,
-    int res,
-    Vec3 bounds_min,
-    Vec3 bounds_max,
-    float isolevel = 0.0f
-) {
-    Vec3 cell_size = {
-        (bounds_max.x - bounds_min.x) / (res - 1),
-        (bounds_max.y - bounds_min.y) / (res - 1),
-        (bounds_max.z - bounds_min.z) / (res - 1)
-    };
+// Persistent work-stealing thread pool shared by all mesh generators
+// parallelFor(count, fn) calls fn(item, worker) for every item in [0, count).
+// Each worker starts on its own contiguous block of items and, once that runs
+// dry, steals the upper half of the fullest remaining block. Surface-sparse
+// grids (most tiles empty, a few expensive) therefore keep every core busy
+// instead of waiting on whichever thread got the Z range with the surface.
+// The calling thread participates as worker 0; nested calls run serially.
+class ThreadPool {
+public:
+    static ThreadPool& instance() {
+        static ThreadPool pool;
+        return pool;
+    }
 
-    auto idx = [res](int x, int y, int z) { return x + y * res + z * res * res; };
+    // Number of workers including the calling thread (size of per-worker scratch)
+    unsigned size() const { return (unsigned)workers.size() + 1; }
 
-    // Determine number of threads
-    unsigned int numThreads = std::thread::hardware_concurrency();
-    if (numThreads == 0) numThreads = 4;  // Fallback
-    numThreads = std::min(numThreads, (unsigned int)(res - 1));
-
-    // Per-thread mesh buffers
-    std::vector<ThreadMesh> threadMeshes(numThreads);
-
-    // Parallel processing - each thread handles a range of Z slices
-    std::vector<std::thread> threads;
-    int zPerThread = (res - 1 + numThreads - 1) / numThreads;
-
-    for (unsigned int t = 0; t < numThreads; t++) {
-        int zStart = t * zPerThread;
-        int zEnd = std::min(zStart + zPerThread, res - 1);
-
-        threads.emplace_back([&, t, zStart, zEnd]() {
-            ThreadMesh& tm = threadMeshes[t];
-            Vec3 vertList[12];
-
-            for (int z = zStart; z < zEnd; z++) {
-                for (int y = 0; y < res - 1; y++) {
-                    for (int x = 0; x < res - 1; x++) {
-                        // Get 8 corner values
-                        float v[8] = {
-                            distances[idx(x,   y,   z)],
-                            distances[idx(x+1, y,   z)],
-                            distances[idx(x+1, y+1, z)],
-                            distances[idx(x,   y+1, z)],
-                            distances[idx(x,   y,   z+1)],
-                            distances[idx(x+1, y,   z+1)],
-                            distances[idx(x+1, y+1, z+1)],
-                            distances[idx(x,   y+1, z+1)]
-                        };
+    // Run later parallelFor calls on at most n workers (1 = serial on the
+    // calling thread, 0 = all). Worker ids stay below size() either way.
+    void setWorkerLimit(unsigned n) { workerLimit = n; }
 
-                        // Get 8 corner positions
-                        Vec3 p[8] = {
-                            {bounds_min.x + x * cell_size.x,     bounds_min.y + y * cell_size.y,     bounds_min.z + z * cell_size.z},
-                            {bounds_min.x + (x+1) * cell_size.x, bounds_min.y + y * cell_size.y,     bounds_min.z + z * cell_size.z},
-                            {bounds_min.x + (x+1) * cell_size.x, bounds_min.y + (y+1) * cell_size.y, bounds_min.z + z * cell_size.z},
-                            {bounds_min.x + x * cell_size.x,     bounds_min.y + (y+1) * cell_size.y, bounds_min.z + z * cell_size.z},
-                            {bounds_min.x + x * cell_size.x,     bounds_min.y + y * cell_size.y,     bounds_min.z + (z+1) * cell_size.z},
-                            {bounds_min.x + (x+1) * cell_size.x, bounds_min.y + y * cell_size.y,     bounds_min.z + (z+1) * cell_size.z},
-                            {bounds_min.x + (x+1) * cell_size.x, bounds_min.y + (y+1) * cell_size.y, bounds_min.z + (z+1) * cell_size.z},
-                            {bounds_min.x + x * cell_size.x,     bounds_min.y + (y+1) * cell_size.y, bounds_min.z + (z+1) * cell_size.z}
-                        };
+    template<typename Fn>
+    void parallelFor(size_t count, Fn&& fn) {
+        if (count == 0) return;
+        unsigned limit = workerLimit;
+        if (workers.empty() || count == 1 || limit == 1 || currentWorker() >= 0) {
+            for (size_t i = 0; i < count; i++) fn(i, 0u);
+            return;
+        }
 
-                        // Determine cube index
-                        int cubeIndex = 0;
-                        if (v[0] < isolevel) cubeIndex |= 1;
-                        if (v[1] < isolevel) cubeIndex |= 2;
-                        if (v[2] < isolevel) cubeIndex |= 4;
-                        if (v[3] < isolevel) cubeIndex |= 8;
-                        if (v[4] < isolevel) cubeIndex |= 16;
-                        if (v[5] < isolevel) cubeIndex |= 32;
-                        if (v[6] < isolevel) cubeIndex |= 64;
-                        if (v[7] < isolevel) cubeIndex |= 128;
-
-                        // Skip if completely inside or outside
-                        if (edgeTable[cubeIndex] == 0) continue;
-
-                        // Interpolate vertices on edges
-                        if (edgeTable[cubeIndex] & 1)    vertList[0]  = vertexInterp(isolevel, p[0], p[1], v[0], v[1]);
-                        if (edgeTable[cubeIndex] & 2)    vertList[1]  = vertexInterp(isolevel, p[1], p[2], v[1], v[2]);
-                        if (edgeTable[cubeIndex] & 4)    vertList[2]  = vertexInterp(isolevel, p[2], p[3], v[2], v[3]);
-                        if (edgeTable[cubeIndex] & 8)    vertList[3]  = vertexInterp(isolevel, p[3], p[0], v[3], v[0]);
-                        if (edgeTable[cubeIndex] & 16)   vertList[4]  = vertexInterp(isolevel, p[4], p[5], v[4], v[5]);
-                        if (edgeTable[cubeIndex] & 32)   vertList[5]  = vertexInterp(isolevel, p[5], p[6], v[5], v[6]);
-                        if (edgeTable[cubeIndex] & 64)   vertList[6]  = vertexInterp(isolevel, p[6], p[7], v[6], v[7]);
-                        if (edgeTable[cubeIndex] & 128)  vertList[7]  = vertexInterp(isolevel, p[7], p[4], v[7], v[4]);
-                        if (edgeTable[cubeIndex] & 256)  vertList[8]  = vertexInterp(isolevel, p[0], p[4], v[0], v[4]);
-                        if (edgeTable[cubeIndex] & 512)  vertList[9]  = vertexInterp(isolevel, p[1], p[5], v[1], v[5]);
-                        if (edgeTable[cubeIndex] & 1024) vertList[10] = vertexInterp(isolevel, p[2], p[6], v[2], v[6]);
-                        if (edgeTable[cubeIndex] & 2048) vertList[11] = vertexInterp(isolevel, p[3], p[7], v[3], v[7]);
-
-                        // Add triangles
-                        for (int i = 0; triTable[cubeIndex][i] != -1; i += 3) {
-                            uint32_t baseIdx = (uint32_t)tm.vertices.size();
-                            tm.vertices.push_back(vertList[triTable[cubeIndex][i]]);
-                            tm.vertices.push_back(vertList[triTable[cubeIndex][i+1]]);
-                            tm.vertices.push_back(vertList[triTable[cubeIndex][i+2]]);
-                            tm.indices.push_back(baseIdx);
-                            tm.indices.push_back(baseIdx + 1);
-                            tm.indices.push_back(baseIdx + 2);
-                        }
-                    }
-                }
+        std::lock_guard<std::mutex> dispatch(dispatchMutex);
+        unsigned n = limit ? std::min(limit, size()) : size();
+        for (unsigned w = 0; w < size(); w++) {
+            std::lock_guard<std::mutex> lock(ranges[w].m);
+            ranges[w].begin = w < n ? count * w / n : 0;
+            ranges[w].end = w < n ? count * (w + 1) / n : 0;
+        }
+
+        jobCtx = &fn;
+        jobFn = [](void* ctx, size_t item, unsigned worker) {
+            (*static_cast<std::remove_reference_t<Fn>*>(ctx))(item, worker);
+        };
+        {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            busyWorkers = (unsigned)workers.size();
+            activeWorkers = n;
+            generation++;
+        }
+        wake.notify_all();
+
+        currentWorker() = 0;
+        runJob(0);
+        currentWorker() = -1;
+
+        std::unique_lock<std::mutex> lock(stateMutex);
+        done.wait(lock, [this] { return busyWorkers == 0; });
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& t : workers) t.join();
+    }
+
+private:
+    struct alignas(64) Range {
+        std::mutex m;
+        size_t begin = 0, end = 0;
+    };
+
+    std::vector<std::thread> workers;
+    std::unique_ptr<Range[]> ranges;
+    std::mutex dispatchMutex;               // one parallelFor at a time
+    std::mutex stateMutex;
+    std::condition_variable wake, done;
+    uint64_t generation = 0;
+    unsigned busyWorkers = 0;
+    unsigned activeWorkers = 0;             // Workers taking part in the current job
+    std::atomic<unsigned> workerLimit{0};
+    bool stopping = false;
+    void* jobCtx = nullptr;
+    void (*jobFn)(void*, size_t, unsigned) = nullptr;
+
+    ThreadPool() {
+        unsigned n = std::thread::hardware_concurrency();
+        if (n == 0) n = 4;  // Fallback
+        ranges.reset(new Range[n]);
+        for (unsigned w = 1; w < n; w++) {
+            workers.emplace_back([this, w]() { workerLoop(w); });
+        }
+    }
+
+    static int& currentWorker() {
+        thread_local int worker = -1;
+        return worker;
+    }
+
+    void workerLoop(unsigned w) {
+        currentWorker() = (int)w;
+        uint64_t seen = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(stateMutex);
+                wake.wait(lock, [&] { return stopping || generation != seen; });
+                if (stopping) return;
+                seen = generation;
             }
-        });
+            runJob(w);
+            {
+                std::lock_guard<std::mutex> lock(stateMutex);
+                if (--busyWorkers == 0) done.notify_one();
+            }
+        }
     }
 
-    // Wait for all threads
-    for (auto& t : threads) {
-        t.join();
+    void runJob(unsigned w) {
+        if (w >= activeWorkers) return;
+        size_t item;
+        while (popOwn(w, item) || steal(w, item)) {
+            jobFn(jobCtx, item, w);
+        }
     }
 
-    // Merge all thread meshes
-    Mesh mesh;
-    size_t totalVerts = 0, totalIndices = 0;
-    for (const auto& tm : threadMeshes) {
-        totalVerts += tm.vertices.size();
-        totalIndices += tm.indices.size();
+    bool popOwn(unsigned w, size_t& item) {
+        std::lock_guard<std::mutex> lock(ranges[w].m);
+        if (ranges[w].begin >= ranges[w].end) return false;
+        item = ranges[w].begin++;
+        return true;
     }
-    mesh.vertices.reserve(totalVerts);
-    mesh.indices.reserve(totalIndices);
 
-    uint32_t indexOffset = 0;
-    for (const auto& tm : threadMeshes) {
-        mesh.vertices.insert(mesh.vertices.end(), tm.vertices.begin(), tm.vertices.end());
-        for (uint32_t idx : tm.indices) {
-            mesh.indices.push_back(idx + indexOffset);
+    bool steal(unsigned w, size_t& item) {
+        unsigned n = activeWorkers;
+        for (;;) {
+            unsigned victim = w;
+            size_t most = 0;
+            for (unsigned v = 0; v < n; v++) {
+                if (v == w) continue;
+                std::lock_guard<std::mutex> lock(ranges[v].m);
+                size_t left = ranges[v].end - ranges[v].begin;
+                if (left > most) { most = left; victim = v; }
+            }
+            if (most == 0) return false;
+
+            size_t from, to;
+            {
+                std::lock_guard<std::mutex> lock(ranges[victim].m);
+                size_t left = ranges[victim].end - ranges[victim].begin;
+                if (left == 0) continue;  // drained meanwhile, rescan
+                to = ranges[victim].end;
+                from = to - (left + 1) / 2;
+                ranges[victim].end = from;
+            }
+            std::lock_guard<std::mutex> lock(ranges[w].m);
+            ranges[w].begin = from + 1;
+            ranges[w].end = to;
+            item = from;
+            return true;
         }
-        indexOffset += (uint32_t)tm.vertices.size();
     }
+};
 
-    return mesh;
-}
+// Edge length (in cells) of the cubic work tiles handed to the thread pool.
+// 16³ = 4096 cells amortises scheduling; tiles without surface cost a few µs.
+constexpr int MC_TILE_SIZE = 16;
 
-// Compute normals from triangle geometry
-inline void computeNormals(Mesh& mesh) {
-    mesh.normals.resize(mesh.vertices.size(), Vec3(0, 0, 0));
+// Cubic tiles of MC_TILE_SIZE³ cells covering the (res-1)³ cell grid,
+// numbered x fastest like the grid itself
+struct CellTiles {
+    int cellRes;
+    int perAxis;
 
-    // Compute face normals and accumulate at vertices
-    for (size_t i = 0; i < mesh.indices.size(); i += 3) {
-        uint32_t i0 = mesh.indices[i];
-        uint32_t i1 = mesh.indices[i+1];
-        uint32_t i2 = mesh.indices[i+2];
+    explicit CellTiles(int res)
+        : cellRes(res - 1), perAxis((res - 1 + MC_TILE_SIZE - 1) / MC_TILE_SIZE) {}
 
-        Vec3 v0 = mesh.vertices[i0];
-        Vec3 v1 = mesh.vertices[i1];
-        Vec3 v2 = mesh.vertices[i2];
+    size_t count() const { return (size_t)perAxis * perAxis * perAxis; }
 
-        Vec3 e1 = v1 - v0;
-        Vec3 e2 = v2 - v0;
-        Vec3 normal = e1.cross(e2);
+    // Global coordinates of cell `local` (x + y*T + z*T², T = MC_TILE_SIZE) in tile t
+    void cellCoords(size_t t, uint32_t local, int& x, int& y, int& z) const {
+        x = (int)(t % perAxis) * MC_TILE_SIZE + (int)(local % MC_TILE_SIZE);
+        y = (int)((t / perAxis) % perAxis) * MC_TILE_SIZE + (int)((local / MC_TILE_SIZE) % MC_TILE_SIZE);
+        z = (int)(t / ((size_t)perAxis * perAxis)) * MC_TILE_SIZE + (int)(local / (MC_TILE_SIZE * MC_TILE_SIZE));
+    }
 
-        mesh.normals[i0] = mesh.normals[i0] + normal;
-        mesh.normals[i1] = mesh.normals[i1] + normal;
-        mesh.normals[i2] = mesh.normals[i2] + normal;
+    // Tile coordinates and cell range [lo, hi) of tile t
+    void bounds(size_t t, int tc[3], int lo[3], int hi[3]) const {
+        tc[0] = (int)(t % perAxis);
+        tc[1] = (int)((t / perAxis) % perAxis);
+        tc[2] = (int)(t / ((size_t)perAxis * perAxis));
+        for (int a = 0; a < 3; a++) {
+            lo[a] = tc[a] * MC_TILE_SIZE;
+            hi[a] = std::min(lo[a] + MC_TILE_SIZE, cellRes);
+        }
     }
+};
 
-    // Normalize
-    for (auto& n : mesh.normals) {
-        n = n.normalized();
+// ============================================================================
+// SIMD cell classification
+// ============================================================================
+// Instead of 8 compares + branches per cell, sign bits are computed for whole
+// grid rows at once (bit i = row[i] < isolevel). A cell is active when its 8
+// corners, taken from 4 neighbouring rows, are neither all set nor all clear,
+// which is a handful of word-wide AND/OR/shift ops per 64 cells. Only active
+// cells (~5% in typical scenes) reach the interpolation code.
+
+// Set bit i of bits[] (64-bit words) when row[i] < isolevel, for i in [0, n)
+inline void signBitsRow(const float* row, int n, float isolevel, uint64_t* bits) {
+    for (int w = 0; w < (n + 63) / 64; w++) bits[w] = 0;
+    int i = 0;
+#if defined(__AVX2__)
+    const __m256 iso = _mm256_set1_ps(isolevel);
+    for (; i + 8 <= n; i += 8) {
+        uint64_t m = (uint32_t)_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(row + i), iso, _CMP_LT_OQ));
+        bits[i >> 6] |= m << (i & 63);
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    const __m128 iso = _mm_set1_ps(isolevel);
+    for (; i + 4 <= n; i += 4) {
+        uint64_t m = (uint32_t)_mm_movemask_ps(_mm_cmplt_ps(_mm_loadu_ps(row + i), iso));
+        bits[i >> 6] |= m << (i & 63);
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    const float32x4_t iso = vdupq_n_f32(isolevel);
+    const uint32x4_t weights = {1, 2, 4, 8};
+    for (; i + 4 <= n; i += 4) {
+        uint32x4_t lt = vcltq_f32(vld1q_f32(row + i), iso);
+        uint64_t m = vaddvq_u32(vandq_u32(lt, weights));
+        bits[i >> 6] |= m << (i & 63);
+    }
+#endif
+    for (; i < n; i++) {
+        if (row[i] < isolevel) bits[i >> 6] |= 1ull << (i & 63);
     }
 }
 
-// Compute triplanar UVs from positions and normals
-inline void computeUVs(Mesh& mesh, float scale = 10.0f) {
-    if (!mesh.hasNormals()) {
-        computeNormals(mesh);
+// Active-cell bits for a row of `cells` cells whose corners lie on the sign rows
+// r0 = (y, z), r1 = (y+1, z), r2 = (y, z+1), r3 = (y+1, z+1)
+inline void activeCellBits(const uint64_t* r0, const uint64_t* r1,
+                           const uint64_t* r2, const uint64_t* r3,
+                           int cells, uint64_t* out) {
+    const uint64_t* rows[4] = {r0, r1, r2, r3};
+    int words = (cells + 63) / 64;
+    int rowWords = (cells + 64) / 64;
+    for (int w = 0; w < words; w++) {
+        uint64_t anyIn = 0, allIn = ~0ull;
+        for (const uint64_t* r : rows) {
+            uint64_t next = (w + 1 < rowWords) ? r[w + 1] : 0;
+            uint64_t lo = r[w];
+            uint64_t hi = (lo >> 1) | (next << 63);  // bit i = corner x+1 of cell i
+            anyIn |= lo | hi;
+            allIn &= lo & hi;
+        }
+        uint64_t m = anyIn & ~allIn;
+        if (w == words - 1 && (cells & 63)) m &= (1ull << (cells & 63)) - 1;
+        out[w] = m;
     }
+}
 
-    mesh.uvs.resize(mesh.vertices.size());
-    for (size_t i = 0; i < mesh.vertices.size(); i++) {
-        mesh.uvs[i] = triplanarUV(mesh.vertices[i], mesh.normals[i], scale);
-    }
+// MC cube index of cell x from the same four sign rows (corner order as in triTable)
+inline int cubeIndexFromBits(const uint64_t* r0, const uint64_t* r1,
+                             const uint64_t* r2, const uint64_t* r3, int x) {
+    auto bit = [](const uint64_t* r, int i) { return (int)((r[i >> 6] >> (i & 63)) & 1); };
+    return bit(r0, x)      | bit(r0, x+1) << 1 | bit(r1, x+1) << 2 | bit(r1, x) << 3
+         | bit(r2, x) << 4 | bit(r2, x+1) << 5 | bit(r3, x+1) << 6 | bit(r3, x) << 7;
 }
 
-// Set uniform vertex color
-inline void setUniformColor(Mesh& mesh, float r, float g, float b) {
-    mesh.colors.resize(mesh.vertices.size(), Color3(r, g, b));
+inline int lowestBit(uint64_t m) {
+    return __builtin_ctzll(m);
 }
 
-// Set colors from external color array (e.g., from GPU sampling)
-inline void setColors(Mesh& mesh, const std::vector<Color3>& colors) {
-    if (colors.size() == mesh.vertices.size()) {
-        mesh.colors = colors;
+// Cell of a tile with surface crossing
+struct ActiveCell {
+    uint16_t local;      // x + y*MC_TILE_SIZE + z*MC_TILE_SIZE² relative to the tile origin
+    uint8_t cubeIndex;   // corner sign mask (bit i = corner i inside)
+};
+
+static_assert(MC_TILE_SIZE + 1 <= 64, "a tile row of sign bits must fit one word");
+
+// Append the active cells of tile [lo, hi) to out, in x-fastest order
+inline void classifyTileCells(const float* distances, int res,
+                              const int lo[3], const int hi[3], float isolevel,
+                              std::vector<ActiveCell>& out) {
+    constexpr int S = MC_TILE_SIZE + 1;
+    int nx = hi[0] - lo[0], ny = hi[1] - lo[1], nz = hi[2] - lo[2];
+
+    uint64_t rows[S * S];
+    for (int z = 0; z <= nz; z++) {
+        for (int y = 0; y <= ny; y++) {
+            size_t base = lo[0] + (size_t)(lo[1] + y) * res + (size_t)(lo[2] + z) * res * res;
+            signBitsRow(distances + base, nx + 1, isolevel, &rows[y + z * S]);
+        }
+    }
+
+    for (int z = 0; z < nz; z++) {
+        for (int y = 0; y < ny; y++) {
+            const uint64_t* r0 = &rows[y + z * S];
+            const uint64_t* r2 = r0 + S;
+            uint64_t active;
+            activeCellBits(r0, r0 + 1, r2, r2 + 1, nx, &active);
+            while (active) {
+                int x = lowestBit(active);
+                active &= active - 1;
+                out.push_back({(uint16_t)(x + (y + z * MC_TILE_SIZE) * MC_TILE_SIZE),
+                               (uint8_t)cubeIndexFromBits(r0, r0 + 1, r2, r2 + 1, x)});
+            }
+        }
     }
 }
 
-// Export mesh to OBJ file with optional colors and UVs
-inline bool exportOBJ(const std::string& filename, const Mesh& mesh,
-                      bool includeColors = false, bool includeUVs = false) {
-    if (mesh.vertices.empty()) return false;
+// Sparse index of all active cells of a grid - a two-level table: per tile a
+// range into `cells`, within which entries are sorted by local cell index.
+// Costs ~4 bytes per active cell instead of dense (res-1)³ arrays, and entry
+// order (tile-major) is stable, so entry i can double as DC vertex i.
+struct ActiveCellIndex {
+    CellTiles tiles;
+    std::vector<uint32_t> tileStart;  // tiles.count() + 1 offsets into cells
+    std::vector<ActiveCell> cells;
+
+    explicit ActiveCellIndex(int res) : tiles(res) {}
+
+    size_t size() const { return cells.size(); }
+
+    // Entry of cell (x, y, z), or -1 if it has no surface crossing
+    int64_t find(int x, int y, int z) const {
+        size_t t = (size_t)(x / MC_TILE_SIZE)
+                 + (size_t)(y / MC_TILE_SIZE) * tiles.perAxis
+                 + (size_t)(z / MC_TILE_SIZE) * tiles.perAxis * tiles.perAxis;
+        uint16_t local = (uint16_t)(x % MC_TILE_SIZE
+                       + (y % MC_TILE_SIZE + (z % MC_TILE_SIZE) * MC_TILE_SIZE) * MC_TILE_SIZE);
+        auto first = cells.begin() + tileStart[t];
+        auto last = cells.begin() + tileStart[t + 1];
+        auto it = std::lower_bound(first, last, local,
+            [](const ActiveCell& c, uint16_t key) { return c.local < key; });
+        if (it == last || it->local != local) return -1;
+        return it - cells.begin();
+    }
+};
 
-    std::ofstream file(filename);
-    if (!file.is_open()) return false;
+// Resize a vector of per-tile/per-worker buffers to n and empty them,
+// keeping each surviving buffer's capacity
+template<typename T>
+inline void resetBuffers(std::vector<T>& buffers, size_t n) {
+    buffers.resize(n);
+    for (T& b : buffers) b.clear();
+}
 
-    // Use C locale to avoid thousands separators in numbers
-    file.imbue(std::locale::classic());
+// Classify every tile in parallel and concatenate the per-tile lists into
+// index (rebuilt for res). perTile is scratch, reused across calls.
+inline void buildActiveCellIndex(const float* distances, int res, float isolevel,
+                                 ActiveCellIndex& index,
+                                 std::vector<std::vector<ActiveCell>>& perTile) {
+    index.tiles = CellTiles(res);
+    ThreadPool& pool = ThreadPool::instance();
+    size_t numTiles = index.tiles.count();
+
+    resetBuffers(perTile, numTiles);
+    pool.parallelFor(numTiles, [&](size_t t, unsigned) {
+        int tc[3], lo[3], hi[3];
+        index.tiles.bounds(t, tc, lo, hi);
+        classifyTileCells(distances, res, lo, hi, isolevel, perTile[t]);
+    });
+
+    index.tileStart.resize(numTiles + 1);
+    index.tileStart[0] = 0;
+    for (size_t t = 0; t < numTiles; t++) {
+        index.tileStart[t + 1] = index.tileStart[t] + (uint32_t)perTile[t].size();
+    }
+    index.cells.resize(index.tileStart[numTiles]);
+    pool.parallelFor(numTiles, [&](size_t t, unsigned) {
+        std::copy(perTile[t].begin(), perTile[t].end(), index.cells.begin() + index.tileStart[t]);
+    });
+}
 
-    file << "# Generated by Marching Cubes (Parallel)\n";
-    file << "# Vertices: " << mesh.vertices.size() << "\n";
-    file << "# Triangles: " << mesh.indices.size() / 3 << "\n";
-    if (includeColors && mesh.hasColors()) file << "# With vertex colors\n";
-    if (includeUVs && mesh.hasUVs()) file << "# With UV coordinates\n";
-    file << "\n";
+inline ActiveCellIndex buildActiveCellIndex(const float* distances, int res, float isolevel) {
+    ActiveCellIndex index(res);
+    std::vector<std::vector<ActiveCell>> perTile;
+    buildActiveCellIndex(distances, res, isolevel, index, perTile);
+    return index;
+}
 
-    // Write vertices (optionally with colors)
-    bool writeColors = includeColors && mesh.hasColors();
-    for (size_t i = 0; i < mesh.vertices.size(); i++) {
-        const Vec3& v = mesh.vertices[i];
-        if (writeColors) {
-            const Color3& c = mesh.colors[i];
-            file << "v " << v.x << " " << v.y << " " << v.z
-                 << " " << c.r << " " << c.g << " " << c.b << "\n";
-        } else {
-            file << "v " << v.x << " " << v.y << " " << v.z << "\n";
+// Cube edge layout for shared-edge (welded) marching cubes
+// Per edge: axis (0=X, 1=Y, 2=Z), grid offset of the lower endpoint relative to
+// the cell origin (dx, dy, dz), and the corner pair ordered low -> high.
+// Interpolating always from the lower endpoint makes the crossing position
+// independent of which neighbouring cell creates it.
+static const int mcEdgeInfo[12][6] = {
+    {0, 0, 0, 0, 0, 1}, {1, 1, 0, 0, 1, 2}, {0, 0, 1, 0, 3, 2}, {1, 0, 0, 0, 0, 3},
+    {0, 0, 0, 1, 4, 5}, {1, 1, 0, 1, 5, 6}, {0, 0, 1, 1, 7, 6}, {1, 0, 0, 1, 4, 7},
+    {2, 0, 0, 0, 0, 4}, {2, 1, 0, 0, 1, 5}, {2, 1, 1, 0, 2, 6}, {2, 0, 1, 0, 3, 7}
+};
+
+// Vertex-index cache for the edge crossings of one Z slab (welded MC)
+// X/Y edges live on the slab's bottom (z) and top (z+1) planes, Z edges span
+// between them. Entries index ThreadMesh::vertices, -1 = not created yet.
+struct SlabEdgeCache {
+    int res = 0;
+    std::vector<int32_t> xEdges[2];  // [0] = bottom plane, [1] = top plane
+    std::vector<int32_t> yEdges[2];
+    std::vector<int32_t> zEdges;
+
+    void init(int r) {
+        res = r;
+        size_t n = (size_t)r * r;
+        for (int i = 0; i < 2; i++) {
+            xEdges[i].assign(n, -1);
+            yEdges[i].assign(n, -1);
         }
+        zEdges.assign(n, -1);
     }
 
-    // Write texture coordinates
-    if (includeUVs && mesh.hasUVs()) {
-        file << "\n";
-        for (const auto& uv : mesh.uvs) {
-            file << "vt " << uv.u << " " << uv.v << "\n";
-        }
+    // Step to the next slab: the old top plane becomes the new bottom plane
+    void advance() {
+        std::swap(xEdges[0], xEdges[1]);
+        std::swap(yEdges[0], yEdges[1]);
+        std::fill(xEdges[1].begin(), xEdges[1].end(), -1);
+        std::fill(yEdges[1].begin(), yEdges[1].end(), -1);
+        std::fill(zEdges.begin(), zEdges.end(), -1);
     }
 
-    // Write normals
-    if (mesh.hasNormals()) {
-        file << "\n";
-        for (const auto& n : mesh.normals) {
-            file << "vn " << n.x << " " << n.y << " " << n.z << "\n";
+    int32_t& slot(int edge, int x, int y) {
+        const int* info = mcEdgeInfo[edge];
+        size_t i = (size_t)(x + info[1]) + (size_t)(y + info[2]) * res;
+        if (info[0] == 0) return xEdges[info[3]][i];
+        if (info[0] == 1) return yEdges[info[3]][i];
+        return zEdges[i];
+    }
+};
+
+// Polygonise one cell into welded output: look up (or create) one shared
+// vertex per crossed edge in the slab cache, then emit indexed triangles.
+// onVertex(edge, vertex) is called for every vertex created.
+template<typename OnVertex>
+inline void polygonizeCellWelded(const float v[8], const Vec3 p[8], int cubeIndex,
+                                 int x, int y, float isolevel,
+                                 SlabEdgeCache& cache, ThreadMesh& tm, OnVertex&& onVertex) {
+    int32_t vertIdx[12];
+    for (int e = 0; e < 12; e++) {
+        if (!(edgeTable[cubeIndex] & (1 << e))) continue;
+        int32_t& slot = cache.slot(e, x, y);
+        if (slot < 0) {
+            int c0 = mcEdgeInfo[e][4], c1 = mcEdgeInfo[e][5];
+            slot = (int32_t)tm.vertices.size();
+            tm.vertices.push_back(vertexInterp(isolevel, p[c0], p[c1], v[c0], v[c1]));
+            onVertex(e, (uint32_t)slot);
         }
+        vertIdx[e] = slot;
+    }
+    for (int i = 0; triTable[cubeIndex][i] != -1; i += 3) {
+        tm.indices.push_back((uint32_t)vertIdx[triTable[cubeIndex][i]]);
+        tm.indices.push_back((uint32_t)vertIdx[triTable[cubeIndex][i+1]]);
+        tm.indices.push_back((uint32_t)vertIdx[triTable[cubeIndex][i+2]]);
     }
+}
 
-    // Write faces (winding order flipped for correct OBJ convention: CCW = front face)
-    file << "\n";
-    bool hasUV = includeUVs && mesh.hasUVs();
-    bool hasN = mesh.hasNormals();
+inline void polygonizeCellWelded(const float v[8], const Vec3 p[8], int cubeIndex,
+                                 int x, int y, float isolevel,
+                                 SlabEdgeCache& cache, ThreadMesh& tm) {
+    polygonizeCellWelded(v, p, cubeIndex, x, y, isolevel, cache, tm, [](int, uint32_t) {});
+}
 
-    for (size_t i = 0; i < mesh.indices.size(); i += 3) {
-        // Flip winding: i0, i2, i1 instead of i0, i1, i2
-        uint32_t i0 = mesh.indices[i] + 1;
-        uint32_t i1 = mesh.indices[i+2] + 1;  // Swapped
-        uint32_t i2 = mesh.indices[i+1] + 1;  // Swapped
-
-        if (hasUV && hasN) {
-            file << "f " << i0 << "/" << i0 << "/" << i0 << " "
-                        << i1 << "/" << i1 << "/" << i1 << " "
-                        << i2 << "/" << i2 << "/" << i2 << "\n";
-        } else if (hasN) {
-            file << "f " << i0 << "//" << i0 << " "
-                        << i1 << "//" << i1 << " "
-                        << i2 << "//" << i2 << "\n";
-        } else if (hasUV) {
-            file << "f " << i0 << "/" << i0 << " "
-                        << i1 << "/" << i1 << " "
-                        << i2 << "/" << i2 << "\n";
-        } else {
-            file << "f " << i0 << " " << i1 << " " << i2 << "\n";
+// Output of one tile of welded MC. Crossings are owned by the tile holding the
+// edge's lower endpoint (clamped to the last cell), so each vertex is created
+// exactly once; crossings owned by a neighbour are referenced in `indices` as
+// WELD_EXTERNAL | slot and resolved at merge through the owner's faceVerts.
+struct WeldedTile {
+    std::vector<Vec3> vertices;
+    std::vector<Vec3> normals;                             // Only filled when generating grid normals
+    std::vector<uint32_t> indices;
+    std::vector<std::pair<uint32_t, uint32_t>> faceVerts;  // (edge key, local vertex) on min faces, sorted
+    std::vector<std::pair<uint32_t, uint32_t>> externals;  // (owner tile, owner edge key)
+    std::vector<Vec3> externalPos;                         // fallback if the owner lacks it
+    std::vector<Vec3> externalNormal;
+
+    void clear() {
+        vertices.clear(); normals.clear(); indices.clear(); faceVerts.clear();
+        externals.clear(); externalPos.clear(); externalNormal.clear();
+    }
+};
+
+constexpr uint32_t WELD_EXTERNAL = 0x80000000u;
+constexpr uint32_t WELD_UNSET = 0xFFFFFFFFu;
+
+// Key of an edge from its lower endpoint relative to a tile origin (0..MC_TILE_SIZE)
+inline uint32_t weldEdgeKey(int axis, int lx, int ly, int lz) {
+    const uint32_t span = MC_TILE_SIZE + 1;
+    return (((uint32_t)lz * span + (uint32_t)ly) * span + (uint32_t)lx) * 3u + (uint32_t)axis;
+}
+
+struct QEF;
+struct DCOctreeScratch;
+
+// Triangles marching cubes emits for each cube configuration
+inline const uint8_t* mcTriangleCounts() {
+    static const std::array<uint8_t, 256> counts = [] {
+        std::array<uint8_t, 256> c{};
+        for (int i = 0; i < 256; i++) {
+            int n = 0;
+            while (triTable[i][n] != -1) n++;
+            c[i] = (uint8_t)(n / 3);
         }
+        return c;
+    }();
+    return counts.data();
+}
+
+// Scratch buffers of the grid mesh generators, kept across calls. Passing
+// the same arena to repeated generateMesh/generateMeshDC calls (the editor
+// preview) means per-tile buffers keep their capacity, so once warmed up a
+// regeneration allocates only when the surface grew. Per-tile buffers are
+// reserved from the active cells before polygonising, so they do not
+// reallocate inside the hot loop either. One arena per concurrent caller.
+struct MeshArena {
+    ActiveCellIndex active{2};
+    std::vector<std::vector<ActiveCell>> activeTiles;  // classification, per tile
+
+    // MC
+    std::vector<ThreadMesh> tileMeshes;
+    std::vector<WeldedTile> weldedTiles;
+    std::vector<std::vector<uint32_t>> workerSlots;    // welded edge -> vertex, per worker
+    std::vector<std::vector<uint32_t>> workerTouched;
+
+    // DC
+    struct QEFScratch { std::vector<QEF> qefs; std::vector<Vec3> lo, hi, out; void clear() { qefs.clear(); } };
+    std::vector<Vec3> cellVertices;
+    std::vector<QEF> leafQefs;
+    std::vector<QEFScratch> workerQefs;
+    std::vector<DCOctreeScratch> workerOctree;
+    std::vector<std::vector<Vec3>> tileVertices;
+    std::vector<uint32_t> entryVertex;
+    std::vector<std::vector<uint32_t>> tileIndices;
+
+    // Merges: prefix sums and welded reference resolution
+    std::vector<size_t> offsets[4];
+    std::vector<uint32_t> resolved;
+    std::vector<size_t> fallbackCount;
+
+    // Storage for the next returned mesh, see recycle()
+    Mesh spare;
+
+    // Hand a mesh from an earlier call back so the next result reuses its storage
+    void recycle(Mesh&& mesh) { spare = std::move(mesh); }
+
+    // Empty mesh for the next result, holding the recycled storage if any
+    Mesh takeMesh() {
+        Mesh mesh = std::move(spare);
+        spare = Mesh();
+        mesh.vertices.clear(); mesh.normals.clear(); mesh.colors.clear();
+        mesh.uvs.clear(); mesh.indices.clear();
+        return mesh;
     }
+};
 
-    file.close();
-    return true;
+// Exclusive prefix sum of per-part sizes: offsets[i] is where part i starts
+// in the merged output, offsets.back() the total. Merges built on it copy
+// each part into its own slice in parallel, so the output is in part
+// (tile) order for any thread count.
+template<typename SizeFn>
+inline void prefixOffsets(std::vector<size_t>& offsets, size_t count, SizeFn&& sizeOf) {
+    offsets.resize(count + 1);
+    offsets[0] = 0;
+    for (size_t i = 0; i < count; i++) offsets[i + 1] = offsets[i] + sizeOf(i);
 }
 
-// Export mesh to GLB (binary GLTF) with proper vertex color support
-inline bool exportGLB(const std::string& filename, const Mesh& mesh,
-                      bool includeColors = true) {
-    if (mesh.vertices.empty()) return false;
+// Concatenate per-tile index buffers into out (PARALLEL)
+inline void mergeIndexBuffers(const std::vector<std::vector<uint32_t>>& parts,
+                              std::vector<uint32_t>& out, MeshArena& scratch) {
+    std::vector<size_t>& offset = scratch.offsets[0];
+    prefixOffsets(offset, parts.size(), [&](size_t i) { return parts[i].size(); });
+    out.resize(offset.back());
+    ThreadPool::instance().parallelFor(parts.size(), [&](size_t i, unsigned) {
+        std::copy(parts[i].begin(), parts[i].end(), out.begin() + offset[i]);
+    });
+}
 
-    tinygltf::Model model;
-    tinygltf::Scene scene;
-    tinygltf::Mesh gltfMesh;
-    tinygltf::Primitive primitive;
-    tinygltf::Buffer buffer;
-    tinygltf::BufferView positionView, normalView, colorView, indexView;
-    tinygltf::Accessor positionAccessor, normalAccessor, colorAccessor, indexAccessor;
+// Concatenate per-tile meshes in tile order, rebasing their indices (PARALLEL)
+// withNormals: the parts carry one normal per vertex, copy them too
+inline Mesh mergeThreadMeshes(const std::vector<ThreadMesh>& parts, MeshArena& scratch,
+                              bool withNormals = false) {
+    std::vector<size_t>& vertexOffset = scratch.offsets[0];
+    std::vector<size_t>& indexOffset = scratch.offsets[1];
+    prefixOffsets(vertexOffset, parts.size(), [&](size_t i) { return parts[i].vertices.size(); });
+    prefixOffsets(indexOffset, parts.size(), [&](size_t i) { return parts[i].indices.size(); });
+
+    Mesh mesh = scratch.takeMesh();
+    mesh.vertices.resize(vertexOffset.back());
+    mesh.normals.resize(withNormals ? vertexOffset.back() : 0);
+    mesh.indices.resize(indexOffset.back());
+    ThreadPool::instance().parallelFor(parts.size(), [&](size_t i, unsigned) {
+        const ThreadMesh& tm = parts[i];
+        std::copy(tm.vertices.begin(), tm.vertices.end(), mesh.vertices.begin() + vertexOffset[i]);
+        if (withNormals) {
+            std::copy(tm.normals.begin(), tm.normals.end(), mesh.normals.begin() + vertexOffset[i]);
+        }
+        uint32_t base = (uint32_t)vertexOffset[i];
+        uint32_t* dst = mesh.indices.data() + indexOffset[i];
+        for (size_t k = 0; k < tm.indices.size(); k++) dst[k] = tm.indices[k] + base;
+    });
+    return mesh;
+}
 
-    // Calculate buffer sizes
-    size_t vertexCount = mesh.vertices.size();
-    size_t indexCount = mesh.indices.size();
-    size_t positionSize = vertexCount * 3 * sizeof(float);
-    size_t normalSize = mesh.hasNormals() ? vertexCount * 3 * sizeof(float) : 0;
-    size_t colorSize = (includeColors && mesh.hasColors()) ? vertexCount * 4 * sizeof(float) : 0;
-    size_t indexSize = indexCount * sizeof(uint32_t);
-
-    // Create buffer data
-    size_t offset = 0;
-    buffer.data.resize(positionSize + normalSize + colorSize + indexSize);
-
-    // Positions
-    std::vector<float> positions(vertexCount * 3);
-    float minPos[3] = {FLT_MAX, FLT_MAX, FLT_MAX};
-    float maxPos[3] = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
-    for (size_t i = 0; i < vertexCount; i++) {
-        positions[i * 3 + 0] = mesh.vertices[i].x;
-        positions[i * 3 + 1] = mesh.vertices[i].y;
-        positions[i * 3 + 2] = mesh.vertices[i].z;
-        minPos[0] = std::min(minPos[0], mesh.vertices[i].x);
-        minPos[1] = std::min(minPos[1], mesh.vertices[i].y);
-        minPos[2] = std::min(minPos[2], mesh.vertices[i].z);
-        maxPos[0] = std::max(maxPos[0], mesh.vertices[i].x);
-        maxPos[1] = std::max(maxPos[1], mesh.vertices[i].y);
-        maxPos[2] = std::max(maxPos[2], mesh.vertices[i].z);
-    }
-    memcpy(buffer.data.data() + offset, positions.data(), positionSize);
-
-    positionView.buffer = 0;
-    positionView.byteOffset = offset;
-    positionView.byteLength = positionSize;
-    positionView.target = TINYGLTF_TARGET_ARRAY_BUFFER;
-    offset += positionSize;
-
-    positionAccessor.bufferView = 0;
-    positionAccessor.byteOffset = 0;
-    positionAccessor.componentType = TINYGLTF_COMPONENT_TYPE_FLOAT;
-    positionAccessor.count = vertexCount;
-    positionAccessor.type = TINYGLTF_TYPE_VEC3;
-    positionAccessor.minValues = {minPos[0], minPos[1], minPos[2]};
-    positionAccessor.maxValues = {maxPos[0], maxPos[1], maxPos[2]};
-
-    // Normals
-    int normalAccessorIdx = -1;
-    if (mesh.hasNormals()) {
-        std::vector<float> normals(vertexCount * 3);
-        for (size_t i = 0; i < vertexCount; i++) {
-            normals[i * 3 + 0] = mesh.normals[i].x;
-            normals[i * 3 + 1] = mesh.normals[i].y;
-            normals[i * 3 + 2] = mesh.normals[i].z;
-        }
-        memcpy(buffer.data.data() + offset, normals.data(), normalSize);
-
-        normalView.buffer = 0;
-        normalView.byteOffset = offset;
-        normalView.byteLength = normalSize;
-        normalView.target = TINYGLTF_TARGET_ARRAY_BUFFER;
-        offset += normalSize;
-
-        normalAccessor.bufferView = 1;
-        normalAccessor.byteOffset = 0;
-        normalAccessor.componentType = TINYGLTF_COMPONENT_TYPE_FLOAT;
-        normalAccessor.count = vertexCount;
-        normalAccessor.type = TINYGLTF_TYPE_VEC3;
-        normalAccessorIdx = 1;
-    }
-
-    // Colors (RGBA float)
-    int colorAccessorIdx = -1;
-    if (includeColors && mesh.hasColors()) {
-        std::vector<float> colors(vertexCount * 4);
-        for (size_t i = 0; i < vertexCount; i++) {
-            colors[i * 4 + 0] = mesh.colors[i].r;
-            colors[i * 4 + 1] = mesh.colors[i].g;
-            colors[i * 4 + 2] = mesh.colors[i].b;
-            colors[i * 4 + 3] = 1.0f;  // Alpha
-        }
-        memcpy(buffer.data.data() + offset, colors.data(), colorSize);
-
-        colorView.buffer = 0;
-        colorView.byteOffset = offset;
-        colorView.byteLength = colorSize;
-        colorView.target = TINYGLTF_TARGET_ARRAY_BUFFER;
-        offset += colorSize;
-
-        colorAccessor.bufferView = mesh.hasNormals() ? 2 : 1;
-        colorAccessor.byteOffset = 0;
-        colorAccessor.componentType = TINYGLTF_COMPONENT_TYPE_FLOAT;
-        colorAccessor.count = vertexCount;
-        colorAccessor.type = TINYGLTF_TYPE_VEC4;
-        colorAccessorIdx = mesh.hasNormals() ? 2 : 1;
-    }
-
-    // Indices
-    memcpy(buffer.data.data() + offset, mesh.indices.data(), indexSize);
-
-    indexView.buffer = 0;
-    indexView.byteOffset = offset;
-    indexView.byteLength = indexSize;
-    indexView.target = TINYGLTF_TARGET_ELEMENT_ARRAY_BUFFER;
-
-    int indexViewIdx = 0;
-    if (mesh.hasNormals()) indexViewIdx++;
-    if (includeColors && mesh.hasColors()) indexViewIdx++;
-
-    indexAccessor.bufferView = indexViewIdx + 1;
-    indexAccessor.byteOffset = 0;
-    indexAccessor.componentType = TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT;
-    indexAccessor.count = indexCount;
-    indexAccessor.type = TINYGLTF_TYPE_SCALAR;
-
-    // Build model
-    model.buffers.push_back(buffer);
-    model.bufferViews.push_back(positionView);
-    if (mesh.hasNormals()) model.bufferViews.push_back(normalView);
-    if (includeColors && mesh.hasColors()) model.bufferViews.push_back(colorView);
-    model.bufferViews.push_back(indexView);
-
-    model.accessors.push_back(positionAccessor);
-    if (mesh.hasNormals()) model.accessors.push_back(normalAccessor);
-    if (includeColors && mesh.hasColors()) model.accessors.push_back(colorAccessor);
-    model.accessors.push_back(indexAccessor);
-
-    // Material that uses vertex colors
-    tinygltf::Material material;
-    material.name = "VertexColorMaterial";
-    material.pbrMetallicRoughness.baseColorFactor = {1.0, 1.0, 1.0, 1.0};  // White base, vertex colors multiply
-    material.pbrMetallicRoughness.metallicFactor = 0.0;
-    material.pbrMetallicRoughness.roughnessFactor = 0.8;
-    material.doubleSided = true;
-    model.materials.push_back(material);
-
-    // Primitive
-    primitive.attributes["POSITION"] = 0;
-    if (normalAccessorIdx >= 0) primitive.attributes["NORMAL"] = normalAccessorIdx;
-    if (colorAccessorIdx >= 0) primitive.attributes["COLOR_0"] = colorAccessorIdx;
-    primitive.indices = static_cast<int>(model.accessors.size() - 1);
-    primitive.mode = TINYGLTF_MODE_TRIANGLES;
-    primitive.material = 0;  // Use the vertex color material
-
-    gltfMesh.primitives.push_back(primitive);
-    model.meshes.push_back(gltfMesh);
-
-    // Node
-    tinygltf::Node node;
-    node.mesh = 0;
-    model.nodes.push_back(node);
-
-    // Scene
-    scene.nodes.push_back(0);
-    model.scenes.push_back(scene);
-    model.defaultScene = 0;
-
-    // Asset info
-    model.asset.version = "2.0";
-    model.asset.generator = "Marching Cubes Exporter";
-
-    // Write GLB
-    tinygltf::TinyGLTF gltf;
-    return gltf.WriteGltfSceneToFile(&model, filename, true, true, true, true);
-}
-
-// Load mesh from GLB file
-inline bool loadGLB(const std::string& filename, Mesh& outMesh) {
-    tinygltf::Model model;
-    tinygltf::TinyGLTF loader;
-    std::string err, warn;
-
-    bool success = loader.LoadBinaryFromFile(&model, &err, &warn, filename);
-    if (!warn.empty()) {
-        std::cerr << "GLB warning: " << warn << std::endl;
-    }
-    if (!err.empty()) {
-        std::cerr << "GLB error: " << err << std::endl;
-        return false;
-    }
-    if (!success) {
-        std::cerr << "Failed to load GLB: " << filename << std::endl;
-        return false;
-    }
+// Merge welded tiles in tile order (PARALLEL): prefix-sum the owned
+// vertices, resolve every external reference to its owner's copy, then
+// write vertices and rebased indices into the preallocated mesh. Externals
+// whose owner lacks the crossing get a fallback vertex appended after all
+// owned vertices, again in tile order. withNormals copies per-vertex normals.
+inline Mesh mergeWeldedTiles(const std::vector<WeldedTile>& tiles, MeshArena& scratch,
+                             bool withNormals = false) {
+    ThreadPool& pool = ThreadPool::instance();
+    std::vector<size_t>& vertexOffset = scratch.offsets[0];
+    std::vector<size_t>& indexOffset = scratch.offsets[1];
+    std::vector<size_t>& externalOffset = scratch.offsets[2];
+    std::vector<size_t>& fallbackOffset = scratch.offsets[3];
+    prefixOffsets(vertexOffset, tiles.size(), [&](size_t t) { return tiles[t].vertices.size(); });
+    prefixOffsets(indexOffset, tiles.size(), [&](size_t t) { return tiles[t].indices.size(); });
+    prefixOffsets(externalOffset, tiles.size(), [&](size_t t) { return tiles[t].externals.size(); });
+
+    // Pass 1: resolve externals. Misses are numbered per tile as
+    // WELD_EXTERNAL | n and rebased once the per-tile miss counts are known.
+    std::vector<uint32_t>& resolved = scratch.resolved;
+    std::vector<size_t>& fallbackCount = scratch.fallbackCount;
+    resolved.resize(externalOffset.back());
+    fallbackCount.resize(tiles.size());
+    pool.parallelFor(tiles.size(), [&](size_t t, unsigned) {
+        const WeldedTile& tile = tiles[t];
+        uint32_t* res = resolved.data() + externalOffset[t];
+        uint32_t misses = 0;
+        for (size_t i = 0; i < tile.externals.size(); i++) {
+            const WeldedTile& owner = tiles[tile.externals[i].first];
+            auto it = std::lower_bound(owner.faceVerts.begin(), owner.faceVerts.end(),
+                                       std::make_pair(tile.externals[i].second, 0u));
+            if (it != owner.faceVerts.end() && it->first == tile.externals[i].second) {
+                res[i] = (uint32_t)vertexOffset[tile.externals[i].first] + it->second;
+            } else {
+                res[i] = WELD_EXTERNAL | misses++;
+            }
+        }
+        fallbackCount[t] = misses;
+    });
+    prefixOffsets(fallbackOffset, tiles.size(), [&](size_t t) { return fallbackCount[t]; });
+
+    // Pass 2: write everything into its final slot
+    Mesh mesh = scratch.takeMesh();
+    size_t ownedVertices = vertexOffset.back();
+    mesh.vertices.resize(ownedVertices + fallbackOffset.back());
+    mesh.normals.resize(withNormals ? mesh.vertices.size() : 0);
+    mesh.indices.resize(indexOffset.back());
+    pool.parallelFor(tiles.size(), [&](size_t t, unsigned) {
+        const WeldedTile& tile = tiles[t];
+        std::copy(tile.vertices.begin(), tile.vertices.end(), mesh.vertices.begin() + vertexOffset[t]);
+        if (withNormals) {
+            std::copy(tile.normals.begin(), tile.normals.end(), mesh.normals.begin() + vertexOffset[t]);
+        }
 
-    // Clear output mesh
-    outMesh.vertices.clear();
-    outMesh.normals.clear();
-    outMesh.colors.clear();
-    outMesh.uvs.clear();
-    outMesh.indices.clear();
+        uint32_t* res = resolved.data() + externalOffset[t];
+        uint32_t fallbackBase = (uint32_t)(ownedVertices + fallbackOffset[t]);
+        for (size_t i = 0; i < tile.externals.size(); i++) {
+            if (res[i] & WELD_EXTERNAL) {
+                uint32_t v = fallbackBase + (res[i] & ~WELD_EXTERNAL);
+                mesh.vertices[v] = tile.externalPos[i];
+                if (withNormals) mesh.normals[v] = tile.externalNormal[i];
+                res[i] = v;
+            }
+        }
+
+        uint32_t base = (uint32_t)vertexOffset[t];
+        uint32_t* dst = mesh.indices.data() + indexOffset[t];
+        for (size_t k = 0; k < tile.indices.size(); k++) {
+            uint32_t idx = tile.indices[k];
+            dst[k] = (idx & WELD_EXTERNAL) ? res[idx & ~WELD_EXTERNAL] : base + idx;
+        }
+    });
+
+    return mesh;
+}
 
-    // Process all meshes in the model
-    for (const auto& mesh : model.meshes) {
-        for (const auto& primitive : mesh.primitives) {
-            if (primitive.mode != TINYGLTF_MODE_TRIANGLES) continue;
+// SDF gradient at grid point (x, y, z) in world units: central differences,
+// one-sided on the grid border
+inline Vec3 gridGradient(const float* d, int res, Vec3 cell_size, int x, int y, int z) {
+    size_t sy = (size_t)res, sz = (size_t)res * res;
+    size_t i = (size_t)x + y * sy + z * sz;
+    int xm = x > 0, xp = x < res - 1;
+    int ym = y > 0, yp = y < res - 1;
+    int zm = z > 0, zp = z < res - 1;
+    return Vec3(
+        (d[i + xp] - d[i - xm]) / ((xp + xm) * cell_size.x),
+        (d[i + yp * sy] - d[i - ym * sy]) / ((yp + ym) * cell_size.y),
+        (d[i + zp * sz] - d[i - zm * sz]) / ((zp + zm) * cell_size.z));
+}
+
+// Normal of an edge crossing from the gradients g0, g1 at its endpoints,
+// interpolated the way vertexInterp places the vertex (the trilinear field's
+// gradient at the crossing). Points outward (+gradient), is smooth across
+// cells whether or not vertices are welded.
+inline Vec3 edgeNormal(float isolevel, const Vec3& g0, const Vec3& g1, float v0, float v1) {
+    float mu = 0.0f;
+    if (std::abs(isolevel - v0) < 0.00001f) mu = 0.0f;
+    else if (std::abs(isolevel - v1) < 0.00001f) mu = 1.0f;
+    else if (std::abs(v0 - v1) >= 0.00001f) mu = (isolevel - v0) / (v1 - v0);
+
+    Vec3 n = g0 + (g1 - g0) * mu;
+    float len = n.length();
+    return len > 0.0001f ? n * (1.0f / len) : n;
+}
 
-            size_t baseVertex = outMesh.vertices.size();
+// Generate mesh from a 3D grid of SDF values (PARALLEL VERSION)
+// distances: flattened 3D array of size res*res*res (x varies fastest)
+// res: grid resolution in each dimension
+// bounds_min, bounds_max: world-space bounds
+// weldVertices: share one vertex per surface crossing (indexed output, ~6x fewer
+//               vertices, smooth computeNormals) instead of 3 vertices per triangle
+// arena: optional scratch kept by the caller across calls (see MeshArena)
+// gridNormals: fill mesh.normals from the SDF gradient while polygonising
+//              (edgeNormal), so no computeNormals pass is needed and
+//              unwelded output is smooth-shaded too
+inline Mesh generateMesh(
+    const std::vector<float>& distances,
+    int res,
+    Vec3 bounds_min,
+    Vec3 bounds_max,
+    float isolevel = 0.0f,
+    bool weldVertices = false,
+    MeshArena* arena = nullptr,
+    bool gridNormals = false
+) {
+    Vec3 cell_size = {
+        (bounds_max.x - bounds_min.x) / (res - 1),
+        (bounds_max.y - bounds_min.y) / (res - 1),
+        (bounds_max.z - bounds_min.z) / (res - 1)
+    };
 
-            // Get position accessor
-            auto posIt = primitive.attributes.find("POSITION");
-            if (posIt == primitive.attributes.end()) continue;
+    auto idx = [res](int x, int y, int z) { return x + y * res + z * res * res; };
 
-            const tinygltf::Accessor& posAccessor = model.accessors[posIt->second];
-            const tinygltf::BufferView& posView = model.bufferViews[posAccessor.bufferView];
-            const tinygltf::Buffer& posBuffer = model.buffers[posView.buffer];
+    ThreadPool& pool = ThreadPool::instance();
+    MeshArena localArena;
+    MeshArena& scratch = arena ? *arena : localArena;
+
+    // SIMD pre-pass: only cells with mixed corner signs are visited below
+    ActiveCellIndex& active = scratch.active;
+    buildActiveCellIndex(distances.data(), res, isolevel, active, scratch.activeTiles);
+    const CellTiles& tiles = active.tiles;
+    const uint8_t* triCount = mcTriangleCounts();
+
+    // Per-tile outputs, merged in tile order so the result does not depend on
+    // which worker ran which tile
+    std::vector<ThreadMesh>& tileMeshes = scratch.tileMeshes;
+    std::vector<WeldedTile>& weldedTiles = scratch.weldedTiles;
+    resetBuffers(tileMeshes, weldVertices ? 0 : tiles.count());
+    resetBuffers(weldedTiles, weldVertices ? tiles.count() : 0);
+
+    // Welded mode: per-worker edge -> vertex table for the tile being processed,
+    // reset through the touched list so clearing costs O(crossings)
+    const size_t slotCount = (size_t)weldEdgeKey(2, MC_TILE_SIZE, MC_TILE_SIZE, MC_TILE_SIZE) + 1;
+    std::vector<std::vector<uint32_t>>& workerSlots = scratch.workerSlots;
+    std::vector<std::vector<uint32_t>>& workerTouched = scratch.workerTouched;
+    if (weldVertices) {
+        workerSlots.resize(pool.size());
+        resetBuffers(workerTouched, pool.size());
+    }
 
-            const float* positions = reinterpret_cast<const float*>(
-                posBuffer.data.data() + posView.byteOffset + posAccessor.byteOffset);
+    pool.parallelFor(tiles.count(), [&](size_t t, unsigned worker) {
+        if (active.tileStart[t] == active.tileStart[t + 1]) return;
+        int tc[3], lo[3], hi[3];
+        tiles.bounds(t, tc, lo, hi);
+        Vec3 vertList[12];
+        Vec3 normList[12];
+
+        // Exact triangle count of the tile, so its buffers are sized once
+        size_t cells = active.tileStart[t + 1] - active.tileStart[t];
+        size_t tris = 0;
+        for (uint32_t i = active.tileStart[t]; i < active.tileStart[t + 1]; i++) {
+            tris += triCount[active.cells[i].cubeIndex];
+        }
 
-            size_t vertexCount = posAccessor.count;
-            size_t posStride = posView.byteStride ? posView.byteStride / sizeof(float) : 3;
+        std::vector<uint32_t>* slots = nullptr;
+        std::vector<uint32_t>* touched = nullptr;
+        if (weldVertices) {
+            slots = &workerSlots[worker];
+            touched = &workerTouched[worker];
+            if (slots->size() != slotCount) {
+                slots->assign(slotCount, WELD_UNSET);
+                touched->reserve(slotCount);
+            }
+            // Each cell owns at most the 3 edges at its min corner (a few
+            // more on the grid's max faces)
+            weldedTiles[t].vertices.reserve(3 * cells);
+            weldedTiles[t].indices.reserve(3 * tris);
+            if (gridNormals) weldedTiles[t].normals.reserve(3 * cells);
+        } else {
+            tileMeshes[t].vertices.reserve(3 * tris);
+            tileMeshes[t].indices.reserve(3 * tris);
+            if (gridNormals) tileMeshes[t].normals.reserve(3 * tris);
+        }
 
-            // Load positions
-            for (size_t i = 0; i < vertexCount; i++) {
-                outMesh.vertices.push_back(Vec3(
-                    positions[i * posStride + 0],
-                    positions[i * posStride + 1],
-                    positions[i * posStride + 2]
-                ));
-            }
-
-            // Get normals if present
-            auto normIt = primitive.attributes.find("NORMAL");
-            if (normIt != primitive.attributes.end()) {
-                const tinygltf::Accessor& normAccessor = model.accessors[normIt->second];
-                const tinygltf::BufferView& normView = model.bufferViews[normAccessor.bufferView];
-                const tinygltf::Buffer& normBuffer = model.buffers[normView.buffer];
-
-                const float* normals = reinterpret_cast<const float*>(
-                    normBuffer.data.data() + normView.byteOffset + normAccessor.byteOffset);
-
-                size_t normStride = normView.byteStride ? normView.byteStride / sizeof(float) : 3;
-
-                for (size_t i = 0; i < vertexCount; i++) {
-                    outMesh.normals.push_back(Vec3(
-                        normals[i * normStride + 0],
-                        normals[i * normStride + 1],
-                        normals[i * normStride + 2]
-                    ));
+        for (uint32_t i = active.tileStart[t]; i < active.tileStart[t + 1]; i++) {
+            int x, y, z;
+            tiles.cellCoords(t, active.cells[i].local, x, y, z);
+            int cubeIndex = active.cells[i].cubeIndex;
+
+            // Get 8 corner values
+            float v[8] = {
+                distances[idx(x,   y,   z)],
+                distances[idx(x+1, y,   z)],
+                distances[idx(x+1, y+1, z)],
+                distances[idx(x,   y+1, z)],
+                distances[idx(x,   y,   z+1)],
+                distances[idx(x+1, y,   z+1)],
+                distances[idx(x+1, y+1, z+1)],
+                distances[idx(x,   y+1, z+1)]
+            };
+
+            // Get 8 corner positions
+            Vec3 p[8] = {
+                {bounds_min.x + x * cell_size.x,     bounds_min.y + y * cell_size.y,     bounds_min.z + z * cell_size.z},
+                {bounds_min.x + (x+1) * cell_size.x, bounds_min.y + y * cell_size.y,     bounds_min.z + z * cell_size.z},
+                {bounds_min.x + (x+1) * cell_size.x, bounds_min.y + (y+1) * cell_size.y, bounds_min.z + z * cell_size.z},
+                {bounds_min.x + x * cell_size.x,     bounds_min.y + (y+1) * cell_size.y, bounds_min.z + z * cell_size.z},
+                {bounds_min.x + x * cell_size.x,     bounds_min.y + y * cell_size.y,     bounds_min.z + (z+1) * cell_size.z},
+                {bounds_min.x + (x+1) * cell_size.x, bounds_min.y + y * cell_size.y,     bounds_min.z + (z+1) * cell_size.z},
+                {bounds_min.x + (x+1) * cell_size.x, bounds_min.y + (y+1) * cell_size.y, bounds_min.z + (z+1) * cell_size.z},
+                {bounds_min.x + x * cell_size.x,     bounds_min.y + (y+1) * cell_size.y, bounds_min.z + (z+1) * cell_size.z}
+            };
+
+            // Corner gradients, computed on first use (gridNormals only)
+            Vec3 grad[8];
+            unsigned haveGrad = 0;
+            auto normalOf = [&](int e) {
+                int c0 = mcEdgeInfo[e][4], c1 = mcEdgeInfo[e][5];
+                for (int c : {c0, c1}) {
+                    if (haveGrad & (1u << c)) continue;
+                    grad[c] = gridGradient(distances.data(), res, cell_size,
+                                           x + (((c + 1) >> 1) & 1), y + ((c >> 1) & 1), z + (c >> 2));
+                    haveGrad |= 1u << c;
+                }
+                return edgeNormal(isolevel, grad[c0], grad[c1], v[c0], v[c1]);
+            };
+
+            if (weldVertices) {
+                WeldedTile& wt = weldedTiles[t];
+                uint32_t vertIdx[12];
+                for (int e = 0; e < 12; e++) {
+                    if (!(edgeTable[cubeIndex] & (1 << e))) continue;
+                    const int* info = mcEdgeInfo[e];
+                    int ex = x + info[1], ey = y + info[2], ez = z + info[3];
+                    uint32_t key = weldEdgeKey(info[0], ex - lo[0], ey - lo[1], ez - lo[2]);
+                    uint32_t& slot = (*slots)[key];
+                    if (slot == WELD_UNSET) {
+                        touched->push_back(key);
+                        Vec3 pos = vertexInterp(isolevel, p[info[4]], p[info[5]], v[info[4]], v[info[5]]);
+                        Vec3 normal = gridNormals ? normalOf(e) : Vec3();
+                        int owner[3] = {
+                            std::min(ex, tiles.cellRes - 1) / MC_TILE_SIZE,
+                            std::min(ey, tiles.cellRes - 1) / MC_TILE_SIZE,
+                            std::min(ez, tiles.cellRes - 1) / MC_TILE_SIZE
+                        };
+                        if (owner[0] == tc[0] && owner[1] == tc[1] && owner[2] == tc[2]) {
+                            slot = (uint32_t)wt.vertices.size();
+                            wt.vertices.push_back(pos);
+                            if (gridNormals) wt.normals.push_back(normal);
+                            if (ex == lo[0] || ey == lo[1] || ez == lo[2]) {
+                                wt.faceVerts.push_back({key, slot});
+                            }
+                        } else {
+                            size_t ownerTile = owner[0] + (size_t)owner[1] * tiles.perAxis
+                                             + (size_t)owner[2] * tiles.perAxis * tiles.perAxis;
+                            uint32_t ownerKey = weldEdgeKey(info[0],
+                                ex - owner[0] * MC_TILE_SIZE,
+                                ey - owner[1] * MC_TILE_SIZE,
+                                ez - owner[2] * MC_TILE_SIZE);
+                            slot = WELD_EXTERNAL | (uint32_t)wt.externals.size();
+                            wt.externals.push_back({(uint32_t)ownerTile, ownerKey});
+                            wt.externalPos.push_back(pos);
+                            if (gridNormals) wt.externalNormal.push_back(normal);
+                        }
+                    }
+                    vertIdx[e] = slot;
                 }
+                for (int i = 0; triTable[cubeIndex][i] != -1; i += 3) {
+                    wt.indices.push_back(vertIdx[triTable[cubeIndex][i]]);
+                    wt.indices.push_back(vertIdx[triTable[cubeIndex][i+1]]);
+                    wt.indices.push_back(vertIdx[triTable[cubeIndex][i+2]]);
+                }
+                continue;
             }
 
-            // Get colors if present (COLOR_0)
-            auto colorIt = primitive.attributes.find("COLOR_0");
-            if (colorIt != primitive.attributes.end()) {
-                const tinygltf::Accessor& colorAccessor = model.accessors[colorIt->second];
-                const tinygltf::BufferView& colorView = model.bufferViews[colorAccessor.bufferView];
-                const tinygltf::Buffer& colorBuffer = model.buffers[colorView.buffer];
-
-                if (colorAccessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT) {
-                    const float* colors = reinterpret_cast<const float*>(
-                        colorBuffer.data.data() + colorView.byteOffset + colorAccessor.byteOffset);
+            ThreadMesh& tm = tileMeshes[t];
 
-                    int components = (colorAccessor.type == TINYGLTF_TYPE_VEC4) ? 4 : 3;
-                    size_t colorStride = colorView.byteStride ? colorView.byteStride / sizeof(float) : components;
+            // Interpolate vertices on edges
+            // Same corner order as the welded paths (mcEdgeInfo), so every
+            // cell sharing an edge places its vertex bit-identically
+            for (int e = 0; e < 12; e++) {
+                if (!(edgeTable[cubeIndex] & (1 << e))) continue;
+                int c0 = mcEdgeInfo[e][4], c1 = mcEdgeInfo[e][5];
+                vertList[e] = vertexInterp(isolevel, p[c0], p[c1], v[c0], v[c1]);
+            }
 
-                    for (size_t i = 0; i < vertexCount; i++) {
-                        outMesh.colors.push_back(Color3(
-                            colors[i * colorStride + 0],
-                            colors[i * colorStride + 1],
-                            colors[i * colorStride + 2]
-                        ));
-                    }
+            if (gridNormals) {
+                for (int e = 0; e < 12; e++) {
+                    if (edgeTable[cubeIndex] & (1 << e)) normList[e] = normalOf(e);
                 }
             }
 
-            // Get indices
-            if (primitive.indices >= 0) {
-                const tinygltf::Accessor& indexAccessor = model.accessors[primitive.indices];
-                const tinygltf::BufferView& indexView = model.bufferViews[indexAccessor.bufferView];
-                const tinygltf::Buffer& indexBuffer = model.buffers[indexView.buffer];
-
-                const uint8_t* indexData = indexBuffer.data.data() + indexView.byteOffset + indexAccessor.byteOffset;
-
-                for (size_t i = 0; i < indexAccessor.count; i++) {
-                    uint32_t index = 0;
-                    switch (indexAccessor.componentType) {
-                        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
-                            index = reinterpret_cast<const uint32_t*>(indexData)[i];
-                            break;
-                        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
-                            index = reinterpret_cast<const uint16_t*>(indexData)[i];
-                            break;
-                        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
-                            index = indexData[i];
-                            break;
-                    }
-                    outMesh.indices.push_back(static_cast<uint32_t>(baseVertex + index));
+            // Add triangles
+            for (int i = 0; triTable[cubeIndex][i] != -1; i += 3) {
+                uint32_t baseIdx = (uint32_t)tm.vertices.size();
+                tm.vertices.push_back(vertList[triTable[cubeIndex][i]]);
+                tm.vertices.push_back(vertList[triTable[cubeIndex][i+1]]);
+                tm.vertices.push_back(vertList[triTable[cubeIndex][i+2]]);
+                tm.indices.push_back(baseIdx);
+                tm.indices.push_back(baseIdx + 1);
+                tm.indices.push_back(baseIdx + 2);
+                if (gridNormals) {
+                    tm.normals.push_back(normList[triTable[cubeIndex][i]]);
+                    tm.normals.push_back(normList[triTable[cubeIndex][i+1]]);
+                    tm.normals.push_back(normList[triTable[cubeIndex][i+2]]);
                 }
             }
         }
-    }
 
-    std::cout << "Loaded GLB: " << filename << " - "
-              << outMesh.vertices.size() << " vertices, "
-              << outMesh.indices.size() / 3 << " triangles"
-              << (outMesh.hasColors() ? ", with colors" : "")
-              << (outMesh.hasNormals() ? ", with normals" : "") << std::endl;
+        if (weldVertices) {
+            for (uint32_t key : *touched) (*slots)[key] = WELD_UNSET;
+            touched->clear();
+            std::sort(weldedTiles[t].faceVerts.begin(), weldedTiles[t].faceVerts.end());
+        }
+    });
 
-    return !outMesh.vertices.empty();
+    if (weldVertices) {
+        return mergeWeldedTiles(weldedTiles, scratch, gridNormals);
+    }
+
+    return mergeThreadMeshes(tileMeshes, scratch, gridNormals);
 }
 
-// Generate mesh from an SDF function (CPU evaluation)
-// Useful for testing without GPU
-template<typename SDFFunc>
-inline Mesh generateMeshFromFunction(
-    SDFFunc sdf,
+// Slab-streaming marching cubes - never holds the full res³ grid
+// fetchSlice(z, dst): fill dst with Z slice z (res*res floats, x fastest) and
+//                     return false on failure. Called once per slice, z = 0..res-1.
+// Only two slices plus one slab of edge caches are alive at any time, so peak
+// memory is O(res²) instead of O(res³). Output is welded (one vertex per
+// edge crossing), the same surface as generateMesh(..., weldVertices=true).
+template<typename SliceFunc>
+inline Mesh generateMeshStreaming(
+    SliceFunc fetchSlice,
     int res,
     Vec3 bounds_min,
     Vec3 bounds_max,
     float isolevel = 0.0f
 ) {
-    std::vector<float> distances(res * res * res);
+    Mesh mesh;
+    if (res < 2) return mesh;
 
-    Vec3 step = {
+    Vec3 cell_size = {
         (bounds_max.x - bounds_min.x) / (res - 1),
         (bounds_max.y - bounds_min.y) / (res - 1),
         (bounds_max.z - bounds_min.z) / (res - 1)
     };
 
-    int idx = 0;
-    for (int z = 0; z < res; z++) {
+    size_t sliceSize = (size_t)res * res;
+    std::vector<float> bottom(sliceSize), top(sliceSize);
+    if (!fetchSlice(0, bottom.data())) return mesh;
+
+    // Sign bits per grid row of the two resident slices (see signBitsRow)
+    int rowWords = (res + 63) / 64;
+    std::vector<uint64_t> bottomBits((size_t)res * rowWords), topBits((size_t)res * rowWords);
+    int cellWords = (res - 1 + 63) / 64;
+    std::vector<uint64_t> activeBits(cellWords);
+    auto computeSliceBits = [&](const std::vector<float>& slice, std::vector<uint64_t>& bits) {
         for (int y = 0; y < res; y++) {
-            for (int x = 0; x < res; x++) {
-                Vec3 p = {
-                    bounds_min.x + x * step.x,
-                    bounds_min.y + y * step.y,
-                    bounds_min.z + z * step.z
-                };
-                distances[idx++] = sdf(p);
-            }
+            signBitsRow(&slice[(size_t)y * res], res, isolevel, &bits[(size_t)y * rowWords]);
         }
-    }
+    };
+    computeSliceBits(bottom, bottomBits);
 
-    return generateMesh(distances, res, bounds_min, bounds_max, isolevel);
-}
+    ThreadMesh tm;
+    SlabEdgeCache cache;
+    cache.init(res);
 
-// ============================================================================
-// DUAL CONTOURING - Better sharp feature preservation
-// ============================================================================
+    for (int z = 0; z < res - 1; z++) {
+        if (!fetchSlice(z + 1, top.data())) {
+            std::cerr << "Streaming MC: failed to fetch slice " << (z + 1) << std::endl;
+            return mesh;
+        }
+        computeSliceBits(top, topBits);
+        if (z > 0) cache.advance();
+
+        float z0 = bounds_min.z + z * cell_size.z;
+        float z1 = bounds_min.z + (z + 1) * cell_size.z;
+
+        for (int y = 0; y < res - 1; y++) {
+            const float* b0 = &bottom[(size_t)y * res];
+            const float* b1 = b0 + res;
+            const float* t0 = &top[(size_t)y * res];
+            const float* t1 = t0 + res;
+            float y0 = bounds_min.y + y * cell_size.y;
+            float y1 = bounds_min.y + (y + 1) * cell_size.y;
+
+            const uint64_t* sb0 = &bottomBits[(size_t)y * rowWords];
+            const uint64_t* sb1 = sb0 + rowWords;
+            const uint64_t* st0 = &topBits[(size_t)y * rowWords];
+            const uint64_t* st1 = st0 + rowWords;
+            activeCellBits(sb0, sb1, st0, st1, res - 1, activeBits.data());
+
+            for (int w = 0; w < cellWords; w++) {
+                for (uint64_t m = activeBits[w]; m; m &= m - 1) {
+                    int x = w * 64 + lowestBit(m);
+                    float v[8] = {b0[x], b0[x+1], b1[x+1], b1[x], t0[x], t0[x+1], t1[x+1], t1[x]};
+                    int cubeIndex = cubeIndexFromBits(sb0, sb1, st0, st1, x);
+
+                    float x0 = bounds_min.x + x * cell_size.x;
+                    float x1 = bounds_min.x + (x + 1) * cell_size.x;
+                    Vec3 p[8] = {
+                        {x0, y0, z0}, {x1, y0, z0}, {x1, y1, z0}, {x0, y1, z0},
+                        {x0, y0, z1}, {x1, y0, z1}, {x1, y1, z1}, {x0, y1, z1}
+                    };
+
+                    polygonizeCellWelded(v, p, cubeIndex, x, y, isolevel, cache, tm);
+                }
+            }
+        }
+
+        std::swap(bottom, top);
+        std::swap(bottomBits, topBits);
+    }
+
+    mesh.vertices = std::move(tm.vertices);
+    mesh.indices = std::move(tm.indices);
+    return mesh;
+}
+
+// ============================================================================
+// INCREMENTAL MESHING - block cache for interactive edits
+// ============================================================================
+
+constexpr int MC_BLOCK_CELLS = 32;
+// Blocks per axis fetched together by MeshChunkCache::update (up to 129³ points)
+constexpr int MC_UPDATE_GROUP = 4;
+
+// Welded MC of one block of the grid. s points at the block's first sample,
+// sy/sz are the sample strides between rows/slices, lo the block's first grid
+// point and dims its point count per axis (cells + 1). Positions use global
+// grid coordinates, so they match generateMesh exactly. Vertices on the
+// block's faces are listed in seam with their global edge key.
+inline void polygonizeBlock(const float* s, size_t sy, size_t sz,
+                            const int lo[3], const int dims[3], int res,
+                            Vec3 bounds_min, Vec3 cell_size, float isolevel,
+                            SlabEdgeCache& cache, ThreadMesh& tm,
+                            std::vector<std::pair<uint32_t, uint64_t>>& seam) {
+    tm.clear();
+    seam.clear();
+    int n[3] = {dims[0] - 1, dims[1] - 1, dims[2] - 1};
+    if (n[0] < 1 || n[1] < 1 || n[2] < 1) return;
+    cache.init(std::max(dims[0], dims[1]));
+
+    for (int z = 0; z < n[2]; z++) {
+        if (z > 0) cache.advance();
+        float z0 = bounds_min.z + (lo[2] + z) * cell_size.z;
+        float z1 = bounds_min.z + (lo[2] + z + 1) * cell_size.z;
+
+        for (int y = 0; y < n[1]; y++) {
+            const float* b0 = s + y * sy + z * sz;
+            const float* b1 = b0 + sy;
+            const float* t0 = b0 + sz;
+            const float* t1 = b1 + sz;
+            float y0 = bounds_min.y + (lo[1] + y) * cell_size.y;
+            float y1 = bounds_min.y + (lo[1] + y + 1) * cell_size.y;
+
+            for (int x = 0; x < n[0]; x++) {
+                float v[8] = {b0[x], b0[x+1], b1[x+1], b1[x], t0[x], t0[x+1], t1[x+1], t1[x]};
+                int cubeIndex = 0;
+                for (int i = 0; i < 8; i++) {
+                    if (v[i] < isolevel) cubeIndex |= 1 << i;
+                }
+                if (cubeIndex == 0 || cubeIndex == 255) continue;
+
+                float x0 = bounds_min.x + (lo[0] + x) * cell_size.x;
+                float x1 = bounds_min.x + (lo[0] + x + 1) * cell_size.x;
+                Vec3 p[8] = {
+                    {x0, y0, z0}, {x1, y0, z0}, {x1, y1, z0}, {x0, y1, z0},
+                    {x0, y0, z1}, {x1, y0, z1}, {x1, y1, z1}, {x0, y1, z1}
+                };
+
+                polygonizeCellWelded(v, p, cubeIndex, x, y, isolevel, cache, tm,
+                    [&](int e, uint32_t vertex) {
+                        const int* info = mcEdgeInfo[e];
+                        int c[3] = {x + info[1], y + info[2], z + info[3]};
+                        bool onFace = false;
+                        for (int a = 0; a < 3; a++) {
+                            if (a != info[0] && (c[a] == 0 || c[a] == n[a])) onFace = true;
+                        }
+                        if (!onFace) return;
+                        uint64_t key = (((uint64_t)(lo[2] + c[2]) * res + (uint64_t)(lo[1] + c[1])) * res
+                                        + (uint64_t)(lo[0] + c[0])) * 3u + (uint64_t)info[0];
+                        seam.push_back({vertex, key});
+                    });
+            }
+        }
+    }
+}
+
+// Welded MC of a grid kept as blocks of MC_BLOCK_CELLS³ cells, each meshed
+// and cached on its own. After an edit only the blocks overlapping the
+// changed region are resampled and re-meshed; assemble() stitches all
+// blocks back into one mesh by welding the vertices on block faces through
+// their global edge key. Neighbouring blocks both read their shared face of
+// samples. Usage:
+//   cache.reset(res, bmin, bmax);
+//   cache.rebuild(fetchSlices);            // full build, slab by slab
+//   cache.invalidate(editMin, editMax);    // after an edit
+//   cache.update(fetchBlock);              // resample + re-mesh dirty blocks
+//   Mesh mesh = cache.assemble();
+struct MeshChunkCache {
+    struct Block {
+        ThreadMesh mesh;
+        std::vector<std::pair<uint32_t, uint64_t>> seam;  // (vertex, global edge key), by vertex
+        bool dirty = true;
+    };
+
+    int res = 0;
+    int perAxis = 0;
+    Vec3 boundsMin, boundsMax, cellSize;
+    float isolevel = 0.0f;
+    std::vector<Block> blocks;
+
+    void reset(int r, Vec3 bmin, Vec3 bmax, float iso = 0.0f) {
+        res = r;
+        boundsMin = bmin;
+        boundsMax = bmax;
+        isolevel = iso;
+        perAxis = r >= 2 ? (r - 1 + MC_BLOCK_CELLS - 1) / MC_BLOCK_CELLS : 0;
+        cellSize = r >= 2 ? Vec3((bmax.x - bmin.x) / (r - 1), (bmax.y - bmin.y) / (r - 1),
+                                 (bmax.z - bmin.z) / (r - 1))
+                          : Vec3();
+        blocks.clear();
+        blocks.resize((size_t)perAxis * perAxis * perAxis);
+    }
+
+    void clear() { reset(0, Vec3(), Vec3()); }
+
+    bool valid() const { return !blocks.empty(); }
+
+    // Cached for the same grid?
+    bool matches(int r, Vec3 bmin, Vec3 bmax, float iso = 0.0f) const {
+        return valid() && res == r && isolevel == iso &&
+               boundsMin.x == bmin.x && boundsMin.y == bmin.y && boundsMin.z == bmin.z &&
+               boundsMax.x == bmax.x && boundsMax.y == bmax.y && boundsMax.z == bmax.z;
+    }
+
+    // Grid points [lo, lo + dims) read by block b
+    void blockRange(size_t b, int lo[3], int dims[3]) const {
+        int bc[3] = {(int)(b % perAxis), (int)((b / perAxis) % perAxis), (int)(b / ((size_t)perAxis * perAxis))};
+        for (int a = 0; a < 3; a++) {
+            lo[a] = bc[a] * MC_BLOCK_CELLS;
+            dims[a] = std::min(MC_BLOCK_CELLS, res - 1 - lo[a]) + 1;
+        }
+    }
+
+    // Mark every block with cells in the world-space box [lo, hi] dirty,
+    // plus a one-cell margin. Returns the number of blocks marked.
+    size_t invalidate(Vec3 lo, Vec3 hi) {
+        if (!valid()) return 0;
+        float l[3] = {(lo.x - boundsMin.x) / cellSize.x, (lo.y - boundsMin.y) / cellSize.y,
+                      (lo.z - boundsMin.z) / cellSize.z};
+        float h[3] = {(hi.x - boundsMin.x) / cellSize.x, (hi.y - boundsMin.y) / cellSize.y,
+                      (hi.z - boundsMin.z) / cellSize.z};
+        int b0[3], b1[3];
+        for (int a = 0; a < 3; a++) {
+            float c0 = std::max(std::floor(l[a]) - 1.0f, 0.0f);
+            float c1 = std::min(std::ceil(h[a]) + 1.0f, (float)(res - 2));
+            if (c1 < c0) return 0;
+            b0[a] = (int)c0 / MC_BLOCK_CELLS;
+            b1[a] = (int)c1 / MC_BLOCK_CELLS;
+        }
+        size_t count = 0;
+        for (int z = b0[2]; z <= b1[2]; z++)
+            for (int y = b0[1]; y <= b1[1]; y++)
+                for (int x = b0[0]; x <= b1[0]; x++) {
+                    Block& b = blocks[x + ((size_t)y + (size_t)z * perAxis) * perAxis];
+                    if (!b.dirty) count++;
+                    b.dirty = true;
+                }
+        return count;
+    }
+
+    size_t dirtyCount() const {
+        size_t n = 0;
+        for (const Block& b : blocks) n += b.dirty;
+        return n;
+    }
+
+    // Full build from Z slabs. fetchSlices(zStart, zCount, dst) fills dst
+    // with grid slices [zStart, zStart + zCount) (res*res floats each, x
+    // fastest), the signature of sdfx::sample_sdf_slices. One layer of
+    // blocks is resident at a time and meshed in parallel.
+    template<typename FetchSlicesFn>
+    bool rebuild(FetchSlicesFn&& fetchSlices) {
+        if (!valid()) return false;
+        size_t sliceSize = (size_t)res * res;
+        std::vector<float> slab(sliceSize * (MC_BLOCK_CELLS + 1));
+        ThreadPool& pool = ThreadPool::instance();
+        std::vector<SlabEdgeCache> caches(pool.size());
+        size_t layer = (size_t)perAxis * perAxis;
+
+        for (int bz = 0; bz < perAxis; bz++) {
+            int z0 = bz * MC_BLOCK_CELLS;
+            int zCount = std::min(MC_BLOCK_CELLS, res - 1 - z0) + 1;
+            if (!fetchSlices(z0, zCount, slab.data())) {
+                std::cerr << "Chunk cache: failed to fetch slices " << z0 << ".." << (z0 + zCount) << std::endl;
+                return false;
+            }
+            pool.parallelFor(layer, [&](size_t i, unsigned worker) {
+                size_t b = bz * layer + i;
+                int lo[3], dims[3];
+                blockRange(b, lo, dims);
+                const float* s = slab.data() + lo[0] + (size_t)lo[1] * res;
+                polygonizeBlock(s, res, sliceSize, lo, dims, res, boundsMin, cellSize, isolevel,
+                                caches[worker], blocks[b].mesh, blocks[b].seam);
+                blocks[b].dirty = false;
+            });
+        }
+        return true;
+    }
+
+    // Resample and re-mesh the dirty blocks. fetchBlock(lo, dims, dst) fills
+    // dst with grid points [lo, lo + dims) (x fastest). Dirty blocks are
+    // fetched MC_UPDATE_GROUP³ blocks at a time: one call covers the box
+    // around a group's dirty blocks, so an edit costs a few large fetches
+    // instead of one per block. Fetches run serially on the calling thread
+    // (they may drive the GPU); each group's blocks are meshed on the pool
+    // straight from the fetched box. fetches (optional) counts the calls.
+    template<typename FetchBlockFn>
+    bool update(FetchBlockFn&& fetchBlock, size_t* fetches = nullptr) {
+        const int G = MC_UPDATE_GROUP;
+        const int groups = (perAxis + G - 1) / G;
+        ThreadPool& pool = ThreadPool::instance();
+        std::vector<SlabEdgeCache> caches(pool.size());
+        std::vector<float> box;
+        std::vector<size_t> dirty;
+        if (fetches) *fetches = 0;
+
+        for (int gz = 0; gz < groups; gz++)
+        for (int gy = 0; gy < groups; gy++)
+        for (int gx = 0; gx < groups; gx++) {
+            int b0[3] = {perAxis, perAxis, perAxis}, b1[3] = {-1, -1, -1};
+            dirty.clear();
+            for (int z = gz * G; z < std::min((gz + 1) * G, perAxis); z++)
+                for (int y = gy * G; y < std::min((gy + 1) * G, perAxis); y++)
+                    for (int x = gx * G; x < std::min((gx + 1) * G, perAxis); x++) {
+                        size_t b = x + ((size_t)y + (size_t)z * perAxis) * perAxis;
+                        if (!blocks[b].dirty) continue;
+                        dirty.push_back(b);
+                        int bc[3] = {x, y, z};
+                        for (int a = 0; a < 3; a++) {
+                            b0[a] = std::min(b0[a], bc[a]);
+                            b1[a] = std::max(b1[a], bc[a]);
+                        }
+                    }
+            if (dirty.empty()) continue;
+
+            int lo[3], dims[3];
+            for (int a = 0; a < 3; a++) {
+                lo[a] = b0[a] * MC_BLOCK_CELLS;
+                dims[a] = std::min((b1[a] + 1) * MC_BLOCK_CELLS, res - 1) - lo[a] + 1;
+            }
+            box.resize((size_t)dims[0] * dims[1] * dims[2]);
+            if (!fetchBlock(lo, dims, box.data())) {
+                std::cerr << "Chunk cache: failed to fetch blocks " << b0[0] << "," << b0[1] << "," << b0[2]
+                          << " .. " << b1[0] << "," << b1[1] << "," << b1[2] << std::endl;
+                return false;
+            }
+            if (fetches) (*fetches)++;
+
+            const size_t sy = dims[0], sz = (size_t)dims[0] * dims[1];
+            pool.parallelFor(dirty.size(), [&](size_t i, unsigned worker) {
+                Block& block = blocks[dirty[i]];
+                int blo[3], bdims[3];
+                blockRange(dirty[i], blo, bdims);
+                const float* s = box.data() + (blo[0] - lo[0]) + (blo[1] - lo[1]) * sy + (blo[2] - lo[2]) * sz;
+                polygonizeBlock(s, sy, sz, blo, bdims, res, boundsMin, cellSize, isolevel,
+                                caches[worker], block.mesh, block.seam);
+                block.dirty = false;
+            });
+        }
+        return true;
+    }
+
+    // Stitch all blocks into one welded mesh, in block order
+    Mesh assemble() const { return assemble(blocks); }
+
+    static Mesh assemble(const std::vector<Block>& blocks) {
+        Mesh mesh;
+        size_t totalVertices = 0, totalIndices = 0, totalSeam = 0;
+        for (const Block& b : blocks) {
+            totalVertices += b.mesh.vertices.size();
+            totalIndices += b.mesh.indices.size();
+            totalSeam += b.seam.size();
+        }
+        mesh.vertices.reserve(totalVertices);
+        mesh.indices.resize(totalIndices);
+
+        std::unordered_map<uint64_t, uint32_t> seamVertex;
+        seamVertex.reserve(totalSeam);
+        std::vector<uint32_t> remap;
+        size_t indexBase = 0;
+        for (const Block& b : blocks) {
+            remap.resize(b.mesh.vertices.size());
+            size_t s = 0;
+            for (uint32_t v = 0; v < (uint32_t)b.mesh.vertices.size(); v++) {
+                if (s < b.seam.size() && b.seam[s].first == v) {
+                    auto it = seamVertex.emplace(b.seam[s++].second, (uint32_t)mesh.vertices.size());
+                    if (it.second) mesh.vertices.push_back(b.mesh.vertices[v]);
+                    remap[v] = it.first->second;
+                } else {
+                    remap[v] = (uint32_t)mesh.vertices.size();
+                    mesh.vertices.push_back(b.mesh.vertices[v]);
+                }
+            }
+            for (size_t i = 0; i < b.mesh.indices.size(); i++) {
+                mesh.indices[indexBase + i] = remap[b.mesh.indices[i]];
+            }
+            indexBase += b.mesh.indices.size();
+        }
+        return mesh;
+    }
+};
+
+// ============================================================================
+// BRICK MAP - narrow-band sparse grid
+// ============================================================================
+
+constexpr int BRICK_SIZE = 8;  // Grid points per brick edge
+constexpr int BRICK_SAMPLES = BRICK_SIZE * BRICK_SIZE * BRICK_SIZE;
+// Bricks whose samples are all further than this many cells from the surface
+// are dropped: a crossing cell's corners lie within sqrt(3) cells of it, and
+// the margin keeps central-difference gradients around them intact
+constexpr float BRICK_BAND_CELLS = 4.0f;
+// Bricks per axis requested per fetch in buildBrickMap (64³ points)
+constexpr int BRICK_FETCH_GROUP = 8;
+
+// Sparse res³ grid that only stores the narrow band around the surface.
+// Point (x, y, z) lives in brick (x, y, z) / BRICK_SIZE; a flat table of
+// bricksPerAxis³ entries holds each kept brick's slot in samples, or which
+// side of the surface a dropped brick is on. Dropped bricks and points
+// outside the grid read as +-farValue: no edge touching them crosses the
+// surface, so MC/DC output is the same as from the dense grid. That holds
+// for 1-Lipschitz fields only (|d| never exceeds the distance to the
+// surface: exact SDFs and their min/max), where every corner of a crossing
+// cell is within one cell diagonal of the surface, well inside the band.
+// Steeper fields (ellipsoid bounds, non-uniform scales) can put a crossing
+// between two dropped bricks and lose that piece of surface; widen
+// bandCells by the field's Lipschitz constant for those. At 2048³ the
+// table is 64 MB and a closed scene keeps a few hundred thousand 2 KB bricks
+// instead of a 32 GB dense grid.
+struct BrickMap {
+    static constexpr int32_t OUTSIDE = -1;
+    static constexpr int32_t INSIDE = -2;
+
+    int res = 0;
+    int bricksPerAxis = 0;
+    Vec3 boundsMin, boundsMax, cellSize;
+    float band = 0.0f;       // World-space half width of the kept band
+    float farValue = 0.0f;   // Magnitude read from dropped bricks
+    std::vector<int32_t> table;
+    std::vector<float> samples;  // BRICK_SAMPLES per kept brick, x fastest
+
+    void reset(int r, Vec3 bmin, Vec3 bmax, float bandCells = BRICK_BAND_CELLS) {
+        res = r;
+        boundsMin = bmin;
+        boundsMax = bmax;
+        bricksPerAxis = r >= 2 ? (r + BRICK_SIZE - 1) / BRICK_SIZE : 0;
+        cellSize = r >= 2 ? Vec3((bmax.x - bmin.x) / (r - 1), (bmax.y - bmin.y) / (r - 1),
+                                 (bmax.z - bmin.z) / (r - 1))
+                          : Vec3();
+        band = bandCells * std::max({cellSize.x, cellSize.y, cellSize.z});
+        farValue = band + cellSize.length() * BRICK_SIZE;
+        table.assign((size_t)bricksPerAxis * bricksPerAxis * bricksPerAxis, OUTSIDE);
+        samples.clear();
+    }
+
+    bool valid() const { return !table.empty(); }
+    size_t brickCount() const { return samples.size() / BRICK_SAMPLES; }
+    size_t byteSize() const { return table.size() * sizeof(int32_t) + samples.size() * sizeof(float); }
+
+    size_t brickIndex(int bx, int by, int bz) const {
+        return bx + ((size_t)by + (size_t)bz * bricksPerAxis) * bricksPerAxis;
+    }
+
+    // Centre of brick (bx, by, bz)'s points; the centres form a regular
+    // bricksPerAxis³ grid spanning [centerMin(), centerMax()]
+    Vec3 centerMin() const {
+        float c = (BRICK_SIZE - 1) * 0.5f;
+        return boundsMin + cellSize * c;
+    }
+    Vec3 centerMax() const {
+        float c = (float)((bricksPerAxis - 1) * BRICK_SIZE) + (BRICK_SIZE - 1) * 0.5f;
+        return boundsMin + Vec3(cellSize.x * c, cellSize.y * c, cellSize.z * c);
+    }
+
+    float at(int x, int y, int z) const {
+        if ((unsigned)x >= (unsigned)res || (unsigned)y >= (unsigned)res || (unsigned)z >= (unsigned)res) {
+            return farValue;
+        }
+        int32_t slot = table[brickIndex(x / BRICK_SIZE, y / BRICK_SIZE, z / BRICK_SIZE)];
+        if (slot < 0) return slot == INSIDE ? -farValue : farValue;
+        return samples[(size_t)slot * BRICK_SAMPLES + x % BRICK_SIZE +
+                       (y % BRICK_SIZE) * BRICK_SIZE + (z % BRICK_SIZE) * BRICK_SIZE * BRICK_SIZE];
+    }
+
+    // Central-difference gradient at grid point (x, y, z), one-sided at the
+    // grid faces like gridGradient
+    Vec3 gradient(int x, int y, int z) const {
+        int xm = x > 0, xp = x < res - 1;
+        int ym = y > 0, yp = y < res - 1;
+        int zm = z > 0, zp = z < res - 1;
+        return Vec3((at(x + xp, y, z) - at(x - xm, y, z)) / ((xp + xm) * cellSize.x),
+                    (at(x, y + yp, z) - at(x, y - ym, z)) / ((yp + ym) * cellSize.y),
+                    (at(x, y, z + zp) - at(x, y, z - zm)) / ((zp + zm) * cellSize.z));
+    }
+
+    // Copy grid points [lo, lo + dims) into dst (x fastest)
+    void extract(const int lo[3], const int dims[3], float* dst) const {
+        for (int z = 0; z < dims[2]; z++)
+            for (int y = 0; y < dims[1]; y++)
+                for (int x = 0; x < dims[0]; x++)
+                    *dst++ = at(lo[0] + x, lo[1] + y, lo[2] + z);
+    }
+
+    // Whether a brick with these samples has to be stored; otherwise side
+    // is set to the table value of the dropped brick
+    bool needsBrick(const float* brick, int32_t& side) const {
+        bool negative = brick[0] < 0.0f;
+        for (int i = 0; i < BRICK_SAMPLES; i++) {
+            if (std::fabs(brick[i]) <= band || (brick[i] < 0.0f) != negative) return true;
+        }
+        side = negative ? INSIDE : OUTSIDE;
+        return false;
+    }
+};
+
+// Narrow-band brick map from a dense grid (PARALLEL over brick layers)
+inline BrickMap buildBrickMap(const std::vector<float>& distances, int res, Vec3 bounds_min, Vec3 bounds_max,
+                              float bandCells = BRICK_BAND_CELLS) {
+    BrickMap map;
+    map.reset(res, bounds_min, bounds_max, bandCells);
+    int nb = map.bricksPerAxis;
+    size_t layer = (size_t)nb * nb;
+    std::vector<float> staged(layer * BRICK_SAMPLES);
+    std::vector<uint8_t> keep(layer);
+
+    for (int bz = 0; bz < nb; bz++) {
+        ThreadPool::instance().parallelFor(layer, [&](size_t i, unsigned) {
+            int bx = (int)(i % nb), by = (int)(i / nb);
+            int lo[3] = {bx * BRICK_SIZE, by * BRICK_SIZE, bz * BRICK_SIZE};
+            float* brick = &staged[i * BRICK_SAMPLES];
+            for (int z = 0; z < BRICK_SIZE; z++)
+                for (int y = 0; y < BRICK_SIZE; y++)
+                    for (int x = 0; x < BRICK_SIZE; x++) {
+                        int p[3] = {std::min(lo[0] + x, res - 1), std::min(lo[1] + y, res - 1),
+                                    std::min(lo[2] + z, res - 1)};
+                        *brick++ = distances[p[0] + (size_t)p[1] * res + (size_t)p[2] * res * res];
+                    }
+            int32_t side = BrickMap::OUTSIDE;
+            keep[i] = map.needsBrick(&staged[i * BRICK_SAMPLES], side);
+            if (!keep[i]) map.table[map.brickIndex(bx, by, bz)] = side;
+        });
+        for (size_t i = 0; i < layer; i++) {
+            if (!keep[i]) continue;
+            map.table[bz * layer + i] = (int32_t)map.brickCount();
+            map.samples.insert(map.samples.end(), &staged[i * BRICK_SAMPLES], &staged[(i + 1) * BRICK_SAMPLES]);
+        }
+    }
+    return map;
+}
+
+// Sample the candidate bricks of a reset map; every other brick must already
+// hold its side (BrickMap::OUTSIDE / INSIDE) in map.table. Candidates are
+// kept if any of their samples reaches the band. Meshing the result matches
+// the dense grid only for 1-Lipschitz fields (see BrickMap).
+// fetchBlock(lo, dims, dst): fill dst with grid points [lo, lo + dims)
+//          (x fastest), the signature MeshChunkCache::update uses. Called
+//          serially for each BRICK_FETCH_GROUP³ group of bricks holding a
+//          candidate; points may lie past res - 1 and are discarded.
+template<typename FetchBlockFn>
+inline bool fillBrickMap(BrickMap& map, const std::vector<uint8_t>& candidate, FetchBlockFn&& fetchBlock) {
+    auto start = std::chrono::high_resolution_clock::now();
+    int nb = map.bricksPerAxis;
+    if (candidate.size() != map.table.size()) return false;
+    size_t candidates = 0;
+    for (uint8_t c : candidate) candidates += c;
+    map.samples.clear();
+    map.samples.reserve(candidates * BRICK_SAMPLES);
+
+    const int G = BRICK_FETCH_GROUP;
+    int groups = (nb + G - 1) / G;
+    const int groupPoints = G * BRICK_SIZE;
+    std::vector<float> block((size_t)groupPoints * groupPoints * groupPoints);
+    std::vector<float> staged((size_t)G * G * G * BRICK_SAMPLES);
+    std::vector<uint8_t> keep(G * G * G);
+    size_t fetched = 0;
+
+    for (int gz = 0; gz < groups; gz++)
+    for (int gy = 0; gy < groups; gy++)
+    for (int gx = 0; gx < groups; gx++) {
+        int b0[3] = {gx * G, gy * G, gz * G};
+        int n[3] = {std::min(G, nb - b0[0]), std::min(G, nb - b0[1]), std::min(G, nb - b0[2])};
+        bool any = false;
+        for (int z = 0; z < n[2] && !any; z++)
+            for (int y = 0; y < n[1] && !any; y++)
+                for (int x = 0; x < n[0] && !any; x++)
+                    any = candidate[map.brickIndex(b0[0] + x, b0[1] + y, b0[2] + z)];
+        if (!any) continue;
+
+        int lo[3] = {b0[0] * BRICK_SIZE, b0[1] * BRICK_SIZE, b0[2] * BRICK_SIZE};
+        int dims[3] = {n[0] * BRICK_SIZE, n[1] * BRICK_SIZE, n[2] * BRICK_SIZE};
+        if (!fetchBlock(lo, dims, block.data())) {
+            std::cerr << "Brick map: failed to fetch bricks at " << b0[0] << "," << b0[1] << "," << b0[2] << std::endl;
+            return false;
+        }
+        fetched++;
+
+        size_t count = (size_t)n[0] * n[1] * n[2];
+        ThreadPool::instance().parallelFor(count, [&](size_t i, unsigned) {
+            int bx = (int)(i % n[0]), by = (int)((i / n[0]) % n[1]), bz = (int)(i / ((size_t)n[0] * n[1]));
+            size_t b = map.brickIndex(b0[0] + bx, b0[1] + by, b0[2] + bz);
+            keep[i] = 0;
+            if (!candidate[b]) return;
+            float* brick = &staged[i * BRICK_SAMPLES];
+            for (int z = 0; z < BRICK_SIZE; z++)
+                for (int y = 0; y < BRICK_SIZE; y++) {
+                    size_t row = (size_t)(bx * BRICK_SIZE) + (size_t)(by * BRICK_SIZE + y) * dims[0] +
+                                 (size_t)(bz * BRICK_SIZE + z) * dims[0] * dims[1];
+                    memcpy(brick + (z * BRICK_SIZE + y) * BRICK_SIZE, &block[row], BRICK_SIZE * sizeof(float));
+                }
+            int32_t side = BrickMap::OUTSIDE;
+            keep[i] = map.needsBrick(brick, side);
+            if (!keep[i]) map.table[b] = side;
+        });
+        // Slots in brick order, so the map does not depend on the thread count
+        for (size_t i = 0; i < count; i++) {
+            if (!keep[i]) continue;
+            int bx = (int)(i % n[0]), by = (int)((i / n[0]) % n[1]), bz = (int)(i / ((size_t)n[0] * n[1]));
+            map.table[map.brickIndex(b0[0] + bx, b0[1] + by, b0[2] + bz)] = (int32_t)map.brickCount();
+            map.samples.insert(map.samples.end(), &staged[i * BRICK_SAMPLES], &staged[(i + 1) * BRICK_SAMPLES]);
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    size_t res = map.res;
+    std::cout << "Brick map " << res << "³: " << map.brickCount() << "/" << map.table.size() << " bricks kept ("
+              << candidates << " candidates, " << fetched << " fetches), "
+              << map.byteSize() / (1024 * 1024) << " MB vs "
+              << res * res * res * sizeof(float) / (1024 * 1024) << " MB dense, "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+    return true;
+}
+
+// Narrow-band brick map sampled sparsely, never holding the dense grid.
+// centers: SDF at the bricksPerAxis³ brick centres (see BrickMap::centerMin);
+//          a brick is kept when |centre| <= band + lipschitz * half its
+//          diagonal, the furthest a field with |grad d| <= lipschitz can
+//          fall between the centre and a point in the band. Other bricks
+//          are classified from the centre's sign alone, so an understated
+//          lipschitz drops surface (thin features first).
+// fetchBlock: see fillBrickMap
+// Pass bandCells already scaled by lipschitz (see BrickMap).
+template<typename FetchBlockFn>
+inline BrickMap buildBrickMap(int res, Vec3 bounds_min, Vec3 bounds_max, const std::vector<float>& centers,
+                              FetchBlockFn&& fetchBlock, float bandCells = BRICK_BAND_CELLS,
+                              float lipschitz = 1.0f) {
+    BrickMap map;
+    map.reset(res, bounds_min, bounds_max, bandCells);
+    if (centers.size() != map.table.size()) return BrickMap();
+
+    float reach = map.band + lipschitz * map.cellSize.length() * (BRICK_SIZE - 1) * 0.5f;
+    std::vector<uint8_t> candidate(map.table.size());
+    for (size_t b = 0; b < centers.size(); b++) {
+        candidate[b] = std::fabs(centers[b]) <= reach;
+        if (!candidate[b]) map.table[b] = centers[b] < 0.0f ? BrickMap::INSIDE : BrickMap::OUTSIDE;
+    }
+    if (!fillBrickMap(map, candidate, fetchBlock)) return BrickMap();
+    return map;
+}
+
+// Welded marching cubes straight from a brick map: every kept brick's cells
+// are polygonised as one block (polygonizeBlock) and the blocks are stitched
+// through their global edge keys, like MeshChunkCache. A crossing cell has
+// all its corners inside the band, so dropped bricks hold no surface; the
+// result is the same surface as generateMesh(..., weldVertices=true) on the
+// dense grid, for 1-Lipschitz fields (see BrickMap). The band is measured
+// around 0, so keep isolevel well inside it.
+inline Mesh generateMeshBricks(const BrickMap& map, float isolevel = 0.0f) {
+    if (!map.valid()) return Mesh();
+
+    int nb = map.bricksPerAxis;
+    std::vector<size_t> active;
+    for (size_t b = 0; b < map.table.size(); b++) {
+        if (map.table[b] >= 0) active.push_back(b);
+    }
+
+    ThreadPool& pool = ThreadPool::instance();
+    std::vector<SlabEdgeCache> caches(pool.size());
+    std::vector<std::vector<float>> scratch(pool.size());
+    std::vector<MeshChunkCache::Block> blocks(active.size());
+
+    pool.parallelFor(active.size(), [&](size_t i, unsigned worker) {
+        size_t b = active[i];
+        int bc[3] = {(int)(b % nb), (int)((b / nb) % nb), (int)(b / ((size_t)nb * nb))};
+        int lo[3], dims[3];
+        for (int a = 0; a < 3; a++) {
+            lo[a] = bc[a] * BRICK_SIZE;
+            dims[a] = std::max(std::min(BRICK_SIZE, map.res - 1 - lo[a]), 0) + 1;
+        }
+        std::vector<float>& s = scratch[worker];
+        s.resize((size_t)dims[0] * dims[1] * dims[2]);
+        map.extract(lo, dims, s.data());
+        polygonizeBlock(s.data(), dims[0], (size_t)dims[0] * dims[1], lo, dims, map.res,
+                        map.boundsMin, map.cellSize, isolevel, caches[worker],
+                        blocks[i].mesh, blocks[i].seam);
+    });
+
+    return MeshChunkCache::assemble(blocks);
+}
+
+// Vertex normals from a brick map: the grid-point gradients of each
+// vertex's cell, trilinearly blended at the vertex. Vertices of
+// generateMeshBricks lie in crossing cells, whose corners and their
+// neighbours are all inside the band. (PARALLEL)
+inline void computeBrickMapNormals(const BrickMap& map, Mesh& mesh) {
+    mesh.normals.resize(mesh.vertices.size());
+    if (map.res < 2) return;
+    const size_t CHUNK = 4096;
+    ThreadPool::instance().parallelFor((mesh.vertices.size() + CHUNK - 1) / CHUNK, [&](size_t c, unsigned) {
+        size_t end = std::min(mesh.vertices.size(), (c + 1) * CHUNK);
+        for (size_t v = c * CHUNK; v < end; v++) {
+            Vec3 u = mesh.vertices[v] - map.boundsMin;
+            float f[3] = {u.x / map.cellSize.x, u.y / map.cellSize.y, u.z / map.cellSize.z};
+            int i[3];
+            for (int a = 0; a < 3; a++) {
+                i[a] = std::min(std::max((int)std::floor(f[a]), 0), map.res - 2);
+                f[a] = std::min(std::max(f[a] - i[a], 0.0f), 1.0f);
+            }
+            Vec3 n(0, 0, 0);
+            for (int k = 0; k < 8; k++) {
+                int dx = k & 1, dy = (k >> 1) & 1, dz = k >> 2;
+                float w = (dx ? f[0] : 1 - f[0]) * (dy ? f[1] : 1 - f[1]) * (dz ? f[2] : 1 - f[2]);
+                n = n + map.gradient(i[0] + dx, i[1] + dy, i[2] + dz) * w;
+            }
+            mesh.normals[v] = n.normalized();
+        }
+    });
+}
+
+// ============================================================================
+// LOD PYRAMID - coarser grids by min-pooling one sampled grid
+// ============================================================================
+
+// Halve a grid: coarse point i is the minimum of the fine points 2i-1..2i+1
+// on each axis, so the spacing doubles and thin features survive (min-pooling
+// only ever grows the solid). Coarse resolution is (res - 1) / 2 + 1; when
+// res - 1 is odd the last fine cell is dropped. (PARALLEL over Z)
+inline int downsampleGridMin(const std::vector<float>& fine, int res, std::vector<float>& coarse) {
+    int cres = (res - 1) / 2 + 1;
+    size_t fy = (size_t)res, fz = (size_t)res * res;
+    size_t cy = (size_t)cres, cz = (size_t)cres * cres;
+    coarse.resize(cz * cres);
+
+    ThreadPool::instance().parallelFor((size_t)cres, [&](size_t z, unsigned) {
+        int z0 = std::max(0, 2 * (int)z - 1), z1 = std::min(res - 1, 2 * (int)z + 1);
+        for (int y = 0; y < cres; y++) {
+            int y0 = std::max(0, 2 * y - 1), y1 = std::min(res - 1, 2 * y + 1);
+            float* dst = &coarse[z * cz + y * cy];
+            for (int x = 0; x < cres; x++) {
+                int x0 = std::max(0, 2 * x - 1), x1 = std::min(res - 1, 2 * x + 1);
+                float m = FLT_MAX;
+                for (int k = z0; k <= z1; k++)
+                    for (int j = y0; j <= y1; j++) {
+                        const float* row = &fine[k * fz + j * fy];
+                        for (int i = x0; i <= x1; i++) m = std::min(m, row[i]);
+                    }
+                dst[x] = m;
+            }
+        }
+    });
+    return cres;
+}
+
+// One level of a grid pyramid: samples, resolution and the bounds its
+// corner points span
+struct GridLevel {
+    std::vector<float> distances;
+    int res = 0;
+    Vec3 boundsMin, boundsMax;
+};
+
+// Levels [1, levels) of the pyramid above a full-resolution grid (level 0
+// is the input itself and is not copied). Stops early below 4³ points.
+inline std::vector<GridLevel> buildGridPyramid(const std::vector<float>& distances, int res,
+                                               Vec3 bounds_min, Vec3 bounds_max, int levels) {
+    std::vector<GridLevel> pyramid;
+    pyramid.reserve(std::max(levels - 1, 0));  // src points into it
+    Vec3 cell = {(bounds_max.x - bounds_min.x) / (res - 1),
+                 (bounds_max.y - bounds_min.y) / (res - 1),
+                 (bounds_max.z - bounds_min.z) / (res - 1)};
+    const std::vector<float>* src = &distances;
+    int srcRes = res;
+    for (int level = 1; level < levels && srcRes >= 7; level++) {
+        pyramid.emplace_back();
+        GridLevel& l = pyramid.back();
+        l.res = downsampleGridMin(*src, srcRes, l.distances);
+        cell = cell * 2.0f;
+        l.boundsMin = bounds_min;
+        l.boundsMax = bounds_min + cell * (float)(l.res - 1);
+        src = &l.distances;
+        srcRes = l.res;
+    }
+    return pyramid;
+}
+
+// Band, in fine cells, a brick map needs so that buildBrickPyramid's levels
+// [1, levels) mesh like the dense pyramid: level k's crossing corners and
+// their gradient neighbours lie within 2 * 2^k fine cells of its surface
+inline float brickPyramidBandCells(int levels) {
+    return std::max(BRICK_BAND_CELLS, (float)(1 << std::min(std::max(levels, 1), 16)));
+}
+
+// Halve a brick map the way downsampleGridMin halves a dense grid. Coarse
+// bricks overlapping a kept fine brick are pooled from it through
+// fillBrickMap; the rest are classified from the fine table (inside if any
+// fine brick under them is). The coarse band is the fine band in world
+// units, i.e. half as many cells.
+inline BrickMap downsampleBrickMapMin(const BrickMap& fine) {
+    BrickMap coarse;
+    if (!fine.valid() || fine.res < 3) return coarse;
+    int cres = (fine.res - 1) / 2 + 1;
+    Vec3 cell = fine.cellSize * 2.0f;
+    coarse.reset(cres, fine.boundsMin, fine.boundsMin + cell * (float)(cres - 1),
+                 fine.band / std::max({cell.x, cell.y, cell.z}));
+
+    int nb = coarse.bricksPerAxis, fnb = fine.bricksPerAxis;
+    std::vector<uint8_t> candidate(coarse.table.size());
+    ThreadPool::instance().parallelFor((size_t)nb, [&](size_t bz, unsigned) {
+        for (int by = 0; by < nb; by++)
+        for (int bx = 0; bx < nb; bx++) {
+            int bc[3] = {bx, by, (int)bz}, f0[3], f1[3];
+            for (int a = 0; a < 3; a++) {
+                f0[a] = std::max(0, 2 * bc[a] * BRICK_SIZE - 1) / BRICK_SIZE;
+                f1[a] = std::min(fnb - 1, (2 * (bc[a] + 1) * BRICK_SIZE - 1) / BRICK_SIZE);
+            }
+            bool kept = false, inside = false;
+            for (int z = f0[2]; z <= f1[2]; z++)
+                for (int y = f0[1]; y <= f1[1]; y++)
+                    for (int x = f0[0]; x <= f1[0]; x++) {
+                        int32_t slot = fine.table[fine.brickIndex(x, y, z)];
+                        kept = kept || slot >= 0;
+                        inside = inside || slot == BrickMap::INSIDE;
+                    }
+            size_t b = coarse.brickIndex(bx, by, (int)bz);
+            candidate[b] = kept;
+            if (!kept) coarse.table[b] = inside ? BrickMap::INSIDE : BrickMap::OUTSIDE;
+        }
+    });
+
+    int res = fine.res;
+    bool ok = fillBrickMap(coarse, candidate, [&](const int lo[3], const int dims[3], float* dst) {
+        ThreadPool::instance().parallelFor((size_t)dims[2], [&](size_t k, unsigned) {
+            int z = std::min(lo[2] + (int)k, cres - 1);
+            int z0 = std::max(0, 2 * z - 1), z1 = std::min(res - 1, 2 * z + 1);
+            float* out = dst + k * dims[0] * dims[1];
+            for (int j = 0; j < dims[1]; j++) {
+                int y = std::min(lo[1] + j, cres - 1);
+                int y0 = std::max(0, 2 * y - 1), y1 = std::min(res - 1, 2 * y + 1);
+                for (int i = 0; i < dims[0]; i++) {
+                    int x = std::min(lo[0] + i, cres - 1);
+                    int x0 = std::max(0, 2 * x - 1), x1 = std::min(res - 1, 2 * x + 1);
+                    float m = FLT_MAX;
+                    for (int fz = z0; fz <= z1; fz++)
+                        for (int fy = y0; fy <= y1; fy++)
+                            for (int fx = x0; fx <= x1; fx++) m = std::min(m, fine.at(fx, fy, fz));
+                    *out++ = m;
+                }
+            }
+        });
+        return true;
+    });
+    return ok ? coarse : BrickMap();
+}
+
+// Levels [1, levels) of the pyramid above a brick map, like buildGridPyramid
+// but never dense. Sample the map with brickPyramidBandCells(levels) for the
+// levels to match the dense pyramid's meshes (1-Lipschitz SDFs).
+inline std::vector<BrickMap> buildBrickPyramid(const BrickMap& map, int levels) {
+    std::vector<BrickMap> pyramid;
+    const BrickMap* src = &map;
+    pyramid.reserve(std::max(levels - 1, 0));  // src points into it
+    for (int level = 1; level < levels && src->res >= 7; level++) {
+        pyramid.push_back(downsampleBrickMapMin(*src));
+        if (!pyramid.back().valid()) {
+            pyramid.pop_back();
+            break;
+        }
+        src = &pyramid.back();
+    }
+    return pyramid;
+}
+
+// Welded MC meshes of a grid and its min-pooled pyramid: full, 1/2, 1/4 ...
+// resolution from one sampling pass, finest first (see exportGLB for LODs).
+// Normals come from the grid gradient of each level.
+inline std::vector<Mesh> generateMeshLODs(
+    const std::vector<float>& distances,
+    int res,
+    Vec3 bounds_min,
+    Vec3 bounds_max,
+    int levels = 4,
+    float isolevel = 0.0f,
+    MeshArena* arena = nullptr
+) {
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<Mesh> lods;
+    lods.push_back(generateMesh(distances, res, bounds_min, bounds_max, isolevel, true, arena, true));
+    for (const GridLevel& l : buildGridPyramid(distances, res, bounds_min, bounds_max, levels)) {
+        lods.push_back(generateMesh(l.distances, l.res, l.boundsMin, l.boundsMax, isolevel, true, arena, true));
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "MC LODs:";
+    for (const Mesh& m : lods) std::cout << " " << m.indices.size() / 3;
+    std::cout << " triangles in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+    return lods;
+}
+
+// Same LOD chain from a brick map and its brick pyramid, so no level is ever
+// held dense. With a map sampled at brickPyramidBandCells(levels) the
+// triangles match the dense version; normals are blended grid gradients
+// (computeBrickMapNormals) instead of per-edge ones.
+inline std::vector<Mesh> generateMeshLODs(const BrickMap& map, int levels = 4, float isolevel = 0.0f) {
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<Mesh> lods;
+    auto add = [&](const BrickMap& level) {
+        lods.push_back(generateMeshBricks(level, isolevel));
+        computeBrickMapNormals(level, lods.back());
+    };
+    add(map);
+    size_t bytes = 0;
+    for (const BrickMap& level : buildBrickPyramid(map, levels)) {
+        add(level);
+        bytes += level.byteSize();
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "MC LODs (bricks, pyramid " << bytes / (1024 * 1024) << " MB):";
+    for (const Mesh& m : lods) std::cout << " " << m.indices.size() / 3;
+    std::cout << " triangles in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+    return lods;
+}
+
+// Compute normals from triangle geometry: area-weighted face normals,
+// accumulated per vertex. Every mesher here emits MC winding (clockwise seen
+// from outside, flipped only by the file exporters), so the face normal is
+// (v2-v0)×(v1-v0) and points out of the surface like the SDF gradient.
+inline void computeNormals(const std::vector<Vec3>& vertices, const std::vector<uint32_t>& indices,
+                           std::vector<Vec3>& normals) {
+    normals.assign(vertices.size(), Vec3(0, 0, 0));
+
+    // Compute face normals and accumulate at vertices
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        uint32_t i0 = indices[i];
+        uint32_t i1 = indices[i+1];
+        uint32_t i2 = indices[i+2];
+
+        Vec3 v0 = vertices[i0];
+        Vec3 v1 = vertices[i1];
+        Vec3 v2 = vertices[i2];
+
+        Vec3 e1 = v1 - v0;
+        Vec3 e2 = v2 - v0;
+        Vec3 normal = e2.cross(e1);
+
+        normals[i0] = normals[i0] + normal;
+        normals[i1] = normals[i1] + normal;
+        normals[i2] = normals[i2] + normal;
+    }
+
+    // Normalize
+    for (auto& n : normals) {
+        n = n.normalized();
+    }
+}
+
+inline void computeNormals(Mesh& mesh) {
+    computeNormals(mesh.vertices, mesh.indices, mesh.normals);
+}
+
+// Compute triplanar UVs from positions and normals
+inline void computeUVs(Mesh& mesh, float scale = 10.0f) {
+    if (!mesh.hasNormals()) {
+        computeNormals(mesh);
+    }
+
+    mesh.uvs.resize(mesh.vertices.size());
+    for (size_t i = 0; i < mesh.vertices.size(); i++) {
+        mesh.uvs[i] = triplanarUV(mesh.vertices[i], mesh.normals[i], scale);
+    }
+}
+
+// Set uniform vertex color
+inline void setUniformColor(Mesh& mesh, float r, float g, float b) {
+    mesh.colors.resize(mesh.vertices.size(), Color3(r, g, b));
+}
+
+// Set colors from external color array (e.g., from GPU sampling)
+inline void setColors(Mesh& mesh, const std::vector<Color3>& colors) {
+    if (colors.size() == mesh.vertices.size()) {
+        mesh.colors = colors;
+    }
+}
+
+// ============================================================================
+// MESH SIMPLIFICATION - parallel quadric error metric edge collapse
+// ============================================================================
+
+// Sum of squared distances to a set of planes (Garland-Heckbert quadric):
+// E(p) = pᵀAp + 2b·p + c. planes counts the surface planes so the error can
+// be read back as a mean squared distance.
+struct Quadric {
+    double a00 = 0, a01 = 0, a02 = 0, a11 = 0, a12 = 0, a22 = 0;
+    double b0 = 0, b1 = 0, b2 = 0, c = 0;
+    double planes = 0;
+
+    // Plane n·p + d = 0 (n unit length) with weight w
+    void addPlane(const Vec3& n, double d, double w, bool surface = true) {
+        a00 += w * n.x * n.x; a01 += w * n.x * n.y; a02 += w * n.x * n.z;
+        a11 += w * n.y * n.y; a12 += w * n.y * n.z; a22 += w * n.z * n.z;
+        b0 += w * d * n.x; b1 += w * d * n.y; b2 += w * d * n.z;
+        c += w * d * d;
+        if (surface) planes += 1;
+    }
+
+    Quadric& operator+=(const Quadric& o) {
+        a00 += o.a00; a01 += o.a01; a02 += o.a02; a11 += o.a11; a12 += o.a12; a22 += o.a22;
+        b0 += o.b0; b1 += o.b1; b2 += o.b2; c += o.c; planes += o.planes;
+        return *this;
+    }
+
+    double error(const Vec3& p) const {
+        double x = p.x, y = p.y, z = p.z;
+        double e = x * (a00 * x + 2 * (a01 * y + a02 * z + b0))
+                 + y * (a11 * y + 2 * (a12 * z + b1))
+                 + z * (a22 * z + 2 * b2) + c;
+        return std::max(e, 0.0);
+    }
+
+    // Point of least error, false when A is (near) singular
+    bool minimizer(Vec3& p) const {
+        double c00 = a11 * a22 - a12 * a12;
+        double c01 = a02 * a12 - a01 * a22;
+        double c02 = a01 * a12 - a02 * a11;
+        double det = a00 * c00 + a01 * c01 + a02 * c02;
+        double trace = a00 + a11 + a22;
+        if (std::abs(det) <= 1e-6 * trace * trace * trace) return false;
+        double c11 = a00 * a22 - a02 * a02;
+        double c12 = a01 * a02 - a00 * a12;
+        double c22 = a00 * a11 - a01 * a01;
+        double inv = -1.0 / det;
+        p = Vec3((float)(inv * (c00 * b0 + c01 * b1 + c02 * b2)),
+                 (float)(inv * (c01 * b0 + c11 * b1 + c12 * b2)),
+                 (float)(inv * (c02 * b0 + c12 * b1 + c22 * b2)));
+        return true;
+    }
+};
+
+constexpr int SIMPLIFY_MAX_PASSES = 32;
+constexpr size_t SIMPLIFY_CELL_VERTICES = 16384;  // Target vertices per partition cell
+constexpr double SIMPLIFY_BORDER_WEIGHT = 10.0;   // Keeps open borders in place
+
+// Quadric-error edge-collapse simplification (PARALLEL)
+// targetTriangles: stop once the mesh is down to this many triangles
+// maxError: never collapse an edge that moves the surface by more than this
+//           (RMS distance to the original planes, world units)
+// The mesh must be indexed with shared vertices (welded MC, DC). Normals,
+// colors and UVs are interpolated along each collapsed edge.
+// Works in passes. Each pass buckets the vertices into a grid of cells that
+// are simplified independently on the pool: only edges whose triangles all
+// lie inside one cell may collapse, so cells never touch each other's data,
+// and every vertex takes part in at most one collapse, so the adjacency
+// built at the start of the pass stays exact. The grid shifts every pass so
+// the previous pass's frozen cell borders become interior. The result does
+// not depend on the thread count.
+inline Mesh simplifyMesh(const Mesh& mesh, size_t targetTriangles, float maxError = FLT_MAX) {
+    constexpr uint32_t NONE = 0xFFFFFFFFu;
+    const size_t numVertices = mesh.vertices.size();
+    const size_t numTriangles = mesh.indices.size() / 3;
+    if (numTriangles <= targetTriangles || numVertices == 0) return mesh;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    ThreadPool& pool = ThreadPool::instance();
+    const bool hasNormals = mesh.hasNormals(), hasColors = mesh.hasColors(), hasUVs = mesh.hasUVs();
+    const size_t CHUNK = 4096;
+    const size_t vertexChunks = (numVertices + CHUNK - 1) / CHUNK;
+
+    std::vector<Vec3> pos = mesh.vertices;
+    std::vector<Vec3> normals = hasNormals ? mesh.normals : std::vector<Vec3>();
+    std::vector<Color3> colors = hasColors ? mesh.colors : std::vector<Color3>();
+    std::vector<Vec2> uvs = hasUVs ? mesh.uvs : std::vector<Vec2>();
+    std::vector<uint32_t> tri(mesh.indices.begin(), mesh.indices.begin() + numTriangles * 3);
+    std::vector<uint8_t> triAlive(numTriangles, 1);
+    size_t aliveTriangles = 0;
+    for (size_t t = 0; t < numTriangles; t++) {
+        uint32_t a = tri[3*t], b = tri[3*t+1], c = tri[3*t+2];
+        if (a == b || b == c || a == c) triAlive[t] = 0;
+        else aliveTriangles++;
+    }
+
+    // Vertex -> alive triangles (CSR), rebuilt every pass. Collapses rewrite
+    // triangle indices in place, so the lists of untouched vertices stay exact.
+    std::vector<uint32_t> adjStart(numVertices + 1), adj, cursor;
+    auto buildAdjacency = [&]() {
+        std::fill(adjStart.begin(), adjStart.end(), 0);
+        for (size_t t = 0; t < numTriangles; t++) {
+            if (!triAlive[t]) continue;
+            for (int k = 0; k < 3; k++) adjStart[tri[3*t+k] + 1]++;
+        }
+        for (size_t v = 0; v < numVertices; v++) adjStart[v + 1] += adjStart[v];
+        adj.resize(adjStart[numVertices]);
+        cursor.assign(adjStart.begin(), adjStart.end() - 1);
+        for (size_t t = 0; t < numTriangles; t++) {
+            if (!triAlive[t]) continue;
+            for (int k = 0; k < 3; k++) adj[cursor[tri[3*t+k]]++] = (uint32_t)t;
+        }
+    };
+    auto forEachTriangle = [&](uint32_t v, auto&& fn) {
+        for (uint32_t i = adjStart[v]; i < adjStart[v + 1]; i++) {
+            if (triAlive[adj[i]]) fn(adj[i]);
+        }
+    };
+    auto triangleNormal = [&](uint32_t t, uint32_t replace, const Vec3& with) {
+        Vec3 p[3];
+        for (int k = 0; k < 3; k++) p[k] = tri[3*t+k] == replace ? with : pos[tri[3*t+k]];
+        return (p[1] - p[0]).cross(p[2] - p[0]);
+    };
+    buildAdjacency();
+
+    // Quadrics: planes of the incident triangles, plus a heavy plane through
+    // each open border edge perpendicular to its triangle
+    std::vector<Quadric> quadric(numVertices);
+    pool.parallelFor(vertexChunks, [&](size_t chunk, unsigned) {
+        std::vector<std::pair<uint32_t, uint32_t>> edges;  // (other vertex, triangle)
+        size_t end = std::min(numVertices, (chunk + 1) * CHUNK);
+        for (uint32_t v = (uint32_t)(chunk * CHUNK); v < end; v++) {
+            edges.clear();
+            forEachTriangle(v, [&](uint32_t t) {
+                Vec3 n = triangleNormal(t, NONE, Vec3());
+                float len = n.length();
+                if (len > 0.0f) {
+                    n = n * (1.0f / len);
+                    quadric[v].addPlane(n, -n.dot(pos[tri[3*t]]), 1.0);
+                }
+                for (int k = 0; k < 3; k++) {
+                    if (tri[3*t+k] != v) edges.push_back({tri[3*t+k], t});
+                }
+            });
+            std::sort(edges.begin(), edges.end());
+            for (size_t i = 0; i < edges.size(); i++) {
+                bool shared = (i > 0 && edges[i-1].first == edges[i].first) ||
+                              (i + 1 < edges.size() && edges[i+1].first == edges[i].first);
+                if (shared) continue;
+                Vec3 n = (pos[edges[i].first] - pos[v]).cross(triangleNormal(edges[i].second, NONE, Vec3()));
+                float len = n.length();
+                if (len <= 0.0f) continue;
+                n = n * (1.0f / len);
+                quadric[v].addPlane(n, -n.dot(pos[v]), SIMPLIFY_BORDER_WEIGHT, false);
+            }
+        }
+    });
+
+    Vec3 bmin(FLT_MAX, FLT_MAX, FLT_MAX), bmax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (const Vec3& p : pos) {
+        bmin = Vec3(std::min(bmin.x, p.x), std::min(bmin.y, p.y), std::min(bmin.z, p.z));
+        bmax = Vec3(std::max(bmax.x, p.x), std::max(bmax.y, p.y), std::max(bmax.z, p.z));
+    }
+    const Vec3 extent = bmax - bmin;
+    const double maxErrorSq = maxError < FLT_MAX ? (double)maxError * maxError : DBL_MAX;
+
+    std::vector<uint32_t> cellOf(numVertices);
+    std::vector<uint8_t> frozen(numVertices), locked(numVertices);
+    std::vector<uint32_t> cellStart, cellVertices;
+    std::vector<size_t> cellTriangles, cellRemoved;
+    int passes = 0;
+
+    for (int pass = 0; pass < SIMPLIFY_MAX_PASSES && aliveTriangles > targetTriangles; pass++) {
+        passes++;
+        if (pass > 0) buildAdjacency();
+        size_t usedVertices = 0;
+        for (size_t v = 0; v < numVertices; v++) usedVertices += adjStart[v + 1] > adjStart[v];
+        int perAxis = std::max(1, std::min(32, (int)std::cbrt((double)usedVertices / SIMPLIFY_CELL_VERTICES)));
+        float shift = (float)std::fmod(pass * 0.618034, 1.0);
+        int cellsPerAxis = perAxis + 1;
+        size_t numCells = (size_t)cellsPerAxis * cellsPerAxis * cellsPerAxis;
+        auto cellCoord = [&](float p, float lo, float ext) {
+            float f = ext > 0.0f ? (p - lo) / ext * perAxis + shift : 0.0f;
+            return std::max(0, std::min(perAxis, (int)f));
+        };
+
+        // Assign cells, then freeze every vertex with a triangle leaving its cell
+        pool.parallelFor(vertexChunks, [&](size_t chunk, unsigned) {
+            size_t end = std::min(numVertices, (chunk + 1) * CHUNK);
+            for (size_t v = chunk * CHUNK; v < end; v++) {
+                const Vec3& p = pos[v];
+                cellOf[v] = (uint32_t)(cellCoord(p.x, bmin.x, extent.x) +
+                            ((size_t)cellCoord(p.y, bmin.y, extent.y) +
+                             (size_t)cellCoord(p.z, bmin.z, extent.z) * cellsPerAxis) * cellsPerAxis);
+                locked[v] = 0;
+            }
+        });
+        pool.parallelFor(vertexChunks, [&](size_t chunk, unsigned) {
+            size_t end = std::min(numVertices, (chunk + 1) * CHUNK);
+            for (uint32_t v = (uint32_t)(chunk * CHUNK); v < end; v++) {
+                bool f = adjStart[v + 1] == adjStart[v];
+                forEachTriangle(v, [&](uint32_t t) {
+                    for (int k = 0; k < 3; k++) f |= cellOf[tri[3*t+k]] != cellOf[v];
+                });
+                frozen[v] = f;
+            }
+        });
+
+        // Bucket free vertices and interior triangles by cell
+        cellStart.assign(numCells + 1, 0);
+        cellTriangles.assign(numCells, 0);
+        for (size_t v = 0; v < numVertices; v++) {
+            if (!frozen[v]) cellStart[cellOf[v] + 1]++;
+        }
+        for (size_t c = 0; c < numCells; c++) cellStart[c + 1] += cellStart[c];
+        cellVertices.resize(cellStart[numCells]);
+        cursor.assign(cellStart.begin(), cellStart.end() - 1);
+        for (size_t v = 0; v < numVertices; v++) {
+            if (!frozen[v]) cellVertices[cursor[cellOf[v]]++] = (uint32_t)v;
+        }
+        for (size_t t = 0; t < numTriangles; t++) {
+            if (!triAlive[t]) continue;
+            uint32_t c = cellOf[tri[3*t]];
+            if (cellOf[tri[3*t+1]] == c && cellOf[tri[3*t+2]] == c) cellTriangles[c]++;
+        }
+        double keep = (double)targetTriangles / (double)aliveTriangles;
+        cellRemoved.assign(numCells, 0);
+
+        pool.parallelFor(numCells, [&](size_t cell, unsigned) {
+            if (cellStart[cell] == cellStart[cell + 1]) return;
+            size_t goal = cellTriangles[cell] - (size_t)std::ceil(cellTriangles[cell] * keep);
+            size_t removed = 0;
+
+            struct Candidate {
+                double error;
+                uint32_t a, b;
+                Vec3 p;
+                bool operator<(const Candidate& o) const {
+                    if (error != o.error) return error < o.error;
+                    return a != o.a ? a < o.a : b < o.b;
+                }
+            };
+            std::vector<Candidate> candidates;
+            std::vector<uint32_t> ringA, ringB;
+
+            auto ring = [&](uint32_t v, std::vector<uint32_t>& out) {
+                out.clear();
+                forEachTriangle(v, [&](uint32_t t) {
+                    for (int k = 0; k < 3; k++) if (tri[3*t+k] != v) out.push_back(tri[3*t+k]);
+                });
+                std::sort(out.begin(), out.end());
+                out.erase(std::unique(out.begin(), out.end()), out.end());
+            };
+
+            // Cheapest placement of every free edge of the cell
+            for (uint32_t i = cellStart[cell]; i < cellStart[cell + 1]; i++) {
+                uint32_t a = cellVertices[i];
+                ring(a, ringA);
+                for (uint32_t b : ringA) {
+                    if (b < a || frozen[b]) continue;
+                    Quadric q = quadric[a];
+                    q += quadric[b];
+                    Vec3 mid = (pos[a] + pos[b]) * 0.5f;
+                    Vec3 p;
+                    if (!q.minimizer(p) || (p - mid).length() > (pos[b] - pos[a]).length()) {
+                        p = mid;
+                        double best = q.error(mid);
+                        for (const Vec3& end : {pos[a], pos[b]}) {
+                            double e = q.error(end);
+                            if (e < best) { best = e; p = end; }
+                        }
+                    }
+                    double error = q.error(p) / std::max(q.planes, 1.0);
+                    if (error <= maxErrorSq) candidates.push_back({error, a, b, p});
+                }
+            }
+            std::sort(candidates.begin(), candidates.end());
+
+            for (const Candidate& c : candidates) {
+                if (removed >= goal) break;
+                uint32_t a = c.a, b = c.b;
+                if (locked[a] || locked[b]) continue;
+
+                // Link condition: the only shared neighbours are the apexes of
+                // the edge's triangles, otherwise the collapse pinches the surface
+                ring(a, ringA);
+                ring(b, ringB);
+                size_t shared = 0, common = 0;
+                forEachTriangle(a, [&](uint32_t t) {
+                    for (int k = 0; k < 3; k++) shared += tri[3*t+k] == b;
+                });
+                for (size_t i = 0, j = 0; i < ringA.size() && j < ringB.size();) {
+                    if (ringA[i] < ringB[j]) i++;
+                    else if (ringA[i] > ringB[j]) j++;
+                    else { common++; i++; j++; }
+                }
+                if (shared == 0 || common != shared) continue;
+
+                // Reject collapses that fold a surviving triangle over
+                bool flips = false;
+                for (uint32_t v : {a, b}) {
+                    forEachTriangle(v, [&](uint32_t t) {
+                        const uint32_t* ti = &tri[3*t];
+                        bool hasA = ti[0] == a || ti[1] == a || ti[2] == a;
+                        bool hasB = ti[0] == b || ti[1] == b || ti[2] == b;
+                        if (hasA && hasB) return;
+                        Vec3 before = triangleNormal(t, NONE, Vec3());
+                        Vec3 after = triangleNormal(t, v, c.p);
+                        if (after.dot(before) <= 0.25f * after.length() * before.length()) flips = true;
+                    });
+                }
+                if (flips) continue;
+
+                // Collapse a into b, attributes follow the new position along the edge
+                Vec3 e = pos[b] - pos[a];
+                float len2 = e.dot(e);
+                float w = len2 > 0.0f ? std::max(0.0f, std::min(1.0f, (c.p - pos[a]).dot(e) / len2)) : 0.5f;
+                if (hasNormals) normals[b] = normals[a] + (normals[b] - normals[a]) * w;
+                if (hasColors) {
+                    const Color3& ca = colors[a];
+                    Color3& cb = colors[b];
+                    cb = Color3(ca.r + (cb.r - ca.r) * w, ca.g + (cb.g - ca.g) * w, ca.b + (cb.b - ca.b) * w);
+                }
+                if (hasUVs) uvs[b] = Vec2(uvs[a].u + (uvs[b].u - uvs[a].u) * w, uvs[a].v + (uvs[b].v - uvs[a].v) * w);
+                pos[b] = c.p;
+                quadric[b] += quadric[a];
+
+                forEachTriangle(a, [&](uint32_t t) {
+                    uint32_t* ti = &tri[3*t];
+                    bool degenerate = ti[0] == b || ti[1] == b || ti[2] == b;
+                    for (int k = 0; k < 3; k++) if (ti[k] == a) ti[k] = b;
+                    if (degenerate) {
+                        triAlive[t] = 0;
+                        removed++;
+                    }
+                });
+                locked[a] = locked[b] = 1;
+            }
+            cellRemoved[cell] = removed;
+        });
+
+        size_t removed = 0;
+        for (size_t r : cellRemoved) removed += r;
+        aliveTriangles -= removed;
+        if (removed == 0) break;
+    }
+
+    // Compact: keep referenced vertices in their original order
+    std::vector<uint32_t> remap(numVertices, NONE);
+    for (size_t t = 0; t < numTriangles; t++) {
+        if (!triAlive[t]) continue;
+        for (int k = 0; k < 3; k++) remap[tri[3*t+k]] = 0;
+    }
+    Mesh out;
+    for (size_t v = 0; v < numVertices; v++) {
+        if (remap[v] == NONE) continue;
+        remap[v] = (uint32_t)out.vertices.size();
+        out.vertices.push_back(pos[v]);
+        if (hasNormals) out.normals.push_back(normals[v].normalized());
+        if (hasColors) out.colors.push_back(colors[v]);
+        if (hasUVs) out.uvs.push_back(uvs[v]);
+    }
+    out.indices.reserve(aliveTriangles * 3);
+    for (size_t t = 0; t < numTriangles; t++) {
+        if (!triAlive[t]) continue;
+        for (int k = 0; k < 3; k++) out.indices.push_back(remap[tri[3*t+k]]);
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+    std::cout << "Simplified mesh: " << numTriangles << " -> " << out.indices.size() / 3
+              << " triangles, " << out.vertices.size() << " vertices (" << passes << " passes, "
+              << duration.count() << " ms)" << std::endl;
+    return out;
+}
+
+// ============================================================================
+// MESH REPAIR - spatial-hash welding, manifold / watertight check
+// ============================================================================
+
+constexpr float WELD_RELATIVE_TOLERANCE = 1e-5f;  // Default weld distance, fraction of the bounds
+constexpr uint64_t REPAIR_EMPTY_KEY = ~uint64_t(0);
+
+// Edge usage of a triangle mesh (edges keyed on vertex indices)
+struct ManifoldReport {
+    size_t edges = 0;
+    size_t boundaryEdges = 0;      // Used by one triangle: holes, open seams, T-junctions
+    size_t nonManifoldEdges = 0;   // Used by three or more triangles
+    size_t misorientedEdges = 0;   // Two triangles walking the edge the same way
+    int64_t eulerCharacteristic = 0;  // V - E + F (2 for a closed sphere-like mesh)
+
+    bool manifold() const { return nonManifoldEdges == 0 && misorientedEdges == 0; }
+    bool watertight() const { return manifold() && boundaryEdges == 0; }
+};
+
+// Per-chunk counts for meshes assembled from independently meshed chunks
+struct SeamStats {
+    size_t vertices = 0;
+    size_t duplicateVertices = 0;  // Welded into an earlier vertex of the same chunk
+    size_t seamVertices = 0;       // Welded into a vertex of another chunk
+    size_t droppedTriangles = 0;   // Degenerate after welding
+    size_t boundaryEdges = 0;
+    size_t nonManifoldEdges = 0;
+};
+
+struct MeshRepairReport {
+    size_t verticesBefore = 0, verticesAfter = 0;
+    size_t trianglesBefore = 0, trianglesAfter = 0;
+    size_t duplicateTriangles = 0;  // Same corners and winding as an earlier triangle (dropped)
+    size_t opposedTriangles = 0;    // Same corners, opposite winding to an earlier triangle (kept)
+    ManifoldReport manifold;
+    std::vector<SeamStats> chunks;  // One per chunkFirstVertex entry
+};
+
+inline uint64_t repairHash(uint64_t key) {
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    return key;
+}
+
+// Chunk owning vertex v, given each chunk's first vertex in ascending order
+inline uint32_t chunkOfVertex(const std::vector<uint32_t>& chunkFirstVertex, uint32_t v) {
+    auto it = std::upper_bound(chunkFirstVertex.begin(), chunkFirstVertex.end(), v);
+    return it == chunkFirstVertex.begin() ? 0 : (uint32_t)(it - chunkFirstVertex.begin() - 1);
+}
+
+// Merge vertices closer than tolerance (PARALLEL, no sort). Vertices are
+// binned into a lock-free hash grid of 2*tolerance cells; each vertex then
+// searches the 8 cells its tolerance box can touch for the lowest-index
+// neighbour, and labels are chased down to their root, so the result does
+// not depend on thread timing. Attributes of the root vertex are kept and
+// triangles that collapse are dropped. chunkFirstVertex (optional) fills
+// per-chunk counts in chunks and triangleChunk (chunk of each kept triangle).
+inline void weldMesh(Mesh& mesh, float tolerance,
+                     const std::vector<uint32_t>& chunkFirstVertex = {},
+                     std::vector<SeamStats>* chunks = nullptr,
+                     std::vector<uint32_t>* triangleChunk = nullptr) {
+    const size_t vertexCount = mesh.vertices.size();
+    const size_t triCount = mesh.indices.size() / 3;
+    const bool perChunk = !chunkFirstVertex.empty();
+    if (chunks) chunks->assign(chunkFirstVertex.size(), SeamStats());
+    if (triangleChunk) triangleChunk->clear();
+    if (vertexCount == 0) return;
+
+    ThreadPool& pool = ThreadPool::instance();
+    const size_t CHUNK = 4096;
+    const size_t vertexBlocks = (vertexCount + CHUNK - 1) / CHUNK;
+
+    Vec3 lo = mesh.vertices[0], hi = mesh.vertices[0];
+    for (const Vec3& v : mesh.vertices) {
+        lo = Vec3(std::min(lo.x, v.x), std::min(lo.y, v.y), std::min(lo.z, v.z));
+        hi = Vec3(std::max(hi.x, v.x), std::max(hi.y, v.y), std::max(hi.z, v.z));
+    }
+    float extent = std::max(hi.x - lo.x, std::max(hi.y - lo.y, hi.z - lo.z));
+    // Cells are at least 2*tolerance and at most 2^21 per axis (21-bit key fields)
+    float cellSize = std::max({2.0f * tolerance, extent / float((1 << 21) - 2), FLT_MIN});
+    float invCell = 1.0f / cellSize;
+    const float tol2 = tolerance * tolerance;
+
+    auto cellKey = [](int64_t x, int64_t y, int64_t z) {
+        return (uint64_t)x | ((uint64_t)y << 21) | ((uint64_t)z << 42);
+    };
+    size_t capacity = 1;
+    while (capacity < vertexCount * 2) capacity <<= 1;
+    const uint64_t mask = capacity - 1;
+    std::unique_ptr<std::atomic<uint64_t>[]> keys(new std::atomic<uint64_t>[capacity]);
+    std::unique_ptr<std::atomic<uint32_t>[]> heads(new std::atomic<uint32_t>[capacity]);
+    std::vector<uint32_t> next(vertexCount);
+    pool.parallelFor((capacity + CHUNK - 1) / CHUNK, [&](size_t c, unsigned) {
+        size_t end = std::min((size_t)capacity, (c + 1) * CHUNK);
+        for (size_t i = c * CHUNK; i < end; i++) {
+            keys[i].store(REPAIR_EMPTY_KEY, std::memory_order_relaxed);
+            heads[i].store(UINT32_MAX, std::memory_order_relaxed);
+        }
+    });
+
+    // Bin every vertex: claim (or find) the cell's slot, push onto its list
+    pool.parallelFor(vertexBlocks, [&](size_t c, unsigned) {
+        size_t end = std::min(vertexCount, (c + 1) * CHUNK);
+        for (size_t v = c * CHUNK; v < end; v++) {
+            const Vec3& p = mesh.vertices[v];
+            uint64_t key = cellKey((int64_t)((p.x - lo.x) * invCell), (int64_t)((p.y - lo.y) * invCell),
+                                   (int64_t)((p.z - lo.z) * invCell));
+            for (uint64_t slot = repairHash(key) & mask;; slot = (slot + 1) & mask) {
+                uint64_t expected = REPAIR_EMPTY_KEY;
+                if (keys[slot].compare_exchange_strong(expected, key, std::memory_order_acq_rel) ||
+                    expected == key) {
+                    next[v] = heads[slot].exchange((uint32_t)v, std::memory_order_acq_rel);
+                    break;
+                }
+            }
+        }
+    });
+
+    // Lowest-index vertex within tolerance (itself if none is lower)
+    std::vector<uint32_t> label(vertexCount);
+    pool.parallelFor(vertexBlocks, [&](size_t c, unsigned) {
+        size_t end = std::min(vertexCount, (c + 1) * CHUNK);
+        for (size_t v = c * CHUNK; v < end; v++) {
+            const Vec3& p = mesh.vertices[v];
+            const float f[3] = {(p.x - lo.x) * invCell, (p.y - lo.y) * invCell, (p.z - lo.z) * invCell};
+            int64_t cell[3], side[3];
+            for (int a = 0; a < 3; a++) {
+                cell[a] = (int64_t)f[a];
+                side[a] = f[a] - (float)cell[a] < 0.5f ? -1 : 1;
+            }
+            uint32_t best = (uint32_t)v;
+            for (int n = 0; n < 8; n++) {
+                int64_t x = cell[0] + ((n & 1) ? side[0] : 0);
+                int64_t y = cell[1] + ((n & 2) ? side[1] : 0);
+                int64_t z = cell[2] + ((n & 4) ? side[2] : 0);
+                if (x < 0 || y < 0 || z < 0) continue;
+                uint64_t key = cellKey(x, y, z);
+                for (uint64_t slot = repairHash(key) & mask;; slot = (slot + 1) & mask) {
+                    uint64_t k = keys[slot].load(std::memory_order_relaxed);
+                    if (k == REPAIR_EMPTY_KEY) break;
+                    if (k != key) continue;
+                    for (uint32_t u = heads[slot].load(std::memory_order_relaxed); u != UINT32_MAX; u = next[u]) {
+                        if (u < best && (mesh.vertices[u] - p).dot(mesh.vertices[u] - p) <= tol2) best = u;
+                    }
+                    break;
+                }
+            }
+            label[v] = best;
+        }
+    });
+    keys.reset();
+    heads.reset();
+    next = std::vector<uint32_t>();
+
+    // Chase labels to their root (labels only decrease), count roots per block
+    std::vector<uint32_t> root(vertexCount);
+    std::vector<size_t> blockRoots(vertexBlocks + 1, 0);
+    pool.parallelFor(vertexBlocks, [&](size_t c, unsigned) {
+        size_t end = std::min(vertexCount, (c + 1) * CHUNK), roots = 0;
+        for (size_t v = c * CHUNK; v < end; v++) {
+            uint32_t r = label[v];
+            while (label[r] != r) r = label[r];
+            root[v] = r;
+            roots += r == v;
+        }
+        blockRoots[c + 1] = roots;
+    });
+    label = std::vector<uint32_t>();
+    for (size_t c = 0; c < vertexBlocks; c++) blockRoots[c + 1] += blockRoots[c];
+    const size_t newVertexCount = blockRoots[vertexBlocks];
+
+    // Per-chunk vertex statistics
+    if (chunks && perChunk) {
+        std::vector<std::vector<SeamStats>> local(pool.size(), std::vector<SeamStats>(chunks->size()));
+        pool.parallelFor(vertexBlocks, [&](size_t c, unsigned worker) {
+            size_t end = std::min(vertexCount, (c + 1) * CHUNK);
+            for (size_t v = c * CHUNK; v < end; v++) {
+                uint32_t r = root[v];
+                uint32_t chunk = chunkOfVertex(chunkFirstVertex, (uint32_t)v);
+                SeamStats& s = local[worker][chunk];
+                s.vertices++;
+                if (r != v) (chunkOfVertex(chunkFirstVertex, r) == chunk ? s.duplicateVertices : s.seamVertices)++;
+            }
+        });
+        for (const auto& l : local) {
+            for (size_t i = 0; i < l.size(); i++) {
+                (*chunks)[i].vertices += l[i].vertices;
+                (*chunks)[i].duplicateVertices += l[i].duplicateVertices;
+                (*chunks)[i].seamVertices += l[i].seamVertices;
+            }
+        }
+    }
+
+    // New index of every vertex: roots are numbered in order, the rest follow their root
+    std::vector<uint32_t> remap(vertexCount);
+    const bool hasNormals = mesh.hasNormals(), hasColors = mesh.hasColors(), hasUVs = mesh.hasUVs();
+    Mesh welded;
+    welded.vertices.resize(newVertexCount);
+    if (hasNormals) welded.normals.resize(newVertexCount);
+    if (hasColors) welded.colors.resize(newVertexCount);
+    if (hasUVs) welded.uvs.resize(newVertexCount);
+    pool.parallelFor(vertexBlocks, [&](size_t c, unsigned) {
+        size_t end = std::min(vertexCount, (c + 1) * CHUNK);
+        uint32_t out = (uint32_t)blockRoots[c];
+        for (size_t v = c * CHUNK; v < end; v++) {
+            if (root[v] != v) continue;
+            remap[v] = out;
+            welded.vertices[out] = mesh.vertices[v];
+            if (hasNormals) welded.normals[out] = mesh.normals[v];
+            if (hasColors) welded.colors[out] = mesh.colors[v];
+            if (hasUVs) welded.uvs[out] = mesh.uvs[v];
+            out++;
+        }
+    });
+    pool.parallelFor(vertexBlocks, [&](size_t c, unsigned) {
+        size_t end = std::min(vertexCount, (c + 1) * CHUNK);
+        for (size_t v = c * CHUNK; v < end; v++) {
+            if (root[v] != v) remap[v] = remap[root[v]];
+        }
+    });
+
+    // Remap triangles, dropping the ones that collapsed
+    const size_t triBlocks = (triCount + CHUNK - 1) / CHUNK;
+    std::vector<size_t> blockTris(triBlocks + 1, 0);
+    auto keep = [&](size_t t) {
+        uint32_t a = remap[mesh.indices[3*t]], b = remap[mesh.indices[3*t+1]], c = remap[mesh.indices[3*t+2]];
+        return a != b && b != c && a != c;
+    };
+    pool.parallelFor(triBlocks, [&](size_t c, unsigned) {
+        size_t end = std::min(triCount, (c + 1) * CHUNK), kept = 0;
+        for (size_t t = c * CHUNK; t < end; t++) kept += keep(t);
+        blockTris[c + 1] = kept;
+    });
+    for (size_t c = 0; c < triBlocks; c++) blockTris[c + 1] += blockTris[c];
+    welded.indices.resize(3 * blockTris[triBlocks]);
+    if (triangleChunk && perChunk) triangleChunk->resize(blockTris[triBlocks]);
+    std::vector<std::vector<size_t>> dropped(perChunk && chunks ? pool.size() : 0,
+                                             std::vector<size_t>(chunkFirstVertex.size(), 0));
+    pool.parallelFor(triBlocks, [&](size_t c, unsigned worker) {
+        size_t end = std::min(triCount, (c + 1) * CHUNK), out = blockTris[c];
+        for (size_t t = c * CHUNK; t < end; t++) {
+            bool kept = keep(t);
+            if (perChunk && (kept ? triangleChunk != nullptr : chunks != nullptr)) {
+                uint32_t chunk = chunkOfVertex(chunkFirstVertex, mesh.indices[3*t]);
+                if (kept) (*triangleChunk)[out] = chunk;
+                else dropped[worker][chunk]++;
+            }
+            if (!kept) continue;
+            for (int k = 0; k < 3; k++) welded.indices[3*out + k] = remap[mesh.indices[3*t + k]];
+            out++;
+        }
+    });
+    for (const auto& d : dropped) {
+        for (size_t i = 0; i < d.size(); i++) (*chunks)[i].droppedTriangles += d[i];
+    }
+
+    mesh = std::move(welded);
+}
+
+// Drop triangles repeating the corners and winding of an earlier triangle
+// (stacked faces left when welding merges coincident patches). Triangles
+// repeating the corners with opposite winding are zero-thickness sheets:
+// they are kept (the manifold check flags their edges) and only counted.
+// triangleChunk, when not empty, is compacted alongside the indices.
+// PARALLEL, no sort: faces are grouped in a lock-free hash keyed on the
+// rotated corner triple plus winding, each group keeping its lowest triangle
+// index, so the result does not depend on thread timing.
+inline size_t removeDuplicateTriangles(Mesh& mesh, std::vector<uint32_t>* triangleChunk = nullptr,
+                                       size_t* opposed = nullptr) {
+    const size_t triCount = mesh.indices.size() / 3;
+    if (opposed) *opposed = 0;
+    if (triCount < 2) return 0;
+
+    // Smallest corner first, then the other two in ascending order; winding
+    // is 1 when that order reverses the triangle's
+    struct Face { uint32_t a, lo, hi, winding; };
+    auto faceOf = [&](size_t t) {
+        const uint32_t* i = &mesh.indices[3 * t];
+        int r = i[0] < i[1] ? (i[0] < i[2] ? 0 : 2) : (i[1] < i[2] ? 1 : 2);
+        uint32_t b = i[(r + 1) % 3], c = i[(r + 2) % 3];
+        return Face{i[r], std::min(b, c), std::max(b, c), b > c ? 1u : 0u};
+    };
+    auto sameFace = [](const Face& x, const Face& y) {
+        return x.a == y.a && x.lo == y.lo && x.hi == y.hi && x.winding == y.winding;
+    };
+    auto faceHash = [](const Face& f) {
+        return repairHash(((uint64_t)f.a << 32 | f.lo) ^ repairHash((uint64_t)f.hi << 1 | f.winding));
+    };
+
+    ThreadPool& pool = ThreadPool::instance();
+    const size_t CHUNK = 4096;
+    const size_t triBlocks = (triCount + CHUNK - 1) / CHUNK;
+    size_t capacity = 1;
+    while (capacity < triCount * 2) capacity <<= 1;
+    const uint64_t mask = capacity - 1;
+    // Slot -> lowest triangle of its face group (UINT32_MAX = empty). A slot
+    // only ever holds members of one group, so comparing against whichever
+    // member is stored is race-free.
+    std::unique_ptr<std::atomic<uint32_t>[]> first(new std::atomic<uint32_t>[capacity]);
+    pool.parallelFor((capacity + CHUNK - 1) / CHUNK, [&](size_t c, unsigned) {
+        size_t end = std::min((size_t)capacity, (c + 1) * CHUNK);
+        for (size_t i = c * CHUNK; i < end; i++) first[i].store(UINT32_MAX, std::memory_order_relaxed);
+    });
+
+    auto find = [&](const Face& f) -> size_t {
+        for (uint64_t slot = faceHash(f) & mask;; slot = (slot + 1) & mask) {
+            uint32_t u = first[slot].load(std::memory_order_acquire);
+            if (u == UINT32_MAX) return SIZE_MAX;
+            if (sameFace(faceOf(u), f)) return slot;
+        }
+    };
+    std::vector<uint32_t> slotOf(triCount);
+    pool.parallelFor(triBlocks, [&](size_t c, unsigned) {
+        size_t end = std::min(triCount, (c + 1) * CHUNK);
+        for (size_t t = c * CHUNK; t < end; t++) {
+            Face f = faceOf(t);
+            for (uint64_t slot = faceHash(f) & mask;; slot = (slot + 1) & mask) {
+                uint32_t u = UINT32_MAX;
+                if (first[slot].compare_exchange_strong(u, (uint32_t)t, std::memory_order_acq_rel)) {
+                    slotOf[t] = (uint32_t)slot;
+                    break;
+                }
+                if (!sameFace(faceOf(u), f)) continue;
+                while (u > t && !first[slot].compare_exchange_weak(u, (uint32_t)t, std::memory_order_acq_rel)) {}
+                slotOf[t] = (uint32_t)slot;
+                break;
+            }
+        }
+    });
+
+    // Keep each group's first triangle; count sheets once, from the group
+    // whose winding matches the sorted order
+    std::vector<size_t> blockKept(triBlocks + 1, 0), blockSheets(triBlocks, 0);
+    pool.parallelFor(triBlocks, [&](size_t c, unsigned) {
+        size_t end = std::min(triCount, (c + 1) * CHUNK), kept = 0, sheets = 0;
+        for (size_t t = c * CHUNK; t < end; t++) {
+            if (first[slotOf[t]].load(std::memory_order_relaxed) != t) continue;
+            kept++;
+            Face f = faceOf(t);
+            if (f.winding == 0) {
+                f.winding = 1;
+                sheets += find(f) != SIZE_MAX;
+            }
+        }
+        blockKept[c + 1] = kept;
+        blockSheets[c] = sheets;
+    });
+    size_t sheets = 0;
+    for (size_t c = 0; c < triBlocks; c++) {
+        blockKept[c + 1] += blockKept[c];
+        sheets += blockSheets[c];
+    }
+    if (opposed) *opposed = sheets;
+    const size_t keptCount = blockKept[triBlocks];
+    const size_t dropped = triCount - keptCount;
+    if (dropped == 0) return 0;
+
+    bool perChunk = triangleChunk && triangleChunk->size() == triCount;
+    std::vector<uint32_t> indices(3 * keptCount);
+    std::vector<uint32_t> chunkOut(perChunk ? keptCount : 0);
+    pool.parallelFor(triBlocks, [&](size_t c, unsigned) {
+        size_t end = std::min(triCount, (c + 1) * CHUNK), out = blockKept[c];
+        for (size_t t = c * CHUNK; t < end; t++) {
+            if (first[slotOf[t]].load(std::memory_order_relaxed) != t) continue;
+            for (int k = 0; k < 3; k++) indices[3 * out + k] = mesh.indices[3 * t + k];
+            if (perChunk) chunkOut[out] = (*triangleChunk)[t];
+            out++;
+        }
+    });
+    mesh.indices = std::move(indices);
+    if (perChunk) *triangleChunk = std::move(chunkOut);
+    return dropped;
+}
+
+// Count boundary, non-manifold and misoriented edges (PARALLEL, lock-free
+// edge hash). With triangleChunk, open and non-manifold edges are also
+// charged to the chunk of a triangle using them.
+inline ManifoldReport checkManifold(const Mesh& mesh, const std::vector<uint32_t>* triangleChunk = nullptr,
+                                    std::vector<SeamStats>* chunks = nullptr) {
+    ManifoldReport report;
+    const size_t triCount = mesh.indices.size() / 3;
+    const size_t edgeUses = 3 * triCount;
+    if (triCount == 0) return report;
+    const bool perChunk = triangleChunk && chunks && triangleChunk->size() == triCount;
+
+    ThreadPool& pool = ThreadPool::instance();
+    const size_t CHUNK = 4096;
+    size_t capacity = 1;
+    while (capacity < edgeUses) capacity <<= 1;  // ~1.5 uses per edge: load under 0.67
+    const uint64_t mask = capacity - 1;
+    std::unique_ptr<std::atomic<uint64_t>[]> keys(new std::atomic<uint64_t>[capacity]);
+    std::unique_ptr<std::atomic<uint32_t>[]> uses(new std::atomic<uint32_t>[capacity]);   // Forward | backward << 16
+    std::unique_ptr<std::atomic<uint32_t>[]> owner(new std::atomic<uint32_t>[capacity]);  // First triangle
+    const size_t slotBlocks = (capacity + CHUNK - 1) / CHUNK;
+    pool.parallelFor(slotBlocks, [&](size_t c, unsigned) {
+        size_t end = std::min((size_t)capacity, (c + 1) * CHUNK);
+        for (size_t i = c * CHUNK; i < end; i++) {
+            keys[i].store(REPAIR_EMPTY_KEY, std::memory_order_relaxed);
+            uses[i].store(0, std::memory_order_relaxed);
+        }
+    });
+
+    pool.parallelFor((triCount + CHUNK - 1) / CHUNK, [&](size_t c, unsigned) {
+        size_t end = std::min(triCount, (c + 1) * CHUNK);
+        for (size_t t = c * CHUNK; t < end; t++) {
+            for (int k = 0; k < 3; k++) {
+                uint32_t a = mesh.indices[3*t + k], b = mesh.indices[3*t + (k + 1) % 3];
+                uint64_t key = ((uint64_t)std::min(a, b) << 32) | std::max(a, b);
+                for (uint64_t slot = repairHash(key) & mask;; slot = (slot + 1) & mask) {
+                    uint64_t expected = REPAIR_EMPTY_KEY;
+                    if (keys[slot].compare_exchange_strong(expected, key, std::memory_order_acq_rel)) {
+                        owner[slot].store((uint32_t)t, std::memory_order_relaxed);
+                    } else if (expected != key) {
+                        continue;
+                    }
+                    // Saturate at 255 per direction so counts never carry
+                    uint32_t add = a < b ? 1u : 1u << 16;
+                    uint32_t old = uses[slot].load(std::memory_order_relaxed);
+                    while (((a < b ? old : old >> 16) & 0xFFFF) < 255 &&
+                           !uses[slot].compare_exchange_weak(old, old + add, std::memory_order_relaxed)) {}
+                    break;
+                }
+            }
+        }
+    });
+
+    struct Counts { size_t edges = 0, boundary = 0, nonManifold = 0, misoriented = 0; };
+    std::vector<Counts> counts(pool.size());
+    std::vector<std::vector<SeamStats>> local(perChunk ? pool.size() : 0, std::vector<SeamStats>(perChunk ? chunks->size() : 0));
+    pool.parallelFor(slotBlocks, [&](size_t c, unsigned worker) {
+        size_t end = std::min((size_t)capacity, (c + 1) * CHUNK);
+        Counts& n = counts[worker];
+        for (size_t i = c * CHUNK; i < end; i++) {
+            if (keys[i].load(std::memory_order_relaxed) == REPAIR_EMPTY_KEY) continue;
+            uint32_t u = uses[i].load(std::memory_order_relaxed);
+            uint32_t forward = u & 0xFFFF, backward = u >> 16, total = forward + backward;
+            n.edges++;
+            bool open = total == 1, nonManifold = total > 2;
+            n.boundary += open;
+            n.nonManifold += nonManifold;
+            n.misoriented += total == 2 && forward != 1;
+            if (perChunk && (open || nonManifold)) {
+                SeamStats& s = local[worker][(*triangleChunk)[owner[i].load(std::memory_order_relaxed)]];
+                s.boundaryEdges += open;
+                s.nonManifoldEdges += nonManifold;
+            }
+        }
+    });
+    for (const Counts& n : counts) {
+        report.edges += n.edges;
+        report.boundaryEdges += n.boundary;
+        report.nonManifoldEdges += n.nonManifold;
+        report.misorientedEdges += n.misoriented;
+    }
+    for (const auto& l : local) {
+        for (size_t i = 0; i < l.size(); i++) {
+            (*chunks)[i].boundaryEdges += l[i].boundaryEdges;
+            (*chunks)[i].nonManifoldEdges += l[i].nonManifoldEdges;
+        }
+    }
+    report.eulerCharacteristic = (int64_t)mesh.vertices.size() - (int64_t)report.edges + (int64_t)triCount;
+    return report;
+}
+
+// Weld duplicate vertices (tolerance 0 = WELD_RELATIVE_TOLERANCE of the
+// bounds), drop repeated triangles and check the result. chunkFirstVertex lists where each merged
+// chunk's vertices start, for per-chunk seam statistics.
+inline MeshRepairReport repairMesh(Mesh& mesh, float tolerance = 0.0f,
+                                   const std::vector<uint32_t>& chunkFirstVertex = {}) {
+    MeshRepairReport report;
+    report.verticesBefore = mesh.vertices.size();
+    report.trianglesBefore = mesh.indices.size() / 3;
+    if (mesh.vertices.empty()) return report;
+    auto start = std::chrono::high_resolution_clock::now();
+
+    if (tolerance <= 0.0f) {
+        Vec3 lo = mesh.vertices[0], hi = mesh.vertices[0];
+        for (const Vec3& v : mesh.vertices) {
+            lo = Vec3(std::min(lo.x, v.x), std::min(lo.y, v.y), std::min(lo.z, v.z));
+            hi = Vec3(std::max(hi.x, v.x), std::max(hi.y, v.y), std::max(hi.z, v.z));
+        }
+        tolerance = WELD_RELATIVE_TOLERANCE * std::max(hi.x - lo.x, std::max(hi.y - lo.y, hi.z - lo.z));
+    }
+    std::vector<uint32_t> triangleChunk;
+    weldMesh(mesh, tolerance, chunkFirstVertex, &report.chunks, &triangleChunk);
+    report.duplicateTriangles = removeDuplicateTriangles(mesh, &triangleChunk, &report.opposedTriangles);
+    auto welded = std::chrono::high_resolution_clock::now();
+    report.manifold = checkManifold(mesh, &triangleChunk, &report.chunks);
+    report.verticesAfter = mesh.vertices.size();
+    report.trianglesAfter = mesh.indices.size() / 3;
+
+    auto end = std::chrono::high_resolution_clock::now();
+    auto ms = [](auto a, auto b) { return std::chrono::duration_cast<std::chrono::milliseconds>(b - a).count(); };
+    const ManifoldReport& m = report.manifold;
+    std::cout << "Mesh repair: " << report.verticesBefore << " -> " << report.verticesAfter << " vertices, "
+              << report.trianglesBefore << " -> " << report.trianglesAfter << " triangles; "
+              << m.boundaryEdges << " boundary, " << m.nonManifoldEdges << " non-manifold, "
+              << m.misorientedEdges << " misoriented edges, " << report.duplicateTriangles
+              << " duplicate / " << report.opposedTriangles << " opposed triangles"
+              << (m.watertight() ? " (watertight)" : "") << " (weld " << ms(start, welded)
+              << " ms, check " << ms(welded, end) << " ms)" << std::endl;
+    size_t seamChunks = 0, seamVertices = 0, openSeams = 0;
+    for (const SeamStats& s : report.chunks) {
+        seamChunks += s.seamVertices > 0;
+        seamVertices += s.seamVertices;
+        openSeams += s.boundaryEdges;
+    }
+    if (!report.chunks.empty()) {
+        std::cout << "  Seams: " << seamVertices << " vertices welded across " << seamChunks << "/"
+                  << report.chunks.size() << " chunks, " << openSeams << " open edges left" << std::endl;
+    }
+    return report;
+}
+
+// ============================================================================
+// VERTEX CACHE OPTIMIZATION - Tipsify ordering, overdraw sort, fetch remap
+// ============================================================================
+
+constexpr unsigned VERTEX_CACHE_SIZE = 16;          // FIFO entries targeted and simulated
+constexpr size_t OVERDRAW_MIN_CLUSTER_TRIANGLES = 64;  // Smallest run reordered for overdraw
+
+// Average cache miss ratio (transformed vertices per triangle) of indices
+// on a FIFO post-transform cache of cacheSize entries. 0.5 is the ideal
+// for a regular grid, 3 means every vertex is re-transformed.
+inline float computeACMR(const uint32_t* indices, size_t indexCount, size_t vertexCount,
+                         unsigned cacheSize = VERTEX_CACHE_SIZE) {
+    if (indexCount < 3) return 0.0f;
+    std::vector<uint32_t> insertedAt(vertexCount, UINT32_MAX);
+    uint32_t misses = 0;
+    for (size_t i = 0; i < indexCount; i++) {
+        uint32_t v = indices[i];
+        if (insertedAt[v] != UINT32_MAX && misses - insertedAt[v] < cacheSize) continue;
+        insertedAt[v] = misses++;
+    }
+    return (float)misses / (float)(indexCount / 3);
+}
+
+// Per-call state of tipsify, reusable across calls
+struct TipsifyScratch {
+    std::vector<uint32_t> offsets;    // CSR vertex -> triangles
+    std::vector<uint32_t> adjacency;
+    std::vector<uint32_t> live;       // Triangles not yet emitted per vertex
+    std::vector<uint32_t> cacheTime;
+    std::vector<uint32_t> deadEnd;    // Recently used vertices to restart from
+    std::vector<uint8_t> emitted;
+};
+
+// Tipsify (Sander, Nehab, Barczak 2007): fan out around the vertex whose
+// remaining triangles fit best in the cache, falling back to recently used
+// vertices at dead ends. Linear time. Writes the reordered triangles to out
+// (which must not alias indices). With coldStarts, records the first
+// triangle of each fan that restarted from a vertex already out of cache.
+inline void tipsify(const uint32_t* indices, size_t indexCount, size_t vertexCount, uint32_t* out,
+                    TipsifyScratch& s, std::vector<uint32_t>* coldStarts = nullptr,
+                    unsigned cacheSize = VERTEX_CACHE_SIZE) {
+    size_t triCount = indexCount / 3;
+    s.offsets.assign(vertexCount + 1, 0);
+    for (size_t i = 0; i < triCount * 3; i++) s.offsets[indices[i] + 1]++;
+    for (size_t v = 0; v < vertexCount; v++) s.offsets[v + 1] += s.offsets[v];
+    s.live.resize(vertexCount);
+    for (size_t v = 0; v < vertexCount; v++) s.live[v] = s.offsets[v + 1] - s.offsets[v];
+
+    // Fill adjacency, using cacheTime as the per-vertex write cursor
+    s.adjacency.resize(triCount * 3);
+    s.cacheTime.assign(s.offsets.begin(), s.offsets.end() - 1);
+    for (size_t t = 0; t < triCount; t++) {
+        for (int k = 0; k < 3; k++) s.adjacency[s.cacheTime[indices[3*t+k]]++] = (uint32_t)t;
+    }
+    s.cacheTime.assign(vertexCount, 0);
+    s.emitted.assign(triCount, 0);
+    s.deadEnd.clear();
+
+    uint32_t time = cacheSize + 1;
+    size_t cursor = 0, written = 0;
+    std::vector<uint32_t> candidates;
+    candidates.reserve(64);
+
+    auto nextUnfinished = [&]() -> int64_t {
+        while (!s.deadEnd.empty()) {
+            uint32_t d = s.deadEnd.back();
+            s.deadEnd.pop_back();
+            if (s.live[d] > 0) return d;
+        }
+        while (cursor < vertexCount) {
+            if (s.live[cursor] > 0) return (int64_t)cursor;
+            cursor++;
+        }
+        return -1;
+    };
+
+    int64_t fan = nextUnfinished();
+    bool cold = true;
+    while (fan >= 0) {
+        if (cold && coldStarts) coldStarts->push_back((uint32_t)(written / 3));
+        candidates.clear();
+        for (uint32_t a = s.offsets[fan]; a < s.offsets[fan + 1]; a++) {
+            uint32_t t = s.adjacency[a];
+            if (s.emitted[t]) continue;
+            s.emitted[t] = 1;
+            for (int k = 0; k < 3; k++) {
+                uint32_t v = indices[3*t+k];
+                out[written++] = v;
+                s.deadEnd.push_back(v);
+                candidates.push_back(v);
+                s.live[v]--;
+                if (time - s.cacheTime[v] > cacheSize) s.cacheTime[v] = time++;
+            }
+        }
+
+        // Prefer the candidate that stays in cache while its fan is emitted
+        int64_t best = -1;
+        uint32_t bestPriority = 0;
+        for (uint32_t v : candidates) {
+            if (s.live[v] == 0) continue;
+            uint32_t priority = 0;
+            if (time - s.cacheTime[v] + 2 * s.live[v] <= cacheSize) priority = time - s.cacheTime[v];
+            if (best < 0 || priority > bestPriority) {
+                best = v;
+                bestPriority = priority;
+            }
+        }
+        cold = false;
+        if (best < 0) {
+            best = nextUnfinished();
+            cold = best >= 0 && time - s.cacheTime[best] > cacheSize;
+        }
+        fan = best;
+    }
+}
+
+// Reorder triangles for the post-transform cache (Tipsify)
+inline void optimizeVertexCache(const uint32_t* indices, size_t indexCount, size_t vertexCount, uint32_t* out) {
+    TipsifyScratch scratch;
+    tipsify(indices, indexCount, vertexCount, out, scratch);
+}
+
+// Prepare mesh for GPU rendering: Tipsify triangle order, then the cold
+// runs between restarts sorted so outward-facing ones draw first (less
+// overdraw, cache cost unchanged), then vertices renumbered in first-use
+// order for fetch locality (unreferenced vertices are dropped). Reports
+// ACMR before and after.
+inline void optimizeMeshForGPU(Mesh& mesh) {
+    size_t triCount = mesh.indices.size() / 3;
+    size_t vertexCount = mesh.vertices.size();
+    if (triCount == 0) return;
+    auto start = std::chrono::high_resolution_clock::now();
+    float acmrBefore = computeACMR(mesh.indices.data(), mesh.indices.size(), vertexCount);
+
+    std::vector<uint32_t> ordered(mesh.indices.size());
+    std::vector<uint32_t> runs;
+    TipsifyScratch scratch;
+    tipsify(mesh.indices.data(), mesh.indices.size(), vertexCount, ordered.data(), scratch, &runs);
+
+    // Merge short runs, then sort by how far each faces out from the mesh centroid
+    std::vector<uint32_t> bounds;
+    for (uint32_t r : runs) {
+        if (bounds.empty() || r - bounds.back() >= OVERDRAW_MIN_CLUSTER_TRIANGLES) bounds.push_back(r);
+    }
+    bounds.push_back((uint32_t)triCount);
+    size_t runCount = bounds.size() - 1;
+
+    Vec3 centroid(0, 0, 0);
+    for (const Vec3& v : mesh.vertices) centroid = centroid + v;
+    centroid = centroid * (1.0f / (float)vertexCount);
+
+    std::vector<float> facing(runCount);
+    ThreadPool::instance().parallelFor(runCount, [&](size_t r, unsigned) {
+        Vec3 center(0, 0, 0), normal(0, 0, 0);
+        float area = 0;
+        for (uint32_t t = bounds[r]; t < bounds[r + 1]; t++) {
+            const Vec3& p0 = mesh.vertices[ordered[3*t]];
+            const Vec3& p1 = mesh.vertices[ordered[3*t+1]];
+            const Vec3& p2 = mesh.vertices[ordered[3*t+2]];
+            Vec3 n = (p2 - p0).cross(p1 - p0);  // Outward for MC winding, |n| = 2 * area
+            float a = n.length();
+            center = center + (p0 + p1 + p2) * (a / 3.0f);
+            normal = normal + n;
+            area += a;
+        }
+        if (area > 0) center = center * (1.0f / area);
+        facing[r] = (center - centroid).dot(normal.normalized());
+    });
+    std::vector<uint32_t> runOrder(runCount);
+    for (size_t r = 0; r < runCount; r++) runOrder[r] = (uint32_t)r;
+    std::stable_sort(runOrder.begin(), runOrder.end(), [&](uint32_t a, uint32_t b) { return facing[a] > facing[b]; });
+
+    // Emit runs in that order, renumbering vertices on first use
+    std::vector<uint32_t> remap(vertexCount, UINT32_MAX);
+    uint32_t nextVertex = 0;
+    size_t w = 0;
+    for (uint32_t r : runOrder) {
+        for (size_t i = (size_t)bounds[r] * 3; i < (size_t)bounds[r + 1] * 3; i++) {
+            uint32_t& id = remap[ordered[i]];
+            if (id == UINT32_MAX) id = nextVertex++;
+            mesh.indices[w++] = id;
+        }
+    }
+
+    auto permute = [&](auto& attribute) {
+        if (attribute.size() != vertexCount) return;
+        std::remove_reference_t<decltype(attribute)> moved(nextVertex);
+        for (size_t v = 0; v < vertexCount; v++) {
+            if (remap[v] != UINT32_MAX) moved[remap[v]] = attribute[v];
+        }
+        attribute.swap(moved);
+    };
+    permute(mesh.normals);
+    permute(mesh.colors);
+    permute(mesh.uvs);
+    permute(mesh.vertices);
+
+    float acmrAfter = computeACMR(mesh.indices.data(), mesh.indices.size(), nextVertex);
+    auto end = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+    std::cout << "GPU mesh optimize: ACMR " << acmrBefore << " -> " << acmrAfter
+              << " (cache " << VERTEX_CACHE_SIZE << "), " << runCount << " overdraw runs, "
+              << vertexCount - nextVertex << " unused vertices dropped, " << duration.count() << " ms" << std::endl;
+}
+
+// ============================================================================
+// MESH CLUSTERS - spatially sorted triangle groups with culling bounds
+// ============================================================================
+
+constexpr size_t MESH_CLUSTER_TRIANGLES = 128;          // Triangles per cluster
+constexpr size_t MESH_CLUSTER_MIN_TRIANGLES = 1 << 16;  // Smaller meshes are drawn whole
+
+// A run of triangles in the reordered index buffer, with a bounding sphere
+// for frustum tests and a normal cone for backface tests. Cone normals are
+// the outward face normals of MC winding, (v2-v0)×(v1-v0).
+struct MeshCluster {
+    uint32_t firstIndex = 0;
+    uint32_t indexCount = 0;
+    Vec3 center;
+    float radius = 0;
+    Vec3 coneApex;
+    Vec3 coneAxis;
+    float coneCutoff = 1.0f;  // 1 = spread too wide, never backface-culled
+};
+
+// True when every triangle of the cluster faces away from eye
+inline bool clusterBackfacing(const MeshCluster& c, const Vec3& eye) {
+    if (c.coneCutoff >= 1.0f) return false;
+    Vec3 d = (c.coneApex - eye).normalized();
+    return d.dot(c.coneAxis) >= c.coneCutoff;
+}
+
+// Spread the low 10 bits of v to every third bit
+inline uint32_t mortonSpread10(uint32_t v) {
+    v &= 0x3FF;
+    v = (v | (v << 16)) & 0x030000FF;
+    v = (v | (v << 8)) & 0x0300F00F;
+    v = (v | (v << 4)) & 0x030C30C3;
+    v = (v | (v << 2)) & 0x09249249;
+    return v;
+}
+
+// Sort the triangles of indices by the Morton code of their centroids and
+// cut them into clusters of trianglesPerCluster, writing the reordered
+// triangles (offset by vertexOffset) to outIndices. Neighbouring triangles,
+// and so their shared vertices, end up adjacent in the index stream, which
+// keeps the post-transform cache warm; optimizeCache additionally runs
+// Tipsify inside each cluster. outIndices is only written, never read back,
+// so it can be mapped GPU memory. positions is anything indexable by
+// vertex returning a Vec3 (std::vector<Vec3>, StridedView<Vec3>).
+template<typename Positions>
+inline std::vector<MeshCluster> buildMeshClusters(const Positions& positions, const uint32_t* indices,
+                                                  size_t indexCount, uint32_t* outIndices,
+                                                  uint32_t vertexOffset = 0, bool optimizeCache = false,
+                                                  size_t trianglesPerCluster = MESH_CLUSTER_TRIANGLES) {
+    size_t triCount = indexCount / 3;
+    std::vector<MeshCluster> clusters;
+    if (triCount == 0 || positions.size() == 0) return clusters;
+
+    ThreadPool& pool = ThreadPool::instance();
+    constexpr size_t CHUNK = 4096;
+    size_t chunks = (triCount + CHUNK - 1) / CHUNK;
+
+    Vec3 lo(FLT_MAX, FLT_MAX, FLT_MAX), hi(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (size_t i = 0; i < positions.size(); i++) {
+        const Vec3& p = positions[i];
+        lo = Vec3(std::min(lo.x, p.x), std::min(lo.y, p.y), std::min(lo.z, p.z));
+        hi = Vec3(std::max(hi.x, p.x), std::max(hi.y, p.y), std::max(hi.z, p.z));
+    }
+    Vec3 extent = hi - lo;
+    Vec3 scale(extent.x > 0 ? 1023.0f / extent.x : 0.0f,
+               extent.y > 0 ? 1023.0f / extent.y : 0.0f,
+               extent.z > 0 ? 1023.0f / extent.z : 0.0f);
+
+    // 30-bit Morton keys of triangle centroids
+    std::vector<uint32_t> keys(triCount), order(triCount);
+    pool.parallelFor(chunks, [&](size_t chunk, unsigned) {
+        size_t end = std::min(triCount, (chunk + 1) * CHUNK);
+        for (size_t t = chunk * CHUNK; t < end; t++) {
+            Vec3 c = (positions[indices[3*t]] + positions[indices[3*t+1]] + positions[indices[3*t+2]]) * (1.0f / 3.0f);
+            uint32_t x = (uint32_t)((c.x - lo.x) * scale.x);
+            uint32_t y = (uint32_t)((c.y - lo.y) * scale.y);
+            uint32_t z = (uint32_t)((c.z - lo.z) * scale.z);
+            keys[t] = mortonSpread10(x) | (mortonSpread10(y) << 1) | (mortonSpread10(z) << 2);
+            order[t] = (uint32_t)t;
+        }
+    });
+
+    // Stable LSD radix sort, 3 passes of 10 bits
+    std::vector<uint32_t> keysTmp(triCount), orderTmp(triCount);
+    for (int shift = 0; shift < 30; shift += 10) {
+        uint32_t offsets[1024] = {};
+        for (size_t t = 0; t < triCount; t++) offsets[(keys[t] >> shift) & 1023]++;
+        uint32_t sum = 0;
+        for (uint32_t& o : offsets) { uint32_t n = o; o = sum; sum += n; }
+        for (size_t t = 0; t < triCount; t++) {
+            uint32_t slot = offsets[(keys[t] >> shift) & 1023]++;
+            keysTmp[slot] = keys[t];
+            orderTmp[slot] = order[t];
+        }
+        keys.swap(keysTmp);
+        order.swap(orderTmp);
+    }
+
+    // Emit triangles and per-cluster bounds
+    struct ClusterScratch {
+        std::vector<uint32_t> global, unique, local, ordered;
+        TipsifyScratch tipsify;
+    };
+    std::vector<ClusterScratch> scratch(optimizeCache ? pool.size() : 0);
+    size_t clusterCount = (triCount + trianglesPerCluster - 1) / trianglesPerCluster;
+    clusters.resize(clusterCount);
+    pool.parallelFor(clusterCount, [&](size_t ci, unsigned worker) {
+        MeshCluster& c = clusters[ci];
+        size_t first = ci * trianglesPerCluster;
+        size_t last = std::min(triCount, first + trianglesPerCluster);
+        c.firstIndex = (uint32_t)(first * 3);
+        c.indexCount = (uint32_t)((last - first) * 3);
+
+        uint32_t* dst = outIndices + c.firstIndex;
+        if (optimizeCache) {
+            // Tipsify on cluster-local vertex ids
+            ClusterScratch& cs = scratch[worker];
+            cs.global.clear();
+            for (size_t s = first; s < last; s++) {
+                const uint32_t* tri = indices + 3 * (size_t)order[s];
+                cs.global.insert(cs.global.end(), tri, tri + 3);
+            }
+            cs.unique = cs.global;
+            std::sort(cs.unique.begin(), cs.unique.end());
+            cs.unique.erase(std::unique(cs.unique.begin(), cs.unique.end()), cs.unique.end());
+            cs.local.resize(cs.global.size());
+            for (size_t i = 0; i < cs.global.size(); i++) {
+                cs.local[i] = (uint32_t)(std::lower_bound(cs.unique.begin(), cs.unique.end(), cs.global[i]) - cs.unique.begin());
+            }
+            cs.ordered.resize(cs.local.size());
+            tipsify(cs.local.data(), cs.local.size(), cs.unique.size(), cs.ordered.data(), cs.tipsify);
+            for (size_t i = 0; i < cs.ordered.size(); i++) dst[i] = cs.unique[cs.ordered[i]] + vertexOffset;
+        } else {
+            for (size_t s = first; s < last; s++) {
+                const uint32_t* tri = indices + 3 * (size_t)order[s];
+                for (int k = 0; k < 3; k++) *dst++ = tri[k] + vertexOffset;
+            }
+        }
+
+        Vec3 cmin(FLT_MAX, FLT_MAX, FLT_MAX), cmax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        Vec3 axis(0, 0, 0);
+        for (size_t s = first; s < last; s++) {
+            const uint32_t* tri = indices + 3 * (size_t)order[s];
+            for (int k = 0; k < 3; k++) {
+                const Vec3& p = positions[tri[k]];
+                cmin = Vec3(std::min(cmin.x, p.x), std::min(cmin.y, p.y), std::min(cmin.z, p.z));
+                cmax = Vec3(std::max(cmax.x, p.x), std::max(cmax.y, p.y), std::max(cmax.z, p.z));
+            }
+            const Vec3& p0 = positions[tri[0]];
+            Vec3 n = (positions[tri[2]] - p0).cross(positions[tri[1]] - p0);
+            float len = n.length();
+            if (len > 0) axis = axis + n * (1.0f / len);
+        }
+        c.center = (cmin + cmax) * 0.5f;
+        for (size_t s = first; s < last; s++) {
+            for (int k = 0; k < 3; k++) {
+                c.radius = std::max(c.radius, (positions[indices[3 * (size_t)order[s] + k]] - c.center).length());
+            }
+        }
+
+        // Normal cone (as in meshoptimizer): the tightest cutoff over all
+        // faces, with the apex pulled back so that it lies behind each
+        // face plane, which keeps the per-cluster test conservative
+        float axisLen = axis.length();
+        if (axisLen <= 0) return;
+        c.coneAxis = axis * (1.0f / axisLen);
+        float minDot = 1.0f, maxT = 0.0f;
+        for (size_t s = first; s < last; s++) {
+            const uint32_t* tri = indices + 3 * (size_t)order[s];
+            const Vec3& p0 = positions[tri[0]];
+            Vec3 n = (positions[tri[2]] - p0).cross(positions[tri[1]] - p0);
+            float len = n.length();
+            if (len <= 0) continue;
+            n = n * (1.0f / len);
+            float dn = n.dot(c.coneAxis);
+            minDot = std::min(minDot, dn);
+            if (dn > 0) maxT = std::max(maxT, (c.center - p0).dot(n) / dn);
+        }
+        if (minDot <= 0.1f) return;  // Wider than ~84°, culling would rarely pay off
+        c.coneApex = c.center - c.coneAxis * maxT;
+        c.coneCutoff = std::sqrt(1.0f - minDot * minDot);
+    });
+    return clusters;
+}
+
+// ============================================================================
+// COMPACT VERTICES - 16-bit positions, octahedral normals, 8-bit colors
+// ============================================================================
+
+constexpr float QUANTIZE_POSITION_MAX = 65535.0f;  // UNORM16 steps across the bounds
+
+// Octahedral normal encoding (Cigolle et al. 2014): the unit sphere is folded
+// onto a square and stored as two SNORM16 values, error well under 0.01°
+inline void encodeOctahedral(const Vec3& n, int16_t out[2]) {
+    float l1 = std::abs(n.x) + std::abs(n.y) + std::abs(n.z);
+    float x = l1 > 0 ? n.x / l1 : 0, y = l1 > 0 ? n.y / l1 : 0;
+    if (n.z < 0) {
+        float fx = (1.0f - std::abs(y)) * (x >= 0 ? 1.0f : -1.0f);
+        y = (1.0f - std::abs(x)) * (y >= 0 ? 1.0f : -1.0f);
+        x = fx;
+    }
+    out[0] = (int16_t)std::lround(std::max(-1.0f, std::min(1.0f, x)) * 32767.0f);
+    out[1] = (int16_t)std::lround(std::max(-1.0f, std::min(1.0f, y)) * 32767.0f);
+}
+
+inline Vec3 decodeOctahedral(const int16_t in[2]) {
+    float x = std::max(in[0] / 32767.0f, -1.0f), y = std::max(in[1] / 32767.0f, -1.0f);
+    float z = 1.0f - std::abs(x) - std::abs(y);
+    if (z < 0) {
+        float fx = (1.0f - std::abs(y)) * (x >= 0 ? 1.0f : -1.0f);
+        y = (1.0f - std::abs(x)) * (y >= 0 ? 1.0f : -1.0f);
+        x = fx;
+    }
+    return Vec3(x, y, z).normalized();
+}
+
+inline uint8_t unorm8(float v) {
+    return (uint8_t)std::lround(std::max(0.0f, std::min(1.0f, v)) * 255.0f);
+}
+
+// Uniform 16-bit grid over a bounding box: position = origin + q * step.
+// One step for all axes keeps dequantization a uniform scale, so a glTF
+// node transform (or a shader constant) restores it without bending normals.
+struct PositionQuantizer {
+    Vec3 origin;
+    float step = 1.0f;
+
+    PositionQuantizer() : origin(0, 0, 0) {}
+    PositionQuantizer(const Vec3& lo, const Vec3& hi) : origin(lo) {
+        float extent = std::max(hi.x - lo.x, std::max(hi.y - lo.y, hi.z - lo.z));
+        step = extent > 0 ? extent / QUANTIZE_POSITION_MAX : 1.0f;
+    }
+
+    // Grid covering positions[0..count)
+    template<typename Positions>
+    static PositionQuantizer fit(const Positions& positions, size_t count) {
+        if (count == 0) return {};
+        Vec3 lo = positions[0], hi = positions[0];
+        for (size_t i = 1; i < count; i++) {
+            const Vec3& v = positions[i];
+            lo = Vec3(std::min(lo.x, v.x), std::min(lo.y, v.y), std::min(lo.z, v.z));
+            hi = Vec3(std::max(hi.x, v.x), std::max(hi.y, v.y), std::max(hi.z, v.z));
+        }
+        return PositionQuantizer(lo, hi);
+    }
+
+    void encode(const Vec3& p, uint16_t out[3]) const {
+        float inv = 1.0f / step;
+        const float d[3] = {(p.x - origin.x) * inv, (p.y - origin.y) * inv, (p.z - origin.z) * inv};
+        for (int a = 0; a < 3; a++) {
+            out[a] = (uint16_t)std::lround(std::max(0.0f, std::min(QUANTIZE_POSITION_MAX, d[a])));
+        }
+    }
+    Vec3 decode(const uint16_t q[3]) const {
+        return origin + Vec3((float)q[0], (float)q[1], (float)q[2]) * step;
+    }
+};
+
+// 16-byte vertex: RGBA16 UNORM position (w unused), RG16 SNORM octahedral
+// normal, RGBA8 UNORM color, against 36 bytes for float position/normal/color.
+// A zero color means "no vertex color", as in the preview shader.
+struct CompactVertex {
+    uint16_t position[4];
+    int16_t normal[2];
+    uint8_t color[4];
+};
+static_assert(sizeof(CompactVertex) == 16, "CompactVertex must stay 16 bytes");
+
+inline CompactVertex packVertex(const PositionQuantizer& quantizer, const Vec3& p, const Vec3& n,
+                                const Color3* color = nullptr) {
+    CompactVertex v;
+    quantizer.encode(p, v.position);
+    v.position[3] = 0;
+    encodeOctahedral(n, v.normal);
+    v.color[0] = color ? unorm8(color->r) : 0;
+    v.color[1] = color ? unorm8(color->g) : 0;
+    v.color[2] = color ? unorm8(color->b) : 0;
+    v.color[3] = color ? 255 : 0;
+    return v;
+}
+
+// ============================================================================
+// FILE EXPORT - buffered writers (OBJ text, binary STL/PLY)
+// ============================================================================
+
+constexpr size_t EXPORT_CHUNK_ITEMS = 1 << 16;  // Vertices/faces formatted per task
+
+// Write an unsigned integer, returns the end of the text
+inline char* formatUint(char* out, uint64_t v) {
+    char tmp[20];
+    int n = 0;
+    do { tmp[n++] = (char)('0' + v % 10); v /= 10; } while (v);
+    while (n) *out++ = tmp[--n];
+    return out;
+}
+
+// Write a float like printf("%g") (6 significant digits, the iostream
+// default) without locale or stream overhead, returns the end of the text.
+// Values outside [1e-4, 1e6) fall back to snprintf.
+inline char* formatFloat(char* out, float value) {
+    static const double pow10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+    double v = value;
+    double a = std::abs(v);
+    if (std::signbit(v)) *out++ = '-';
+    if (a == 0.0) { *out++ = '0'; return out; }
+    if (!(a >= 1e-4 && a < 1e6)) return out + snprintf(out, 16, "%g", a);
+
+    // a * 10^decimals is exact in double for any float, so nearbyint gives
+    // printf's round-half-to-even on the true value
+    int decimals = 5 - (int)std::floor(std::log10(a));
+    decimals = std::max(0, std::min(9, decimals));
+    uint64_t r = (uint64_t)std::nearbyint(a * pow10[decimals]);
+    if (r < 100000 && decimals < 9) r = (uint64_t)std::nearbyint(a * pow10[++decimals]);
+    if (r >= 1000000) {  // rounding carried into the next power of ten
+        if (decimals == 0) return out + snprintf(out, 16, "%g", a);
+        r = (uint64_t)std::nearbyint(a * pow10[--decimals]);
+    }
+    uint64_t scale = (uint64_t)pow10[decimals];
+    out = formatUint(out, r / scale);
+    uint64_t frac = r % scale;
+    if (frac) {
+        int digits = decimals;
+        while (frac % 10 == 0) { frac /= 10; digits--; }
+        *out++ = '.';
+        char* end = out + digits;
+        for (char* p = end; p > out; frac /= 10) *--p = (char)('0' + frac % 10);
+        out = end;
+    }
+    return out;
+}
+
+// Serialise count items through format(dst, item) -> end of written bytes,
+// at most maxItemBytes each. Chunks of items are formatted into their own
+// buffers in parallel, one batch of chunks at a time, then written in order,
+// so memory stays bounded and the output is identical for any thread count.
+template<typename FormatFn>
+inline bool writeChunked(std::ofstream& file, size_t count, size_t maxItemBytes, FormatFn&& format) {
+    ThreadPool& pool = ThreadPool::instance();
+    size_t chunks = (count + EXPORT_CHUNK_ITEMS - 1) / EXPORT_CHUNK_ITEMS;
+    size_t batch = (size_t)pool.size() * 2;
+    std::vector<std::vector<char>> buffers(std::min(batch, chunks));
+    std::vector<size_t> used(buffers.size());
+
+    for (size_t first = 0; first < chunks; first += batch) {
+        size_t n = std::min(batch, chunks - first);
+        pool.parallelFor(n, [&](size_t b, unsigned) {
+            size_t begin = (first + b) * EXPORT_CHUNK_ITEMS;
+            size_t end = std::min(count, begin + EXPORT_CHUNK_ITEMS);
+            buffers[b].resize((end - begin) * maxItemBytes);
+            char* dst = buffers[b].data();
+            for (size_t i = begin; i < end; i++) dst = format(dst, i);
+            used[b] = (size_t)(dst - buffers[b].data());
+        });
+        for (size_t b = 0; b < n; b++) file.write(buffers[b].data(), (std::streamsize)used[b]);
+        if (!file) return false;
+    }
+    return true;
+}
+
+// Export mesh to OBJ file with optional colors and UVs
+inline bool exportOBJ(const std::string& filename, const Mesh& mesh,
+                      bool includeColors = false, bool includeUVs = false) {
+    if (mesh.vertices.empty()) return false;
+
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    // Use C locale to avoid thousands separators in numbers
+    file.imbue(std::locale::classic());
+
+    file << "# Generated by Marching Cubes (Parallel)\n";
+    file << "# Vertices: " << mesh.vertices.size() << "\n";
+    file << "# Triangles: " << mesh.indices.size() / 3 << "\n";
+    if (includeColors && mesh.hasColors()) file << "# With vertex colors\n";
+    if (includeUVs && mesh.hasUVs()) file << "# With UV coordinates\n";
+    file << "\n";
+
+    // Formatted floats are at most 13 characters ("-1.23457e+06"), indices 10
+    constexpr size_t F = 14, I = 11;
+    auto floats = [](char* dst, const char* prefix, const float* v, int n) {
+        while (*prefix) *dst++ = *prefix++;
+        for (int k = 0; k < n; k++) {
+            if (k) *dst++ = ' ';
+            dst = formatFloat(dst, v[k]);
+        }
+        *dst++ = '\n';
+        return dst;
+    };
+
+    // Write vertices (optionally with colors)
+    bool writeColors = includeColors && mesh.hasColors();
+    writeChunked(file, mesh.vertices.size(), 3 + 6 * F, [&](char* dst, size_t i) {
+        const Vec3& v = mesh.vertices[i];
+        if (writeColors) {
+            const Color3& c = mesh.colors[i];
+            float vc[6] = {v.x, v.y, v.z, c.r, c.g, c.b};
+            return floats(dst, "v ", vc, 6);
+        }
+        float p[3] = {v.x, v.y, v.z};
+        return floats(dst, "v ", p, 3);
+    });
+
+    // Write texture coordinates
+    if (includeUVs && mesh.hasUVs()) {
+        file << "\n";
+        writeChunked(file, mesh.uvs.size(), 4 + 2 * F, [&](char* dst, size_t i) {
+            float uv[2] = {mesh.uvs[i].u, mesh.uvs[i].v};
+            return floats(dst, "vt ", uv, 2);
+        });
+    }
+
+    // Write normals
+    if (mesh.hasNormals()) {
+        file << "\n";
+        writeChunked(file, mesh.normals.size(), 4 + 3 * F, [&](char* dst, size_t i) {
+            float n[3] = {mesh.normals[i].x, mesh.normals[i].y, mesh.normals[i].z};
+            return floats(dst, "vn ", n, 3);
+        });
+    }
+
+    // Write faces (winding order flipped for correct OBJ convention: CCW = front face)
+    file << "\n";
+    bool hasUV = includeUVs && mesh.hasUVs();
+    bool hasN = mesh.hasNormals();
+    const char* sep = hasUV && hasN ? "/" : hasN ? "//" : "/";
+    int refs = hasUV && hasN ? 3 : (hasUV || hasN) ? 2 : 1;
+
+    bool ok = writeChunked(file, mesh.indices.size() / 3, 3 + 3 * (3 * I + 3), [&](char* dst, size_t t) {
+        // Flip winding: i0, i2, i1 instead of i0, i1, i2
+        uint32_t idx[3] = {mesh.indices[3*t] + 1, mesh.indices[3*t+2] + 1, mesh.indices[3*t+1] + 1};
+        *dst++ = 'f';
+        for (uint32_t i : idx) {
+            *dst++ = ' ';
+            dst = formatUint(dst, i);
+            for (int r = 1; r < refs; r++) {
+                for (const char* c = (r == 1 ? sep : "/"); *c; c++) *dst++ = *c;
+                dst = formatUint(dst, i);
+            }
+        }
+        *dst++ = '\n';
+        return dst;
+    });
+
+    file.close();
+    return ok && !file.fail();
+}
+
+// Export mesh to binary STL (facet normals from the flipped, CCW winding)
+inline bool exportSTL(const std::string& filename, const Mesh& mesh) {
+    if (mesh.vertices.empty()) return false;
+
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    char header[80] = {};
+    snprintf(header, sizeof(header), "Generated by Marching Cubes (Parallel)");
+    uint32_t triangleCount = (uint32_t)(mesh.indices.size() / 3);
+    file.write(header, sizeof(header));
+    file.write(reinterpret_cast<const char*>(&triangleCount), 4);
+
+    bool ok = writeChunked(file, triangleCount, 50, [&](char* dst, size_t t) {
+        const Vec3& a = mesh.vertices[mesh.indices[3*t]];
+        const Vec3& b = mesh.vertices[mesh.indices[3*t+2]];  // Swapped, as in exportOBJ
+        const Vec3& c = mesh.vertices[mesh.indices[3*t+1]];
+        Vec3 n = (b - a).cross(c - a).normalized();
+        float facet[12] = {n.x, n.y, n.z, a.x, a.y, a.z, b.x, b.y, b.z, c.x, c.y, c.z};
+        memcpy(dst, facet, sizeof(facet));
+        dst[48] = dst[49] = 0;  // Attribute byte count
+        return dst + 50;
+    });
+
+    file.close();
+    return ok && !file.fail();
+}
+
+// Export mesh to binary little-endian PLY with normals and optional colors
+inline bool exportPLY(const std::string& filename, const Mesh& mesh, bool includeColors = false) {
+    if (mesh.vertices.empty()) return false;
+
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) return false;
+    file.imbue(std::locale::classic());
+
+    bool writeNormals = mesh.hasNormals();
+    bool writeColors = includeColors && mesh.hasColors();
+    size_t triangleCount = mesh.indices.size() / 3;
+    file << "ply\nformat binary_little_endian 1.0\n"
+         << "comment Generated by Marching Cubes (Parallel)\n"
+         << "element vertex " << mesh.vertices.size() << "\n"
+         << "property float x\nproperty float y\nproperty float z\n";
+    if (writeNormals) file << "property float nx\nproperty float ny\nproperty float nz\n";
+    if (writeColors) file << "property uchar red\nproperty uchar green\nproperty uchar blue\n";
+    file << "element face " << triangleCount << "\n"
+         << "property list uchar uint vertex_indices\nend_header\n";
+
+    size_t vertexBytes = 12 + (writeNormals ? 12 : 0) + (writeColors ? 3 : 0);
+    writeChunked(file, mesh.vertices.size(), vertexBytes, [&](char* dst, size_t i) {
+        memcpy(dst, &mesh.vertices[i], 12);
+        dst += 12;
+        if (writeNormals) {
+            memcpy(dst, &mesh.normals[i], 12);
+            dst += 12;
+        }
+        if (writeColors) {
+            const Color3& c = mesh.colors[i];
+            for (float f : {c.r, c.g, c.b}) {
+                *dst++ = (char)(uint8_t)std::lround(std::max(0.0f, std::min(1.0f, f)) * 255.0f);
+            }
+        }
+        return dst;
+    });
+
+    bool ok = writeChunked(file, triangleCount, 13, [&](char* dst, size_t t) {
+        uint32_t idx[3] = {mesh.indices[3*t], mesh.indices[3*t+2], mesh.indices[3*t+1]};  // CCW
+        *dst++ = 3;
+        memcpy(dst, idx, 12);
+        return dst + 12;
+    });
+
+    file.close();
+    return ok && !file.fail();
+}
+
+// ============================================================================
+// GLB EXPORT - direct writer
+// ============================================================================
+
+constexpr size_t GLB_WRITE_MAX_BYTES = size_t(1) << 30;  // Per writev call (macOS caps at INT_MAX)
+
+static_assert(sizeof(Vec3) == 3 * sizeof(float) && sizeof(Color3) == 3 * sizeof(float),
+              "GLB export writes Vec3/Color3 arrays as tightly packed VEC3 floats");
+
+// Write all of iov to fd, resuming after partial writes and keeping each
+// call within IOV_MAX entries and GLB_WRITE_MAX_BYTES bytes
+inline bool writeAllV(int fd, std::vector<iovec> iov) {
+    size_t first = 0;
+    while (first < iov.size()) {
+        if (iov[first].iov_len == 0) { first++; continue; }
+        size_t n = 0, bytes = 0;
+        while (first + n < iov.size() && n < (size_t)IOV_MAX &&
+               bytes + iov[first + n].iov_len <= GLB_WRITE_MAX_BYTES) {
+            bytes += iov[first + n++].iov_len;
+        }
+        iovec head = iov[first];
+        if (n == 0) head.iov_len = GLB_WRITE_MAX_BYTES;  // Split an oversized array
+
+        ssize_t written = n ? ::writev(fd, iov.data() + first, (int)n) : ::writev(fd, &head, 1);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        size_t left = (size_t)written;
+        while (first < iov.size() && left >= iov[first].iov_len) left -= iov[first++].iov_len;
+        if (left) {
+            iov[first].iov_base = static_cast<char*>(iov[first].iov_base) + left;
+            iov[first].iov_len -= left;
+        }
+    }
+    return true;
+}
+
+// Position of corner i after swapping the last two corners of its triangle,
+// which turns MC winding (clockwise from outside) into glTF's CCW and back
+inline size_t ccwCorner(size_t i) {
+    return i % 3 ? i - i % 3 + 3 - i % 3 : i;
+}
+
+// Write meshes to one GLB without building a tinygltf model: the JSON
+// chunk is assembled by hand and the BIN chunk is gathered with writev
+// straight from the Mesh vectors, so export never copies vertex data.
+// Each mesh gets its own node; with lodChain the nodes are named LOD<n>
+// and node 0 lists the others through MSFT_lod.
+//
+// quantize writes KHR_mesh_quantization attributes instead: UNSIGNED_SHORT
+// positions on a PositionQuantizer grid (undone by the node's translation and
+// uniform scale), normalized BYTE normals, normalized UNSIGNED_BYTE RGBA
+// colors and 16-bit indices when they fit. Core glTF has no octahedral
+// normals, so files keep 4-byte normals where the preview uses CompactVertex.
+//
+// glTF triangles are counter-clockwise seen from outside, so indices go out
+// with the last two corners of each triangle swapped, as in exportOBJ;
+// GLBPrimitive::index swaps them back on load.
+inline bool writeGLB(const std::string& filename, const std::vector<const Mesh*>& meshes,
+                     bool includeColors, bool lodChain, bool quantize = false) {
+    std::string accessors, views, meshJson, nodes;
+    std::vector<iovec> arrays;
+    std::vector<std::vector<uint8_t>> packed;  // Quantized arrays, alive until writev
+    static const uint8_t zeros[4] = {};
+    size_t binBytes = 0, viewCount = 0;
+
+    auto addArray = [&](const void* data, size_t bytes, int target, int componentType,
+                        const char* type, size_t count, const std::string& extra = "",
+                        size_t byteStride = 0) {
+        size_t view = viewCount++;
+        if (view) { views += ','; accessors += ','; }
+        views += "{\"buffer\":0,\"byteOffset\":" + std::to_string(binBytes) +
+                 ",\"byteLength\":" + std::to_string(bytes) +
+                 (byteStride ? ",\"byteStride\":" + std::to_string(byteStride) : "") +
+                 ",\"target\":" + std::to_string(target) + "}";
+        accessors += "{\"bufferView\":" + std::to_string(view) + ",\"componentType\":" +
+                     std::to_string(componentType) + ",\"count\":" + std::to_string(count) +
+                     ",\"type\":\"" + type + "\"" + extra + "}";
+        arrays.push_back({const_cast<void*>(data), bytes});
+        binBytes += bytes;
+        if (bytes % 4) {  // Keep every view 4-byte aligned (16-bit index arrays)
+            arrays.push_back({const_cast<uint8_t*>(zeros), 4 - bytes % 4});
+            binBytes += 4 - bytes % 4;
+        }
+        return std::to_string(view);
+    };
+    auto pack = [&](size_t count, size_t elementBytes, auto&& fill) {
+        packed.emplace_back(count * elementBytes);
+        uint8_t* dst = packed.back().data();
+        const size_t CHUNK = 4096;
+        ThreadPool::instance().parallelFor((count + CHUNK - 1) / CHUNK, [&](size_t c, unsigned) {
+            size_t end = std::min(count, (c + 1) * CHUNK);
+            for (size_t i = c * CHUNK; i < end; i++) fill(dst + i * elementBytes, i);
+        });
+        return (const void*)dst;
+    };
+
+    for (size_t m = 0; m < meshes.size(); m++) {
+        const Mesh& mesh = *meshes[m];
+        size_t vertexCount = mesh.vertices.size();
+        bool withColors = includeColors && mesh.hasColors();
+        std::string attributes, indices, transform;
+
+        if (quantize) {
+            PositionQuantizer q = PositionQuantizer::fit(mesh.vertices, vertexCount);
+            uint16_t lo[3] = {UINT16_MAX, UINT16_MAX, UINT16_MAX}, hi[3] = {0, 0, 0};
+            const void* positions = pack(vertexCount, 8, [&](uint8_t* dst, size_t i) {
+                uint16_t p[4] = {0, 0, 0, 0};
+                q.encode(mesh.vertices[i], p);
+                memcpy(dst, p, sizeof(p));
+            });
+            for (size_t i = 0; i < vertexCount; i++) {
+                const uint16_t* p = reinterpret_cast<const uint16_t*>(positions) + 4 * i;
+                for (int a = 0; a < 3; a++) { lo[a] = std::min(lo[a], p[a]); hi[a] = std::max(hi[a], p[a]); }
+            }
+            char bounds[96];
+            snprintf(bounds, sizeof(bounds), ",\"min\":[%u,%u,%u],\"max\":[%u,%u,%u]",
+                     lo[0], lo[1], lo[2], hi[0], hi[1], hi[2]);
+            attributes = "\"POSITION\":" + addArray(positions, vertexCount * 8, 34962, 5123, "VEC3",
+                vertexCount, bounds, 8);
+
+            if (mesh.hasNormals()) {
+                const void* normals = pack(vertexCount, 4, [&](uint8_t* dst, size_t i) {
+                    Vec3 n = mesh.normals[i].normalized();
+                    for (int a = 0; a < 3; a++) {
+                        float f = a == 0 ? n.x : a == 1 ? n.y : n.z;
+                        dst[a] = (uint8_t)(int8_t)std::lround(std::max(-1.0f, std::min(1.0f, f)) * 127.0f);
+                    }
+                    dst[3] = 0;
+                });
+                attributes += ",\"NORMAL\":" + addArray(normals, vertexCount * 4, 34962, 5120, "VEC3",
+                    vertexCount, ",\"normalized\":true", 4);
+            }
+            if (withColors) {
+                const void* colors = pack(vertexCount, 4, [&](uint8_t* dst, size_t i) {
+                    const Color3& c = mesh.colors[i];
+                    dst[0] = unorm8(c.r); dst[1] = unorm8(c.g); dst[2] = unorm8(c.b); dst[3] = 255;
+                });
+                attributes += ",\"COLOR_0\":" + addArray(colors, vertexCount * 4, 34962, 5121, "VEC4",
+                    vertexCount, ",\"normalized\":true");
+            }
+            if (vertexCount <= UINT16_MAX) {
+                const void* shortIndices = pack(mesh.indices.size(), 2, [&](uint8_t* dst, size_t i) {
+                    uint16_t index = (uint16_t)mesh.indices[ccwCorner(i)];
+                    memcpy(dst, &index, 2);
+                });
+                indices = addArray(shortIndices, mesh.indices.size() * 2, 34963, 5123, "SCALAR",
+                    mesh.indices.size());
+            }
+
+            char trs[160];
+            snprintf(trs, sizeof(trs), ",\"translation\":[%.9g,%.9g,%.9g],\"scale\":[%.9g,%.9g,%.9g]",
+                     q.origin.x, q.origin.y, q.origin.z, q.step, q.step, q.step);
+            transform = trs;
+        } else {
+            // POSITION requires min/max bounds
+            float lo[3] = {FLT_MAX, FLT_MAX, FLT_MAX}, hi[3] = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+            for (const Vec3& v : mesh.vertices) {
+                lo[0] = std::min(lo[0], v.x); lo[1] = std::min(lo[1], v.y); lo[2] = std::min(lo[2], v.z);
+                hi[0] = std::max(hi[0], v.x); hi[1] = std::max(hi[1], v.y); hi[2] = std::max(hi[2], v.z);
+            }
+            char bounds[160];
+            snprintf(bounds, sizeof(bounds), ",\"min\":[%.9g,%.9g,%.9g],\"max\":[%.9g,%.9g,%.9g]",
+                     lo[0], lo[1], lo[2], hi[0], hi[1], hi[2]);
+
+            attributes = "\"POSITION\":" + addArray(mesh.vertices.data(), vertexCount * sizeof(Vec3),
+                34962, 5126, "VEC3", vertexCount, bounds);
+            if (mesh.hasNormals()) {
+                attributes += ",\"NORMAL\":" + addArray(mesh.normals.data(), vertexCount * sizeof(Vec3),
+                    34962, 5126, "VEC3", vertexCount);
+            }
+            if (withColors) {
+                // RGB float is a valid COLOR_0 layout, so Color3 goes out as-is
+                attributes += ",\"COLOR_0\":" + addArray(mesh.colors.data(), vertexCount * sizeof(Color3),
+                    34962, 5126, "VEC3", vertexCount);
+            }
+        }
+        if (indices.empty()) {
+            const void* ccwIndices = pack(mesh.indices.size(), 4, [&](uint8_t* dst, size_t i) {
+                memcpy(dst, &mesh.indices[ccwCorner(i)], 4);
+            });
+            indices = addArray(ccwIndices, mesh.indices.size() * sizeof(uint32_t),
+                34963, 5125, "SCALAR", mesh.indices.size());
+        }
+
+        std::string name = lodChain ? "\"name\":\"LOD" + std::to_string(m) + "\"," : "";
+        if (m) { meshJson += ','; nodes += ','; }
+        meshJson += "{" + name + "\"primitives\":[{\"attributes\":{" + attributes +
+                    "},\"indices\":" + indices + ",\"material\":0,\"mode\":4}]}";
+        nodes += "{" + name + "\"mesh\":" + std::to_string(m) + transform;
+        if (lodChain && m == 0 && meshes.size() > 1) {
+            nodes += ",\"extensions\":{\"MSFT_lod\":{\"ids\":[";
+            for (size_t i = 1; i < meshes.size(); i++) nodes += (i > 1 ? "," : "") + std::to_string(i);
+            nodes += "]}}";
+        }
+        nodes += "}";
+    }
+
+    std::string extensions;
+    if (lodChain && meshes.size() > 1) extensions += "\"MSFT_lod\"";
+    if (quantize) extensions += std::string(extensions.empty() ? "" : ",") + "\"KHR_mesh_quantization\"";
+    std::string json =
+        "{\"asset\":{\"version\":\"2.0\",\"generator\":\"Marching Cubes Exporter\"},"
+        "\"scene\":0,\"scenes\":[{\"nodes\":[0]}],\"nodes\":[" + nodes + "],"
+        "\"meshes\":[" + meshJson + "],"
+        "\"materials\":[{\"name\":\"VertexColorMaterial\",\"pbrMetallicRoughness\":{"
+        "\"baseColorFactor\":[1,1,1,1],\"metallicFactor\":0,\"roughnessFactor\":0.8},\"doubleSided\":true}],"
+        "\"accessors\":[" + accessors + "],\"bufferViews\":[" + views + "],"
+        "\"buffers\":[{\"byteLength\":" + std::to_string(binBytes) + "}]" +
+        (extensions.empty() ? "" : ",\"extensionsUsed\":[" + extensions + "]") +
+        (quantize ? ",\"extensionsRequired\":[\"KHR_mesh_quantization\"]" : "") + "}";
+    json.resize((json.size() + 3) & ~size_t(3), ' ');  // Chunks are 4-byte aligned
+
+    // addArray pads every view to 4 bytes, so BIN needs no padding
+    uint64_t total = 12 + 8 + json.size() + 8 + binBytes;
+    if (total > UINT32_MAX) {
+        std::cerr << "GLB export: " << total << " bytes exceeds the 4 GB GLB limit" << std::endl;
+        return false;
+    }
+    uint32_t header[5] = {0x46546C67, 2, (uint32_t)total, (uint32_t)json.size(), 0x4E4F534A};  // "glTF", "JSON"
+    uint32_t binHeader[2] = {(uint32_t)binBytes, 0x004E4942};  // "BIN"
+
+    std::vector<iovec> iov;
+    iov.reserve(arrays.size() + 3);
+    iov.push_back({header, sizeof(header)});
+    iov.push_back({const_cast<char*>(json.data()), json.size()});
+    iov.push_back({binHeader, sizeof(binHeader)});
+    iov.insert(iov.end(), arrays.begin(), arrays.end());
+
+    int fd = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return false;
+    bool ok = writeAllV(fd, std::move(iov));
+    return ::close(fd) == 0 && ok;
+}
+
+// Export mesh to GLB (binary GLTF) with proper vertex color support;
+// quantize writes KHR_mesh_quantization attributes (about 2x smaller)
+inline bool exportGLB(const std::string& filename, const Mesh& mesh,
+                      bool includeColors = true, bool quantize = false) {
+    if (mesh.vertices.empty()) return false;
+    return writeGLB(filename, {&mesh}, includeColors, false, quantize);
+}
+
+// Export a LOD chain (finest first) to one GLB: each level is its own mesh
+// and node "LOD<n>". The scene holds LOD0, which lists the coarser nodes
+// through MSFT_lod, so plain viewers show the full mesh and LOD-aware
+// runtimes can pick a level by distance.
+inline bool exportGLB(const std::string& filename, const std::vector<Mesh>& lods,
+                      bool includeColors = true, bool quantize = false) {
+    if (lods.empty() || lods[0].vertices.empty()) return false;
+
+    std::vector<const Mesh*> levels;
+    for (const Mesh& lod : lods) {
+        if (lod.vertices.empty()) break;
+        levels.push_back(&lod);
+    }
+    return writeGLB(filename, levels, includeColors, true, quantize);
+}
+
+// ============================================================================
+// GLB LOADING - memory-mapped reader
+// ============================================================================
+
+// Minimal JSON DOM, enough for the JSON chunk of a GLB
+struct JsonValue {
+    enum Type { Null, Bool, Number, String, Array, Object };
+    Type type = Null;
+    double number = 0;  // Bool is stored as 0/1
+    std::string string;
+    std::vector<JsonValue> items;                            // Array elements
+    std::vector<std::pair<std::string, JsonValue>> members;  // Object members in file order
+
+    const JsonValue* get(const char* key) const {
+        for (const auto& m : members) if (m.first == key) return &m.second;
+        return nullptr;
+    }
+    const JsonValue* at(int64_t i) const {
+        return type == Array && i >= 0 && (size_t)i < items.size() ? &items[(size_t)i] : nullptr;
+    }
+    // Integer member, or fallback when missing or not a number
+    int64_t getInt(const char* key, int64_t fallback = -1) const {
+        const JsonValue* v = get(key);
+        // Out-of-range numbers (and NaN) fall back: the cast would be undefined
+        if (!v || v->type != Number || !(v->number >= -9.2e18 && v->number <= 9.2e18)) return fallback;
+        return (int64_t)v->number;
+    }
+};
+
+// Recursive-descent JSON parser (locale independent, nesting capped)
+struct JsonParser {
+    const char* p;
+    const char* end;
+    int depth = 0;
+
+    static constexpr int MAX_DEPTH = 64;
+
+    void skipSpace() { while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')) p++; }
+    bool literal(const char* word) {
+        size_t n = strlen(word);
+        if ((size_t)(end - p) < n || memcmp(p, word, n) != 0) return false;
+        p += n;
+        return true;
+    }
+
+    bool parseString(std::string& out) {
+        if (p >= end || *p != '"') return false;
+        p++;
+        while (p < end && *p != '"') {
+            if (*p != '\\') { out += *p++; continue; }
+            if (++p >= end) return false;
+            char c = *p++;
+            switch (c) {
+                case 'b': out += '\b'; break;
+                case 'f': out += '\f'; break;
+                case 'n': out += '\n'; break;
+                case 'r': out += '\r'; break;
+                case 't': out += '\t'; break;
+                case 'u': {
+                    if (end - p < 4) return false;
+                    uint32_t cp = 0;
+                    for (int i = 0; i < 4; i++) {
+                        char h = *p++;
+                        cp = cp * 16 + (uint32_t)(h >= 'a' ? h - 'a' + 10 : h >= 'A' ? h - 'A' + 10 : h - '0');
+                    }
+                    // Encode as UTF-8 (surrogate halves are kept as-is, names only)
+                    if (cp < 0x80) out += (char)cp;
+                    else if (cp < 0x800) { out += (char)(0xC0 | (cp >> 6)); out += (char)(0x80 | (cp & 0x3F)); }
+                    else {
+                        out += (char)(0xE0 | (cp >> 12));
+                        out += (char)(0x80 | ((cp >> 6) & 0x3F));
+                        out += (char)(0x80 | (cp & 0x3F));
+                    }
+                    break;
+                }
+                default: out += c; break;  // \" \\ \/
+            }
+        }
+        if (p >= end) return false;
+        p++;
+        return true;
+    }
+
+    bool parseNumber(double& out) {
+        bool negative = p < end && *p == '-';
+        if (negative) p++;
+        int64_t mantissa = 0;
+        int exponent = 0, digits = 0;
+        for (; p < end && *p >= '0' && *p <= '9'; p++, digits++) {
+            if (mantissa < 100000000000000000LL) mantissa = mantissa * 10 + (*p - '0');
+            else exponent++;
+        }
+        if (p < end && *p == '.') {
+            for (p++; p < end && *p >= '0' && *p <= '9'; p++, digits++) {
+                if (mantissa < 100000000000000000LL) { mantissa = mantissa * 10 + (*p - '0'); exponent--; }
+            }
+        }
+        if (!digits) return false;
+        if (p < end && (*p == 'e' || *p == 'E')) {
+            p++;
+            bool negExp = p < end && *p == '-';
+            if (p < end && (*p == '-' || *p == '+')) p++;
+            int e = 0;
+            for (; p < end && *p >= '0' && *p <= '9'; p++) e = std::min(e * 10 + (*p - '0'), 1000);
+            exponent += negExp ? -e : e;
+        }
+        out = (double)mantissa * std::pow(10.0, exponent);
+        if (negative) out = -out;
+        return true;
+    }
+
+    bool parse(JsonValue& out) {
+        skipSpace();
+        if (p >= end || depth > MAX_DEPTH) return false;
+        char c = *p;
+        if (c == '{' || c == '[') {
+            bool object = c == '{';
+            out.type = object ? JsonValue::Object : JsonValue::Array;
+            p++;
+            depth++;
+            skipSpace();
+            if (p < end && *p == (object ? '}' : ']')) { p++; depth--; return true; }
+            while (true) {
+                if (object) {
+                    out.members.emplace_back();
+                    skipSpace();
+                    if (!parseString(out.members.back().first)) return false;
+                    skipSpace();
+                    if (p >= end || *p++ != ':') return false;
+                    if (!parse(out.members.back().second)) return false;
+                } else {
+                    out.items.emplace_back();
+                    if (!parse(out.items.back())) return false;
+                }
+                skipSpace();
+                if (p >= end) return false;
+                if (*p == ',') { p++; continue; }
+                if (*p++ != (object ? '}' : ']')) return false;
+                depth--;
+                return true;
+            }
+        }
+        if (c == '"') { out.type = JsonValue::String; return parseString(out.string); }
+        if (literal("true")) { out.type = JsonValue::Bool; out.number = 1; return true; }
+        if (literal("false")) { out.type = JsonValue::Bool; return true; }
+        if (literal("null")) return true;
+        out.type = JsonValue::Number;
+        return parseNumber(out.number);
+    }
+};
+
+// Typed view over strided elements of a mapped buffer
+template<typename T>
+struct StridedView {
+    const uint8_t* data = nullptr;
+    size_t count = 0;
+    size_t stride = sizeof(T);
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    bool contiguous() const { return stride == sizeof(T); }
+    const T& operator[](size_t i) const { return *reinterpret_cast<const T*>(data + i * stride); }
+};
+
+// Validated accessor into the BIN chunk
+struct GLBAccessor {
+    const uint8_t* data = nullptr;
+    size_t count = 0;
+    size_t stride = 0;
+    int componentType = 0;
+    int components = 0;
+    bool normalized = false;
+
+    // View as T, which must cover at most the accessor's float components
+    template<typename T>
+    StridedView<T> as() const {
+        if (!data || componentType != 5126 || sizeof(T) > components * sizeof(float)) return {};
+        return {data, count, stride};
+    }
+    uint32_t index(size_t i) const {
+        const uint8_t* e = data + i * stride;
+        switch (componentType) {
+            case 5125: return *reinterpret_cast<const uint32_t*>(e);
+            case 5123: return *reinterpret_cast<const uint16_t*>(e);
+            default: return *e;
+        }
+    }
+    // Component c of element i as float, applying the normalized mapping
+    float component(size_t i, int c) const {
+        const uint8_t* e = data + i * stride;
+        switch (componentType) {
+            case 5126: return reinterpret_cast<const float*>(e)[c];
+            case 5123: return reinterpret_cast<const uint16_t*>(e)[c] / (normalized ? 65535.0f : 1.0f);
+            case 5122: { float v = reinterpret_cast<const int16_t*>(e)[c];
+                         return normalized ? std::max(v / 32767.0f, -1.0f) : v; }
+            case 5121: return e[c] / (normalized ? 255.0f : 1.0f);
+            case 5120: { float v = reinterpret_cast<const int8_t*>(e)[c];
+                         return normalized ? std::max(v / 127.0f, -1.0f) : v; }
+            default: return 0;
+        }
+    }
+};
+
+// Affine node transform, column-major like glTF's matrix (the last row is
+// always 0 0 0 1 and not stored)
+struct GLBTransform {
+    float m[12] = {1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0};  // Columns x, y, z, translation
+
+    // The node's matrix, or translation * rotation * scale
+    static GLBTransform fromNode(const JsonValue& node) {
+        GLBTransform t;
+        auto numbers = [&](const char* key, size_t n, float* out) {
+            const JsonValue* v = node.get(key);
+            if (!v || v->items.size() != n) return false;
+            for (size_t i = 0; i < n; i++) out[i] = (float)v->items[i].number;
+            return true;
+        };
+        float matrix[16];
+        if (numbers("matrix", 16, matrix)) {
+            for (int c = 0; c < 4; c++)
+                for (int r = 0; r < 3; r++) t.m[3 * c + r] = matrix[4 * c + r];
+            return t;
+        }
+        float tr[3] = {0, 0, 0}, q[4] = {0, 0, 0, 1}, sc[3] = {1, 1, 1};
+        numbers("translation", 3, tr);
+        numbers("rotation", 4, q);
+        numbers("scale", 3, sc);
+        float x = q[0], y = q[1], z = q[2], w = q[3];
+        float rot[9] = {1 - 2 * (y * y + z * z), 2 * (x * y + z * w), 2 * (x * z - y * w),
+                        2 * (x * y - z * w), 1 - 2 * (x * x + z * z), 2 * (y * z + x * w),
+                        2 * (x * z + y * w), 2 * (y * z - x * w), 1 - 2 * (x * x + y * y)};
+        for (int c = 0; c < 3; c++)
+            for (int r = 0; r < 3; r++) t.m[3 * c + r] = rot[3 * c + r] * sc[c];
+        for (int r = 0; r < 3; r++) t.m[9 + r] = tr[r];
+        return t;
+    }
+
+    GLBTransform operator*(const GLBTransform& o) const {
+        GLBTransform t;
+        for (int c = 0; c < 4; c++)
+            for (int r = 0; r < 3; r++) {
+                float v = c == 3 ? m[9 + r] : 0.0f;
+                for (int k = 0; k < 3; k++) v += m[3 * k + r] * o.m[3 * c + k];
+                t.m[3 * c + r] = v;
+            }
+        return t;
+    }
+
+    bool identity() const { return *this == GLBTransform(); }
+    bool operator==(const GLBTransform& o) const { return memcmp(m, o.m, sizeof(m)) == 0; }
+    float determinant() const {
+        return m[0] * (m[4] * m[8] - m[7] * m[5]) - m[3] * (m[1] * m[8] - m[7] * m[2]) +
+               m[6] * (m[1] * m[5] - m[4] * m[2]);
+    }
+    Vec3 point(const Vec3& p) const {
+        return Vec3(m[0] * p.x + m[3] * p.y + m[6] * p.z + m[9],
+                    m[1] * p.x + m[4] * p.y + m[7] * p.z + m[10],
+                    m[2] * p.x + m[5] * p.y + m[8] * p.z + m[11]);
+    }
+    // Normals go through the inverse transpose, i.e. the cofactor matrix
+    // (the missing 1/det is dropped by the normalisation). It scales with
+    // the square of the node scale, tiny under a quantization grid, so it
+    // is brought to unit size before normalized() sees it.
+    Vec3 normal(const Vec3& n) const {
+        Vec3 cx(m[0], m[1], m[2]), cy(m[3], m[4], m[5]), cz(m[6], m[7], m[8]);
+        Vec3 a = cy.cross(cz), b = cz.cross(cx), c = cx.cross(cy);
+        Vec3 out = a * n.x + b * n.y + c * n.z;
+        float largest = std::max({std::fabs(out.x), std::fabs(out.y), std::fabs(out.z)});
+        if (largest > 0.0f) out = out * ((determinant() < 0 ? -1.0f : 1.0f) / largest);
+        return out.normalized();
+    }
+};
+
+// One triangle primitive; normals/colors are empty when absent and
+// indices.data is null for non-indexed draws. index() returns MC winding:
+// it swaps the last two corners of each CCW glTF triangle, unless
+// flipWinding is set by a mirroring node transform, which already turns the
+// triangles over.
+struct GLBPrimitive {
+    StridedView<Vec3> positions;
+    StridedView<Vec3> normals;
+    StridedView<Color3> colors;
+    GLBAccessor indices;
+    bool flipWinding = false;
+
+    size_t indexCount() const { return indices.data ? indices.count : positions.count; }
+    uint32_t index(size_t i) const {
+        if (!flipWinding) i = ccwCorner(i);
+        return indices.data ? indices.index(i) : (uint32_t)i;
+    }
+};
+
+constexpr int64_t GLB_ALL_SCENES = -1;
+
+// Memory-mapped GLB file: open() validates the header and chunks and
+// parses the JSON, accessors are then served straight from the mapping
+struct GLBFile {
+    mutable std::string error;
+    JsonValue json;
+
+    GLBFile() = default;
+    GLBFile(const GLBFile&) = delete;
+    GLBFile& operator=(const GLBFile&) = delete;
+    ~GLBFile() { close(); }
+
+    bool open(const std::string& filename) {
+        close();
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) return fail("cannot open " + filename);
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size < 28) {
+            ::close(fd);
+            return fail("not a GLB file: " + filename);
+        }
+        size = (size_t)st.st_size;
+        void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (mapped == MAP_FAILED) { size = 0; return fail("mmap failed: " + filename); }
+        base = static_cast<const uint8_t*>(mapped);
+
+        uint32_t header[5];
+        memcpy(header, base, sizeof(header));
+        if (header[0] != 0x46546C67 || header[1] != 2) return fail("bad GLB header");
+        if (header[2] > size) return fail("truncated GLB");
+        size_t jsonLength = header[3];
+        if (header[4] != 0x4E4F534A || 20 + jsonLength > header[2]) return fail("bad GLB JSON chunk");
+
+        size_t binOffset = (20 + jsonLength + 3) & ~size_t(3);
+        if (binOffset + 8 <= header[2]) {
+            uint32_t chunk[2];
+            memcpy(chunk, base + binOffset, sizeof(chunk));
+            if (chunk[1] == 0x004E4942 && binOffset + 8 + chunk[0] <= header[2]) {
+                bin = base + binOffset + 8;
+                binSize = chunk[0];
+            }
+        }
+
+        JsonParser parser{reinterpret_cast<const char*>(base) + 20, reinterpret_cast<const char*>(base) + 20 + jsonLength};
+        if (!parser.parse(json) || json.type != JsonValue::Object) return fail("invalid GLB JSON");
+        return true;
+    }
+
+    void close() {
+        if (base) munmap(const_cast<uint8_t*>(base), size);
+        base = bin = nullptr;
+        size = binSize = 0;
+        json = JsonValue();
+        decoded.clear();
+    }
+
+    // Accessor `index` with bounds, stride and alignment checked against the
+    // BIN chunk; empty when it is missing, sparse or not in the BIN chunk
+    GLBAccessor accessor(int64_t index) const {
+        const JsonValue* accessors = json.get("accessors");
+        const JsonValue* a = accessors ? accessors->at(index) : nullptr;
+        if (!a || a->get("sparse")) return {};
+        const JsonValue* views = json.get("bufferViews");
+        const JsonValue* view = views ? views->at(a->getInt("bufferView")) : nullptr;
+        if (!view || view->getInt("buffer") != 0 || !bin) return {};
+
+        GLBAccessor out;
+        out.componentType = (int)a->getInt("componentType", 0);
+        const JsonValue* normalized = a->get("normalized");
+        out.normalized = normalized && normalized->number != 0;
+        const JsonValue* type = a->get("type");
+        std::string typeName = type ? type->string : "";
+        out.components = typeName == "SCALAR" ? 1 : typeName == "VEC2" ? 2 : typeName == "VEC3" ? 3 :
+                         typeName == "VEC4" ? 4 : 0;
+        size_t componentBytes = out.componentType == 5126 || out.componentType == 5125 ? 4 :
+                                out.componentType == 5123 || out.componentType == 5122 ? 2 :
+                                out.componentType == 5121 || out.componentType == 5120 ? 1 : 0;
+        if (!out.components || !componentBytes) return {};
+
+        int64_t count = a->getInt("count", 0);
+        int64_t viewOffset = view->getInt("byteOffset", 0);
+        int64_t viewLength = view->getInt("byteLength", 0);
+        int64_t offset = a->getInt("byteOffset", 0);
+        size_t elementBytes = out.components * componentBytes;
+        int64_t stride = view->getInt("byteStride", (int64_t)elementBytes);
+        if (count <= 0 || viewOffset < 0 || offset < 0 || viewLength < 0 ||
+            (uint64_t)viewOffset + (uint64_t)viewLength > binSize ||
+            stride < (int64_t)elementBytes || stride % componentBytes ||
+            (uint64_t)offset + elementBytes > (uint64_t)viewLength) {
+            return {};
+        }
+        // Divide rather than multiply: a huge count must not wrap the extent
+        uint64_t lastElement = ((uint64_t)viewLength - (uint64_t)offset - elementBytes) / (uint64_t)stride;
+        if ((uint64_t)count - 1 > lastElement) return {};
+        out.data = bin + viewOffset + offset;
+        if ((uintptr_t)out.data % componentBytes) return {};
+        out.count = (size_t)count;
+        out.stride = (size_t)stride;
+        return out;
+    }
+
+    // Triangle primitives of every mesh instance in scene `scene`, or in all
+    // scenes for GLB_ALL_SCENES (then also meshes no node references, as
+    // placed in the file, and every root node when there are no scenes).
+    // Nodes listed as MSFT_lod alternatives are skipped, so a LOD file yields
+    // only LOD0. Each instance gets its node's full world transform (matrix
+    // or TRS down the hierarchy). Float attributes are served from the
+    // mapping; quantized ones (KHR_mesh_quantization) and transformed
+    // positions/normals are decoded into float arrays owned by the file.
+    // Returns false if a primitive has invalid positions or indices.
+    bool primitives(std::vector<GLBPrimitive>& out, int64_t scene = GLB_ALL_SCENES) const {
+        const JsonValue* meshes = json.get("meshes");
+        if (!meshes) return true;
+        const JsonValue* nodes = json.get("nodes");
+        size_t nodeCount = nodes ? nodes->items.size() : 0;
+
+        std::vector<bool> isChild(nodeCount, false), isLod(nodeCount, false), meshPlaced(meshes->items.size(), false);
+        for (size_t n = 0; n < nodeCount; n++) {
+            const JsonValue& node = nodes->items[n];
+            if (const JsonValue* children = node.get("children")) {
+                for (const JsonValue& c : children->items) {
+                    if (c.number >= 0 && c.number < nodeCount) isChild[(size_t)c.number] = true;
+                }
+            }
+            const JsonValue* ext = node.get("extensions");
+            const JsonValue* lod = ext ? ext->get("MSFT_lod") : nullptr;
+            const JsonValue* ids = lod ? lod->get("ids") : nullptr;
+            if (ids) {
+                for (const JsonValue& id : ids->items) {
+                    if (id.number >= 0 && id.number < nodeCount) isLod[(size_t)id.number] = true;
+                }
+            }
+            int64_t mesh = node.getInt("mesh");
+            if (mesh >= 0 && (size_t)mesh < meshPlaced.size()) meshPlaced[(size_t)mesh] = true;
+        }
+
+        std::vector<int64_t> roots;
+        const JsonValue* scenes = json.get("scenes");
+        if (scene != GLB_ALL_SCENES) {
+            const JsonValue* s = scenes ? scenes->at(scene) : nullptr;
+            const JsonValue* sceneNodes = s ? s->get("nodes") : nullptr;
+            if (!sceneNodes) return fail("no scene " + std::to_string(scene));
+            for (const JsonValue& n : sceneNodes->items) roots.push_back((int64_t)n.number);
+        } else if (scenes && !scenes->items.empty()) {
+            for (const JsonValue& s : scenes->items) {
+                if (const JsonValue* sceneNodes = s.get("nodes")) {
+                    for (const JsonValue& n : sceneNodes->items) roots.push_back((int64_t)n.number);
+                }
+            }
+        } else {
+            for (size_t n = 0; n < nodeCount; n++) if (!isChild[n]) roots.push_back((int64_t)n);
+        }
+
+        struct Placement { int64_t mesh; GLBTransform transform; };
+        std::vector<Placement> placements;
+        std::vector<std::pair<int64_t, GLBTransform>> stack;  // Node, parent's world transform
+        for (auto it = roots.rbegin(); it != roots.rend(); ++it) stack.push_back({*it, GLBTransform()});
+        size_t visits = 0;
+        while (!stack.empty() && visits++ < nodeCount * 4) {
+            auto [id, parent] = stack.back();
+            stack.pop_back();
+            const JsonValue* node = nodes ? nodes->at(id) : nullptr;
+            if (!node || isLod[(size_t)id]) continue;
+
+            GLBTransform world = parent * GLBTransform::fromNode(*node);
+            int64_t mesh = node->getInt("mesh");
+            if (mesh >= 0 && (size_t)mesh < meshes->items.size()) placements.push_back({mesh, world});
+            if (const JsonValue* children = node->get("children")) {
+                for (auto it = children->items.rbegin(); it != children->items.rend(); ++it) {
+                    stack.push_back({(int64_t)it->number, world});
+                }
+            }
+        }
+        if (scene == GLB_ALL_SCENES) {
+            for (size_t m = 0; m < meshes->items.size(); m++) {
+                if (!meshPlaced[m]) placements.push_back({(int64_t)m, GLBTransform()});
+            }
+        }
+
+        for (const Placement& placement : placements) {
+            const JsonValue* prims = meshes->items[(size_t)placement.mesh].get("primitives");
+            if (!prims) continue;
+            const GLBTransform& transform = placement.transform;
+            bool identity = transform.identity();
+            for (const JsonValue& prim : prims->items) {
+                if (prim.getInt("mode", 4) != 4) continue;  // Triangles only
+                const JsonValue* attributes = prim.get("attributes");
+                if (!attributes || !attributes->get("POSITION")) continue;
+
+                GLBPrimitive p;
+                p.flipWinding = transform.determinant() < 0;
+                GLBAccessor positions = accessor(attributes->getInt("POSITION"));
+                p.positions = identity ? positions.as<Vec3>() : StridedView<Vec3>();
+                if (p.positions.empty() && positions.components >= 3) {
+                    p.positions = decode<Vec3>(positions, [&](float* v) {
+                        if (!identity) *reinterpret_cast<Vec3*>(v) = transform.point(*reinterpret_cast<Vec3*>(v));
+                    });
+                }
+                if (p.positions.empty()) return false;
+                if (attributes->get("NORMAL")) {
+                    GLBAccessor normals = accessor(attributes->getInt("NORMAL"));
+                    p.normals = identity ? normals.as<Vec3>() : StridedView<Vec3>();
+                    if (p.normals.empty() && normals.components >= 3) {
+                        p.normals = decode<Vec3>(normals, [&](float* v) {
+                            Vec3& n = *reinterpret_cast<Vec3*>(v);
+                            n = identity ? n.normalized() : transform.normal(n);
+                        });
+                    }
+                }
+                if (attributes->get("COLOR_0")) {
+                    GLBAccessor colors = accessor(attributes->getInt("COLOR_0"));
+                    p.colors = colors.as<Color3>();
+                    if (p.colors.empty() && colors.components >= 3 && colors.normalized) {
+                        p.colors = decode<Color3>(colors, [](float*) {});
+                    }
+                }
+                if (p.normals.count != p.positions.count) p.normals = {};
+                if (p.colors.count != p.positions.count) p.colors = {};
+
+                if (prim.get("indices")) {
+                    p.indices = accessor(prim.getInt("indices"));
+                    if (!p.indices.data || p.indices.components != 1 ||
+                        (p.indices.componentType != 5121 && p.indices.componentType != 5123 &&
+                         p.indices.componentType != 5125)) {
+                        return false;
+                    }
+                    for (size_t i = 0; i < p.indices.count; i++) {
+                        if (p.indices.index(i) >= p.positions.count) return false;
+                    }
+                }
+                out.push_back(p);
+            }
+        }
+        return true;
+    }
+
+private:
+    const uint8_t* base = nullptr;
+    const uint8_t* bin = nullptr;
+    size_t size = 0;
+    size_t binSize = 0;
+    mutable std::vector<std::vector<float>> decoded;  // Float copies of quantized attributes
+
+    // Float copy of the first three components of a, each element then
+    // passed to apply (float[3]) in place
+    template<typename T, typename ApplyFn>
+    StridedView<T> decode(const GLBAccessor& a, ApplyFn&& apply) const {
+        if (!a.data || (a.componentType != 5126 && a.componentType != 5120 && a.componentType != 5121 &&
+                        a.componentType != 5122 && a.componentType != 5123)) {
+            return {};
+        }
+        decoded.emplace_back(a.count * 3);
+        float* dst = decoded.back().data();
+        for (size_t i = 0; i < a.count; i++) {
+            for (int c = 0; c < 3; c++) dst[i * 3 + c] = a.component(i, c);
+            apply(dst + i * 3);
+        }
+        return {reinterpret_cast<const uint8_t*>(dst), a.count, sizeof(T)};
+    }
+
+    bool fail(const std::string& message) {
+        close();
+        error = message;
+        return false;
+    }
+    // For const lookups: keeps the mapping, only records the error
+    bool fail(const std::string& message) const {
+        error = message;
+        return false;
+    }
+};
+
+// Copy mapped primitives into one mesh, spans in bulk; normals/colors are
+// kept only if every primitive has them
+inline void meshFromPrimitives(const std::vector<GLBPrimitive>& prims, Mesh& outMesh) {
+    size_t vertexCount = 0, indexCount = 0;
+    bool withNormals = !prims.empty(), withColors = !prims.empty();
+    for (const GLBPrimitive& p : prims) {
+        vertexCount += p.positions.count;
+        indexCount += p.indexCount();
+        withNormals = withNormals && !p.normals.empty();
+        withColors = withColors && !p.colors.empty();
+    }
+    outMesh.vertices.resize(vertexCount);
+    outMesh.normals.resize(withNormals ? vertexCount : 0);
+    outMesh.colors.resize(withColors ? vertexCount : 0);
+    outMesh.uvs.clear();
+    outMesh.indices.resize(indexCount);
+
+    auto copy = [](auto* dst, const auto& view) {
+        if (view.contiguous()) memcpy((void*)dst, view.data, view.count * view.stride);
+        else for (size_t i = 0; i < view.count; i++) dst[i] = view[i];
+    };
+    size_t baseVertex = 0, baseIndex = 0;
+    for (const GLBPrimitive& p : prims) {
+        copy(outMesh.vertices.data() + baseVertex, p.positions);
+        if (withNormals) copy(outMesh.normals.data() + baseVertex, p.normals);
+        if (withColors) copy(outMesh.colors.data() + baseVertex, p.colors);
+        size_t count = p.indexCount();
+        for (size_t i = 0; i < count; i++) outMesh.indices[baseIndex + i] = (uint32_t)(baseVertex + p.index(i));
+        baseVertex += p.positions.count;
+        baseIndex += count;
+    }
+}
+
+// Load the mesh instances of a GLB file (every scene, or just `scene`) into
+// one Mesh, in world space (see GLBFile::primitives)
+inline bool loadGLB(const std::string& filename, Mesh& outMesh, int64_t scene = GLB_ALL_SCENES) {
+    GLBFile file;
+    std::vector<GLBPrimitive> prims;
+    if (!file.open(filename) || !file.primitives(prims, scene)) {
+        std::cerr << "Failed to load GLB: " << filename
+                  << (file.error.empty() ? "" : " (" + file.error + ")") << std::endl;
+        return false;
+    }
+    meshFromPrimitives(prims, outMesh);
+
+    std::cout << "Loaded GLB: " << filename << " - "
+              << outMesh.vertices.size() << " vertices, "
+              << outMesh.indices.size() / 3 << " triangles"
+              << (outMesh.hasColors() ? ", with colors" : "")
+              << (outMesh.hasNormals() ? ", with normals" : "") << std::endl;
+
+    return !outMesh.vertices.empty();
+}
+
+// Generate mesh from an SDF function (CPU evaluation)
+// Useful for testing without GPU
+template<typename SDFFunc>
+inline Mesh generateMeshFromFunction(
+    SDFFunc sdf,
+    int res,
+    Vec3 bounds_min,
+    Vec3 bounds_max,
+    float isolevel = 0.0f
+) {
+    std::vector<float> distances(res * res * res);
+
+    Vec3 step = {
+        (bounds_max.x - bounds_min.x) / (res - 1),
+        (bounds_max.y - bounds_min.y) / (res - 1),
+        (bounds_max.z - bounds_min.z) / (res - 1)
+    };
+
+    int idx = 0;
+    for (int z = 0; z < res; z++) {
+        for (int y = 0; y < res; y++) {
+            for (int x = 0; x < res; x++) {
+                Vec3 p = {
+                    bounds_min.x + x * step.x,
+                    bounds_min.y + y * step.y,
+                    bounds_min.z + z * step.z
+                };
+                distances[idx++] = sdf(p);
+            }
+        }
+    }
+
+    return generateMesh(distances, res, bounds_min, bounds_max, isolevel);
+}
+
+// ============================================================================
+// DUAL CONTOURING - Better sharp feature preservation
+// ============================================================================
 
 // QEF (Quadratic Error Function) solver for finding optimal vertex position
 // Solves: minimize sum of (n_i . (v - p_i))^2 for all edge crossings
@@ -1066,6 +4935,8 @@ struct QEF {
     Vec3 atb = {0, 0, 0};
     // Mass point (average of intersection points)
     Vec3 massPoint = {0, 0, 0};
+    // bTb (sum of squared plane offsets), only needed for error()
+    float btb = 0;
     int numPoints = 0;
 
     void add(Vec3 pos, Vec3 normal) {
@@ -1087,6 +4958,7 @@ struct QEF {
         atb.x += normal.x * d;
         atb.y += normal.y * d;
         atb.z += normal.z * d;
+        btb += d * d;
 
         // Accumulate mass point
         massPoint.x += pos.x;
@@ -1095,55 +4967,278 @@ struct QEF {
         numPoints++;
     }
 
-    Vec3 solve(Vec3 cellMin, Vec3 cellMax) {
-        if (numPoints == 0) return {0, 0, 0};
+    // Accumulate another QEF expressed relative to the same origin
+    void add(const QEF& o) {
+        for (int i = 0; i < 6; i++) ata[i] += o.ata[i];
+        atb = atb + o.atb;
+        massPoint = massPoint + o.massPoint;
+        btb += o.btb;
+        numPoints += o.numPoints;
+    }
+
+    // The same QEF with positions measured from (old origin + delta).
+    // Keeping positions local to a cell/node keeps btb small, so error()
+    // does not drown in float cancellation far from the world origin.
+    QEF shifted(Vec3 delta) const {
+        QEF q = *this;
+        Vec3 ad = {
+            ata[0] * delta.x + ata[1] * delta.y + ata[2] * delta.z,
+            ata[1] * delta.x + ata[3] * delta.y + ata[4] * delta.z,
+            ata[2] * delta.x + ata[4] * delta.y + ata[5] * delta.z
+        };
+        q.atb = atb - ad;
+        q.btb = btb - 2.0f * delta.dot(atb) + delta.dot(ad);
+        q.massPoint = massPoint - delta * (float)numPoints;
+        return q;
+    }
+
+    // Sum of squared distances from x to all crossing planes
+    float error(Vec3 x) const {
+        Vec3 ax = {
+            ata[0] * x.x + ata[1] * x.y + ata[2] * x.z,
+            ata[1] * x.x + ata[3] * x.y + ata[4] * x.z,
+            ata[2] * x.x + ata[4] * x.y + ata[5] * x.z
+        };
+        return std::max(0.0f, x.dot(ax) - 2.0f * x.dot(atb) + btb);
+    }
+
+    // Minimizer of the QEF inside [cellMin, cellMax]; see solveQEFs()
+    Vec3 solve(Vec3 cellMin, Vec3 cellMax) const;
+};
+
+// Batched QEF solver: truncated-SVD pseudo-inverse around the mass point.
+// Solving x = mp + pinv(ATA) * (ATb - ATA * mp) drops the directions the
+// planes do not constrain (flat regions, edges) instead of regularizing
+// them, so vertices snap to corners and creases but slide to the mass point
+// along unconstrained axes. Cells are solved QEF_BATCH at a time, one per
+// SIMD lane, with fixed iteration counts and selects instead of branches.
+// The batch is QEF_GROUPS independent vectors so their div/sqrt latency
+// chains overlap.
+constexpr int QEF_LANES = 4;
+constexpr int QEF_GROUPS = 2;
+constexpr int QEF_BATCH = QEF_LANES * QEF_GROUPS;
+constexpr int QEF_JACOBI_SWEEPS = 3;
+// Singular values below this fraction of the largest one are treated as 0
+constexpr float QEF_SVD_TRUNCATION = 0.1f;
+
+// QEF_LANES floats as one GCC/Clang vector: arithmetic and comparisons are
+// element-wise and map 1:1 onto SSE/NEON/wasm-simd registers. 4 lanes keeps
+// the vector ABI identical with and without AVX.
+typedef float QEFLanes __attribute__((vector_size(QEF_LANES * sizeof(float))));
+typedef int32_t QEFMask __attribute__((vector_size(QEF_LANES * sizeof(float))));
+
+inline QEFLanes qefSelect(QEFMask m, QEFLanes a, QEFLanes b) {
+    return (QEFLanes)((m & (QEFMask)a) | (~m & (QEFMask)b));
+}
+
+inline QEFLanes qefAbs(QEFLanes x) {
+    return (QEFLanes)((QEFMask)x & 0x7fffffff);
+}
 
-        // Compute mass point (fallback position)
-        Vec3 mp = massPoint * (1.0f / numPoints);
+inline QEFLanes qefMin(QEFLanes a, QEFLanes b) { return qefSelect(a < b, a, b); }
+inline QEFLanes qefMax(QEFLanes a, QEFLanes b) { return qefSelect(a > b, a, b); }
+
+// Explicit SIMD sqrt: std::sqrt sets errno, so a lane loop over it is not
+// vectorized unless the build has -fno-math-errno
+inline QEFLanes qefSqrt(QEFLanes x) {
+#if defined(__SSE2__) || defined(_M_X64)
+    return (QEFLanes)_mm_sqrt_ps((__m128)x);
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    return (QEFLanes)vsqrtq_f32((float32x4_t)x);
+#else
+    for (int l = 0; l < QEF_LANES; l++) x[l] = std::sqrt(x[l]);
+    return x;
+#endif
+}
 
-        // Try to solve the linear system ATA * x = ATb
-        // Using simple Cramer's rule for 3x3
-        float a00 = ata[0], a01 = ata[1], a02 = ata[2];
-        float a11 = ata[3], a12 = ata[4], a22 = ata[5];
+// One Jacobi rotation zeroing a[p][q] of the symmetric 3x3 matrices in the
+// lanes (k is the remaining index), accumulated into columns p, q of v
+inline void qefJacobiRotate(QEFLanes& app, QEFLanes& aqq, QEFLanes& apq,
+                            QEFLanes& akp, QEFLanes& akq,
+                            QEFLanes v[3][3], int p, int q) {
+    // t = tan of the rotation angle = sgn(theta) / (|theta| + sqrt(theta^2 + 1)).
+    // Negligible apq gives t = 0, which also keeps the squares out of the
+    // denormal range (very slow on x86).
+    QEFMask skip = qefAbs(apq) < 1e-18f;
+    QEFLanes theta = (aqq - app) / (2.0f * qefSelect(skip, QEFLanes{} + 1.0f, apq));
+    QEFLanes sign = qefSelect(theta < 0.0f, QEFLanes{} - 1.0f, QEFLanes{} + 1.0f);
+    QEFLanes at = qefMin(qefAbs(theta), QEFLanes{} + 1e18f);
+    QEFLanes t = sign / (at + qefSqrt(at * at + 1.0f));
+    t = qefSelect(skip, QEFLanes{}, t);
+    QEFLanes c = 1.0f / qefSqrt(t * t + 1.0f);
+    QEFLanes s = t * c;
+
+    app -= t * apq;
+    aqq += t * apq;
+    apq = QEFLanes{};
+    QEFLanes kp = akp, kq = akq;
+    akp = c * kp - s * kq;
+    akq = s * kp + c * kq;
+    for (int i = 0; i < 3; i++) {
+        QEFLanes ip = v[i][p], iq = v[i][q];
+        v[i][p] = c * ip - s * iq;
+        v[i][q] = s * ip + c * iq;
+    }
+}
 
-        // Add small regularization to handle degenerate cases
-        float reg = 0.01f;
-        a00 += reg; a11 += reg; a22 += reg;
+// Solve count QEFs. qefs[i] is minimized inside [boxMin[i], boxMax[i]] and
+// the result written to out[i]. Feature-aware clamping: a solution outside
+// the box is pulled back toward the mass point along the same ray, rather
+// than clamped per axis, so it stays on the feature line it found.
+inline void solveQEFs(const QEF* qefs, const Vec3* boxMin, const Vec3* boxMax,
+                      Vec3* out, size_t count) {
+    struct Group {
+        QEFLanes a00, a01, a02, a11, a12, a22;  // ATA, diagonalized in place
+        QEFLanes v[3][3];                       // eigenvectors (columns)
+        QEFLanes mp[3], r[3], lo[3], hi[3];
+    };
 
-        // Determinant
-        float det = a00 * (a11 * a22 - a12 * a12)
-                  - a01 * (a01 * a22 - a12 * a02)
-                  + a02 * (a01 * a12 - a11 * a02);
+    for (size_t base = 0; base < count; base += QEF_BATCH) {
+        int lanes = (int)std::min<size_t>(QEF_BATCH, count - base);
+        Group groups[QEF_GROUPS] = {};
+
+        // Gather into lanes; unused tail lanes repeat the first cell
+        for (int l = 0; l < QEF_BATCH; l++) {
+            size_t i = base + (l < lanes ? l : 0);
+            const QEF& q = qefs[i];
+            Group& g = groups[l / QEF_LANES];
+            int k = l % QEF_LANES;
+            float inv = q.numPoints > 0 ? 1.0f / q.numPoints : 0.0f;
+            g.a00[k] = q.ata[0]; g.a01[k] = q.ata[1]; g.a02[k] = q.ata[2];
+            g.a11[k] = q.ata[3]; g.a12[k] = q.ata[4]; g.a22[k] = q.ata[5];
+            g.mp[0][k] = q.massPoint.x * inv;
+            g.mp[1][k] = q.massPoint.y * inv;
+            g.mp[2][k] = q.massPoint.z * inv;
+            g.r[0][k] = q.atb.x; g.r[1][k] = q.atb.y; g.r[2][k] = q.atb.z;
+            g.lo[0][k] = boxMin[i].x; g.lo[1][k] = boxMin[i].y; g.lo[2][k] = boxMin[i].z;
+            g.hi[0][k] = boxMax[i].x; g.hi[1][k] = boxMax[i].y; g.hi[2][k] = boxMax[i].z;
+        }
 
-        if (std::abs(det) < 1e-10f) {
-            // Degenerate, use mass point
-            return mp;
+        for (Group& g : groups) {
+            // Residual at the mass point: r = ATb - ATA * mp
+            g.r[0] -= g.a00 * g.mp[0] + g.a01 * g.mp[1] + g.a02 * g.mp[2];
+            g.r[1] -= g.a01 * g.mp[0] + g.a11 * g.mp[1] + g.a12 * g.mp[2];
+            g.r[2] -= g.a02 * g.mp[0] + g.a12 * g.mp[1] + g.a22 * g.mp[2];
+            for (int i = 0; i < 3; i++) g.v[i][i] += 1.0f;
         }
 
-        // Inverse of ATA (symmetric)
-        float invDet = 1.0f / det;
-        float inv00 = (a11 * a22 - a12 * a12) * invDet;
-        float inv01 = (a02 * a12 - a01 * a22) * invDet;
-        float inv02 = (a01 * a12 - a02 * a11) * invDet;
-        float inv11 = (a00 * a22 - a02 * a02) * invDet;
-        float inv12 = (a01 * a02 - a00 * a12) * invDet;
-        float inv22 = (a00 * a11 - a01 * a01) * invDet;
+        // Jacobi eigendecomposition ATA = V diag(a00, a11, a22) V^T
+        for (int sweep = 0; sweep < QEF_JACOBI_SWEEPS; sweep++) {
+            for (Group& g : groups) qefJacobiRotate(g.a00, g.a11, g.a01, g.a02, g.a12, g.v, 0, 1);
+            for (Group& g : groups) qefJacobiRotate(g.a00, g.a22, g.a02, g.a01, g.a12, g.v, 0, 2);
+            for (Group& g : groups) qefJacobiRotate(g.a11, g.a22, g.a12, g.a01, g.a02, g.v, 1, 2);
+        }
 
-        // Solve: x = ATA^-1 * ATb
-        Vec3 result;
-        result.x = inv00 * atb.x + inv01 * atb.y + inv02 * atb.z;
-        result.y = inv01 * atb.x + inv11 * atb.y + inv12 * atb.z;
-        result.z = inv02 * atb.x + inv12 * atb.y + inv22 * atb.z;
+        for (int gi = 0; gi < QEF_GROUPS; gi++) {
+            Group& g = groups[gi];
+
+            // x - mp = V pinv(D) V^T r
+            QEFLanes d[3] = {g.a00, g.a11, g.a22};
+            QEFLanes cutoff = qefMax(QEF_SVD_TRUNCATION *
+                                     qefMax(qefAbs(d[0]), qefMax(qefAbs(d[1]), qefAbs(d[2]))),
+                                     QEFLanes{} + 1e-6f);
+            QEFLanes disp[3] = {};
+            for (int j = 0; j < 3; j++) {
+                QEFLanes vr = g.v[0][j] * g.r[0] + g.v[1][j] * g.r[1] + g.v[2][j] * g.r[2];
+                QEFMask keep = qefAbs(d[j]) > cutoff;
+                QEFLanes w = qefSelect(keep, vr / qefSelect(keep, d[j], QEFLanes{} + 1.0f), QEFLanes{});
+                for (int i = 0; i < 3; i++) disp[i] += g.v[i][j] * w;
+            }
 
-        // Clamp to cell bounds (important for stability)
-        result.x = std::max(cellMin.x, std::min(cellMax.x, result.x));
-        result.y = std::max(cellMin.y, std::min(cellMax.y, result.y));
-        result.z = std::max(cellMin.z, std::min(cellMax.z, result.z));
+            // Largest step in [0, 1] along disp that stays inside the box
+            QEFLanes step = QEFLanes{} + 1.0f;
+            for (int k = 0; k < 3; k++) {
+                QEFLanes room = qefSelect(disp[k] > 0.0f, g.hi[k] - g.mp[k], g.lo[k] - g.mp[k]);
+                QEFMask moving = qefAbs(disp[k]) > 1e-12f;
+                QEFLanes limit = qefSelect(moving, room / qefSelect(moving, disp[k], QEFLanes{} + 1.0f),
+                                           QEFLanes{} + 1.0f);
+                step = qefMin(step, qefMax(limit, QEFLanes{}));
+            }
+            QEFLanes x[3];
+            for (int k = 0; k < 3; k++) {
+                x[k] = qefMax(g.lo[k], qefMin(g.hi[k], g.mp[k] + disp[k] * step));
+            }
 
-        return result;
+            for (int k = 0; k < QEF_LANES; k++) {
+                int l = gi * QEF_LANES + k;
+                if (l < lanes) out[base + l] = {x[0][k], x[1][k], x[2][k]};
+            }
+        }
     }
+}
+
+inline Vec3 QEF::solve(Vec3 cellMin, Vec3 cellMax) const {
+    Vec3 result;
+    solveQEFs(this, &cellMin, &cellMax, &result, 1);
+    return result;
+}
+
+struct QEFBenchmark {
+    double batchedNs = 0, singleNs = 0;  // Per cell
+    double cornerError = 0;              // Mean distance to the feature point on corner cells
+    size_t mismatches = 0;               // Cells where batched and single solves differ
 };
 
+// Solver cost per active cell. Builds numCells synthetic unit-cell QEFs
+// (a third each of corners, creases and flat patches through a random
+// point), then times the batched solver against one-cell-at-a-time calls,
+// which must give bit-identical results. Run by mesh_test's qef_solve.
+inline QEFBenchmark benchmarkQEFSolve(size_t numCells = 1 << 20) {
+    uint32_t rng = 12345u;
+    auto rnd = [&]() {
+        rng = rng * 1664525u + 1013904223u;
+        return (rng >> 8) * (1.0f / 16777216.0f);
+    };
+
+    std::vector<QEF> qefs(numCells);
+    std::vector<Vec3> features(numCells);
+    for (size_t i = 0; i < numCells; i++) {
+        Vec3 f = {0.2f + 0.6f * rnd(), 0.2f + 0.6f * rnd(), 0.2f + 0.6f * rnd()};
+        int planes = 3 - (int)(i % 3);
+        for (int k = 0; k < planes; k++) {
+            // Near-orthogonal normals so corners are well conditioned
+            Vec3 n = {rnd() - 0.5f, rnd() - 0.5f, rnd() - 0.5f};
+            n = n * 0.3f;
+            if (k == 0) n.x += 1.0f; else if (k == 1) n.y += 1.0f; else n.z += 1.0f;
+            // Two samples per plane, offset within the plane
+            Vec3 t = {n.y - n.z, n.z - n.x, n.x - n.y};
+            qefs[i].add(f + t * (0.1f * rnd()), n);
+            qefs[i].add(f - t * (0.1f * rnd()), n);
+        }
+        features[i] = f;
+    }
+    std::vector<Vec3> lo(numCells, Vec3{0, 0, 0});
+    std::vector<Vec3> hi(numCells, Vec3{1, 1, 1});
+    std::vector<Vec3> batched(numCells), single(numCells);
+
+    auto t0 = std::chrono::high_resolution_clock::now();
+    solveQEFs(qefs.data(), lo.data(), hi.data(), batched.data(), numCells);
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < numCells; i++) single[i] = qefs[i].solve(lo[i], hi[i]);
+    auto t2 = std::chrono::high_resolution_clock::now();
+
+    QEFBenchmark result;
+    size_t corners = 0;
+    for (size_t i = 0; i < numCells; i++) {
+        if (memcmp(&batched[i], &single[i], sizeof(Vec3)) != 0) result.mismatches++;
+        if (i % 3 == 0) {
+            result.cornerError += (batched[i] - features[i]).length();
+            corners++;
+        }
+    }
+    if (corners) result.cornerError /= corners;
+
+    auto ns = [&](auto a, auto b) {
+        return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(b - a).count() / numCells;
+    };
+    result.batchedNs = ns(t0, t1);
+    result.singleNs = ns(t1, t2);
+    std::cout << "QEF solve benchmark (" << numCells << " cells): batched "
+              << result.batchedNs << " ns/cell, single " << result.singleNs << " ns/cell"
+              << ", corner error " << result.cornerError << std::endl;
+    return result;
+}
+
 // Compute normal from SDF grid using finite differences
 inline Vec3 computeNormalFromGrid(
     const std::vector<float>& distances,
@@ -1168,9 +5263,240 @@ inline Vec3 computeNormalFromGrid(
     return normal;
 }
 
+// Per-worker node tables for the adaptive DC octree of one tile
+// (levels 1..4 = nodes of 2³, 4³, 8³, 16³ cells)
+struct DCOctreeScratch {
+    static constexpr int LEVELS = 4;
+    std::vector<QEF> qef[LEVELS + 1];
+    std::vector<uint8_t> state[LEVELS + 1];     // NODE_EMPTY / NODE_COLLAPSED / NODE_SPLIT
+    std::vector<int32_t> cluster[LEVELS + 1];   // tile-local vertex of a collapsed root
+};
+
+constexpr uint8_t NODE_EMPTY = 0;
+constexpr uint8_t NODE_COLLAPSED = 1;
+constexpr uint8_t NODE_SPLIT = 2;
+
+static_assert(MC_TILE_SIZE == (1 << DCOctreeScratch::LEVELS), "octree levels must span one tile");
+
+// Corner sign configurations (bit i = MC corner i inside) whose inside and
+// outside corners are each connected along cube edges: the cube holds a
+// single surface sheet, so one DC vertex can stand for it
+inline const uint8_t* dcSingleSheetConfigs() {
+    static const std::array<uint8_t, 256> table = [] {
+        static const int edges[12][2] = {
+            {0,1}, {1,2}, {2,3}, {3,0}, {4,5}, {5,6}, {6,7}, {7,4}, {0,4}, {1,5}, {2,6}, {3,7}
+        };
+        auto connected = [](int set) {
+            int seen = set & -set;
+            for (bool grew = set != 0; grew;) {
+                grew = false;
+                for (const auto& e : edges) {
+                    int a = 1 << e[0], b = 1 << e[1];
+                    if ((set & a) && (set & b) && !(seen & a) != !(seen & b)) {
+                        seen |= a | b;
+                        grew = true;
+                    }
+                }
+            }
+            return seen == set;
+        };
+        std::array<uint8_t, 256> t{};
+        for (int c = 0; c < 256; c++) t[c] = connected(c) && connected(~c & 0xFF);
+        return t;
+    }();
+    return table.data();
+}
+
+// Topology safety test for collapsing an octree node spanning grid points
+// [g, g + span] (Ju et al., "Dual Contouring of Hermite Data"): the node's
+// corners must form a single sheet, and the sign at the midpoint of every
+// node edge and face and at its centre must match one of the corners
+// spanning it. Then the merged vertex sees the same surface topology as
+// the children it replaces. Points past the grid are clamped to its edge.
+inline bool dcNodeTopologySafe(const float* distances, int res, float isolevel, const int g[3], int span) {
+    bool inside[27];
+    for (int k = 0; k < 3; k++) {
+        for (int j = 0; j < 3; j++) {
+            for (int i = 0; i < 3; i++) {
+                int x = std::min(g[0] + i * span / 2, res - 1);
+                int y = std::min(g[1] + j * span / 2, res - 1);
+                int z = std::min(g[2] + k * span / 2, res - 1);
+                inside[i + 3 * j + 9 * k] = distances[x + (size_t)y * res + (size_t)z * res * res] < isolevel;
+            }
+        }
+    }
+
+    static const int cornerLattice[8] = {0, 2, 8, 6, 18, 20, 26, 24};  // MC corner -> 3x3x3 point
+    int config = 0;
+    for (int c = 0; c < 8; c++) config |= inside[cornerLattice[c]] << c;
+    if (!dcSingleSheetConfigs()[config]) return false;
+
+    // Every non-corner lattice point: its midpoint axes range over both ends
+    for (int p = 0; p < 27; p++) {
+        int l[3] = {p % 3, (p / 3) % 3, p / 9};
+        if (l[0] != 1 && l[1] != 1 && l[2] != 1) continue;
+        bool matched = false;
+        for (int c = 0; c < 8 && !matched; c++) {
+            int corner[3] = {(c & 1) * 2, ((c >> 1) & 1) * 2, ((c >> 2) & 1) * 2};
+            bool spans = true;
+            for (int a = 0; a < 3; a++) spans &= l[a] == 1 || l[a] == corner[a];
+            matched = spans && inside[corner[0] + 3 * corner[1] + 9 * corner[2]] == inside[p];
+        }
+        if (!matched) return false;
+    }
+    return true;
+}
+
+// Adaptive DC for one tile: merge child QEFs bottom-up and collapse a node
+// into one vertex when all its children collapsed, the merged QEF's RMS
+// plane distance stays within maxError and the node passes
+// dcNodeTopologySafe. A split node keeps every ancestor split, so the
+// collapsed set only grows with maxError. Every active cell is then mapped
+// to the vertex of its highest collapsed ancestor (or its own vertex).
+// The octree roots are the 16³ tiles: no vertex spans two tiles, so a
+// large flat region still keeps one vertex per tile it crosses.
+// QEFs are kept relative to each node's min corner (see QEF::shifted).
+inline void clusterTileDC(const ActiveCellIndex& active, size_t tile,
+                          const std::vector<QEF>& leafQefs, const std::vector<Vec3>& cellVertices,
+                          const float* distances, int res, float isolevel,
+                          Vec3 bounds_min, Vec3 cell_size, float maxError,
+                          DCOctreeScratch& scratch,
+                          std::vector<uint32_t>& entryVertex, std::vector<Vec3>& tileVertices) {
+    constexpr int LEVELS = DCOctreeScratch::LEVELS;
+    int tc[3], lo[3], hi[3];
+    active.tiles.bounds(tile, tc, lo, hi);
+    float maxError2 = maxError * maxError;
+
+    auto nodeIndex = [](int level, int lx, int ly, int lz) {
+        int n = MC_TILE_SIZE >> level;
+        return (lx >> level) + ((ly >> level) + (lz >> level) * n) * n;
+    };
+    auto nodeMin = [&](int level, int lx, int ly, int lz) {
+        int mask = ~((1 << level) - 1);
+        return Vec3{
+            bounds_min.x + (lo[0] + (lx & mask)) * cell_size.x,
+            bounds_min.y + (lo[1] + (ly & mask)) * cell_size.y,
+            bounds_min.z + (lo[2] + (lz & mask)) * cell_size.z
+        };
+    };
+
+    for (int level = 1; level <= LEVELS; level++) {
+        int n = MC_TILE_SIZE >> level;
+        scratch.qef[level].assign((size_t)n * n * n, QEF{});
+        scratch.state[level].assign((size_t)n * n * n, NODE_EMPTY);
+        scratch.cluster[level].assign((size_t)n * n * n, -1);
+    }
+
+    auto local = [](uint16_t key, int& lx, int& ly, int& lz) {
+        lx = key % MC_TILE_SIZE;
+        ly = (key / MC_TILE_SIZE) % MC_TILE_SIZE;
+        lz = key / (MC_TILE_SIZE * MC_TILE_SIZE);
+    };
+
+    // Leaves -> level 1
+    for (uint32_t i = active.tileStart[tile]; i < active.tileStart[tile + 1]; i++) {
+        int lx, ly, lz;
+        local(active.cells[i].local, lx, ly, lz);
+        Vec3 cellMin = nodeMin(0, lx, ly, lz);
+        int ni = nodeIndex(1, lx, ly, lz);
+        scratch.qef[1][ni].add(leafQefs[i].shifted(nodeMin(1, lx, ly, lz) - cellMin));
+        scratch.state[1][ni] = NODE_COLLAPSED;
+    }
+
+    // Error test for every populated node; parents only merge fully collapsed children
+    for (int level = 1; level <= LEVELS; level++) {
+        int n = MC_TILE_SIZE >> level;
+        int span = 1 << level;
+        Vec3 size = {span * cell_size.x, span * cell_size.y, span * cell_size.z};
+        for (int nz = 0; nz < n; nz++) {
+            for (int ny = 0; ny < n; ny++) {
+                for (int nx = 0; nx < n; nx++) {
+                    int ni = nx + (ny + nz * n) * n;
+                    if (level > 1) {
+                        // Gather the 8 children of the previous level
+                        int cn = n * 2;
+                        bool any = false, split = false;
+                        QEF merged;
+                        for (int c = 0; c < 8; c++) {
+                            int cx = nx * 2 + (c & 1), cy = ny * 2 + ((c >> 1) & 1), cz = nz * 2 + (c >> 2);
+                            int ci = cx + (cy + cz * cn) * cn;
+                            uint8_t st = scratch.state[level - 1][ci];
+                            if (st == NODE_SPLIT) split = true;
+                            if (st != NODE_COLLAPSED) continue;
+                            any = true;
+                            Vec3 delta = {
+                                (cx & 1) ? -size.x * 0.5f : 0.0f,
+                                (cy & 1) ? -size.y * 0.5f : 0.0f,
+                                (cz & 1) ? -size.z * 0.5f : 0.0f
+                            };
+                            merged.add(scratch.qef[level - 1][ci].shifted(delta));
+                        }
+                        if (split) { scratch.state[level][ni] = NODE_SPLIT; continue; }
+                        if (!any) continue;
+                        scratch.qef[level][ni] = merged;
+                        scratch.state[level][ni] = NODE_COLLAPSED;
+                    }
+                    if (scratch.state[level][ni] != NODE_COLLAPSED) continue;
+
+                    int g[3] = {lo[0] + nx * span, lo[1] + ny * span, lo[2] + nz * span};
+                    if (!dcNodeTopologySafe(distances, res, isolevel, g, span)) {
+                        scratch.state[level][ni] = NODE_SPLIT;
+                        continue;
+                    }
+                    QEF& q = scratch.qef[level][ni];
+                    if (q.numPoints == 0) continue;  // only degenerate normals, nothing to judge
+                    Vec3 x = q.solve({0, 0, 0}, size);
+                    if (q.error(x) > maxError2 * q.numPoints) {
+                        scratch.state[level][ni] = NODE_SPLIT;
+                    }
+                }
+            }
+        }
+    }
+
+    // Map every cell to its highest collapsed ancestor, creating tile-local
+    // vertices in order of first use so the output is deterministic
+    for (uint32_t i = active.tileStart[tile]; i < active.tileStart[tile + 1]; i++) {
+        int lx, ly, lz;
+        local(active.cells[i].local, lx, ly, lz);
+        int root = 0;
+        for (int level = LEVELS; level >= 1; level--) {
+            if (scratch.state[level][nodeIndex(level, lx, ly, lz)] == NODE_COLLAPSED) {
+                root = level;
+                break;
+            }
+        }
+        if (root == 0) {
+            entryVertex[i] = (uint32_t)tileVertices.size();
+            tileVertices.push_back(cellVertices[i]);
+            continue;
+        }
+        int ni = nodeIndex(root, lx, ly, lz);
+        int32_t& v = scratch.cluster[root][ni];
+        if (v < 0) {
+            int span = 1 << root;
+            Vec3 origin = nodeMin(root, lx, ly, lz);
+            // Clip the node to the grid for the clamp box of edge tiles
+            Vec3 size = {
+                std::min(span, hi[0] - lo[0] - (lx & ~(span - 1))) * cell_size.x,
+                std::min(span, hi[1] - lo[1] - (ly & ~(span - 1))) * cell_size.y,
+                std::min(span, hi[2] - lo[2] - (lz & ~(span - 1))) * cell_size.z
+            };
+            const QEF& q = scratch.qef[root][ni];
+            v = (int32_t)tileVertices.size();
+            tileVertices.push_back(origin + (q.numPoints > 0 ? q.solve({0, 0, 0}, size) : size * 0.5f));
+        }
+        entryVertex[i] = (uint32_t)v;
+    }
+}
+
 // Dual Contouring mesh generation - Multithreaded implementation
 // When fillWithCubes=true, generates solid voxel cubes for each active cell (no slicing artifacts)
 // voxelSize controls the size of cubes (1.0 = cell size, 0.5 = half size, 2.0 = double)
+// simplifyTolerance > 0 enables adaptive (octree) DC: cells whose merged QEF
+// fits within that many cell sizes (RMS) collapse into one vertex, so flat
+// regions get far fewer triangles. 0 = uniform grid. Ignored for cubes.
+// arena: optional scratch kept by the caller across calls (see MeshArena)
 inline Mesh generateMeshDC(
     const std::vector<float>& distances,
     int res,
@@ -1178,7 +5504,9 @@ inline Mesh generateMeshDC(
     Vec3 bounds_max,
     float isolevel = 0.0f,
     bool fillWithCubes = false,
-    float voxelSize = 1.0f
+    float voxelSize = 1.0f,
+    float simplifyTolerance = 0.0f,
+    MeshArena* arena = nullptr
 ) {
     auto dcStart = std::chrono::high_resolution_clock::now();
 
@@ -1189,268 +5517,214 @@ inline Mesh generateMeshDC(
     };
 
     auto idx = [res](int x, int y, int z) { return x + y * res + z * res * res; };
-    auto cellIdx = [res](int x, int y, int z) { return x + y * (res-1) + z * (res-1) * (res-1); };
 
     // Edge crossing check - returns true if sign changes
     auto signChange = [isolevel](float a, float b) {
         return (a < isolevel) != (b < isolevel);
     };
 
-    // Determine number of threads
-    unsigned int numThreads = std::thread::hardware_concurrency();
-    if (numThreads == 0) numThreads = 4;  // Fallback
-    numThreads = std::min(numThreads, (unsigned int)(res - 1));
+    ThreadPool& pool = ThreadPool::instance();
+    unsigned int numThreads = pool.size();
+    MeshArena localArena;
+    MeshArena& scratch = arena ? *arena : localArena;
+
+    // Sparse active-cell index shared by all phases: entry i is DC vertex i.
+    // Replaces the dense (res-1)³ cellVertices/cellHasVertex/cellToVertex arrays.
+    ActiveCellIndex& active = scratch.active;
+    buildActiveCellIndex(distances.data(), res, isolevel, active, scratch.activeTiles);
+    const CellTiles& tiles = active.tiles;
+
+    // Adaptive mode keeps each cell's QEF for the octree collapse
+    bool adaptive = simplifyTolerance > 0.0f && !fillWithCubes;
 
     // =========================================================================
     // Phase 1: Generate one vertex per cell that contains surface (PARALLEL)
     // =========================================================================
-    std::vector<Vec3> cellVertices((res-1) * (res-1) * (res-1), Vec3{0,0,0});
-    std::vector<uint8_t> cellHasVertex((res-1) * (res-1) * (res-1), 0);  // uint8_t for thread safety
-
-    {
-        std::vector<std::thread> threads;
-        int zPerThread = (res - 1 + numThreads - 1) / numThreads;
-
-        for (unsigned int t = 0; t < numThreads; t++) {
-            int zStart = t * zPerThread;
-            int zEnd = std::min(zStart + zPerThread, res - 1);
-
-            threads.emplace_back([&, zStart, zEnd]() {
-                // Edge definitions: pairs of corner indices
-                static const int edges[12][2] = {
-                    {0,1}, {1,2}, {2,3}, {3,0},  // bottom face
-                    {4,5}, {5,6}, {6,7}, {7,4},  // top face
-                    {0,4}, {1,5}, {2,6}, {3,7}   // vertical edges
-                };
-
-                for (int z = zStart; z < zEnd; z++) {
-                    for (int y = 0; y < res - 1; y++) {
-                        for (int x = 0; x < res - 1; x++) {
-                            // Get 8 corner values
-                            float v[8] = {
-                                distances[idx(x,   y,   z)],
-                                distances[idx(x+1, y,   z)],
-                                distances[idx(x+1, y+1, z)],
-                                distances[idx(x,   y+1, z)],
-                                distances[idx(x,   y,   z+1)],
-                                distances[idx(x+1, y,   z+1)],
-                                distances[idx(x+1, y+1, z+1)],
-                                distances[idx(x,   y+1, z+1)]
-                            };
-
-                            // Early rejection: count corners inside/outside
-                            int insideCount = 0;
-                            for (int i = 0; i < 8; i++) {
-                                if (v[i] < isolevel) insideCount++;
-                            }
-                            // Skip if all corners same sign (no surface crossing)
-                            if (insideCount == 0 || insideCount == 8) continue;
-
-                            // Check if any edge crosses the surface
-                            bool hasCrossing =
-                                signChange(v[0], v[1]) || signChange(v[1], v[2]) ||
-                                signChange(v[2], v[3]) || signChange(v[3], v[0]) ||
-                                signChange(v[4], v[5]) || signChange(v[5], v[6]) ||
-                                signChange(v[6], v[7]) || signChange(v[7], v[4]) ||
-                                signChange(v[0], v[4]) || signChange(v[1], v[5]) ||
-                                signChange(v[2], v[6]) || signChange(v[3], v[7]);
-
-                            if (!hasCrossing) continue;
-
-                            // Cell bounds
-                            Vec3 cellMin = {
-                                bounds_min.x + x * cell_size.x,
-                                bounds_min.y + y * cell_size.y,
-                                bounds_min.z + z * cell_size.z
-                            };
-                            Vec3 cellMax = {
-                                bounds_min.x + (x+1) * cell_size.x,
-                                bounds_min.y + (y+1) * cell_size.y,
-                                bounds_min.z + (z+1) * cell_size.z
-                            };
+    std::vector<Vec3>& cellVertices = scratch.cellVertices;
+    std::vector<QEF>& leafQefs = scratch.leafQefs;
+    cellVertices.resize(active.size());
+    leafQefs.resize(adaptive ? active.size() : 0);
+
+    // Per-worker QEF batches: a tile's QEFs are gathered, then solved together
+    resetBuffers(scratch.workerQefs, numThreads);
+    std::atomic<int64_t> qefSolveNs{0};
+
+    pool.parallelFor(tiles.count(), [&](size_t tile, unsigned worker) {
+        MeshArena::QEFScratch& batch = scratch.workerQefs[worker];
+        batch.qefs.clear();
+
+        // Edge definitions: pairs of corner indices
+        static const int edges[12][2] = {
+            {0,1}, {1,2}, {2,3}, {3,0},  // bottom face
+            {4,5}, {5,6}, {6,7}, {7,4},  // top face
+            {0,4}, {1,5}, {2,6}, {3,7}   // vertical edges
+        };
 
-                            // Corner positions
-                            Vec3 p[8] = {
-                                cellMin,
-                                {cellMax.x, cellMin.y, cellMin.z},
-                                {cellMax.x, cellMax.y, cellMin.z},
-                                {cellMin.x, cellMax.y, cellMin.z},
-                                {cellMin.x, cellMin.y, cellMax.z},
-                                {cellMax.x, cellMin.y, cellMax.z},
-                                cellMax,
-                                {cellMin.x, cellMax.y, cellMax.z}
-                            };
+        for (uint32_t i = active.tileStart[tile]; i < active.tileStart[tile + 1]; i++) {
+            int x, y, z;
+            tiles.cellCoords(tile, active.cells[i].local, x, y, z);
+
+            // Get 8 corner values
+            float v[8] = {
+                distances[idx(x,   y,   z)],
+                distances[idx(x+1, y,   z)],
+                distances[idx(x+1, y+1, z)],
+                distances[idx(x,   y+1, z)],
+                distances[idx(x,   y,   z+1)],
+                distances[idx(x+1, y,   z+1)],
+                distances[idx(x+1, y+1, z+1)],
+                distances[idx(x,   y+1, z+1)]
+            };
+
+            // Cell bounds
+            Vec3 cellMin = {
+                bounds_min.x + x * cell_size.x,
+                bounds_min.y + y * cell_size.y,
+                bounds_min.z + z * cell_size.z
+            };
+            Vec3 cellMax = {
+                bounds_min.x + (x+1) * cell_size.x,
+                bounds_min.y + (y+1) * cell_size.y,
+                bounds_min.z + (z+1) * cell_size.z
+            };
+
+            // Corner positions
+            Vec3 p[8] = {
+                cellMin,
+                {cellMax.x, cellMin.y, cellMin.z},
+                {cellMax.x, cellMax.y, cellMin.z},
+                {cellMin.x, cellMax.y, cellMin.z},
+                {cellMin.x, cellMin.y, cellMax.z},
+                {cellMax.x, cellMin.y, cellMax.z},
+                cellMax,
+                {cellMin.x, cellMax.y, cellMax.z}
+            };
+
+            // Collect edge crossings and solve QEF
+            QEF qef;
+            for (int e = 0; e < 12; e++) {
+                int i0 = edges[e][0], i1 = edges[e][1];
+                if (!signChange(v[i0], v[i1])) continue;
+
+                // Interpolate crossing position
+                float t = (isolevel - v[i0]) / (v[i1] - v[i0]);
+                t = std::max(0.0f, std::min(1.0f, t));
+                Vec3 crossPos = p[i0] + (p[i1] - p[i0]) * t;
+
+                // Interpolate grid coordinates for normal lookup
+                int gx0, gy0, gz0, gx1, gy1, gz1;
+                switch(i0) {
+                    case 0: gx0=x;   gy0=y;   gz0=z;   break;
+                    case 1: gx0=x+1; gy0=y;   gz0=z;   break;
+                    case 2: gx0=x+1; gy0=y+1; gz0=z;   break;
+                    case 3: gx0=x;   gy0=y+1; gz0=z;   break;
+                    case 4: gx0=x;   gy0=y;   gz0=z+1; break;
+                    case 5: gx0=x+1; gy0=y;   gz0=z+1; break;
+                    case 6: gx0=x+1; gy0=y+1; gz0=z+1; break;
+                    case 7: gx0=x;   gy0=y+1; gz0=z+1; break;
+                    default: gx0=x; gy0=y; gz0=z; break;
+                }
+                switch(i1) {
+                    case 0: gx1=x;   gy1=y;   gz1=z;   break;
+                    case 1: gx1=x+1; gy1=y;   gz1=z;   break;
+                    case 2: gx1=x+1; gy1=y+1; gz1=z;   break;
+                    case 3: gx1=x;   gy1=y+1; gz1=z;   break;
+                    case 4: gx1=x;   gy1=y;   gz1=z+1; break;
+                    case 5: gx1=x+1; gy1=y;   gz1=z+1; break;
+                    case 6: gx1=x+1; gy1=y+1; gz1=z+1; break;
+                    case 7: gx1=x;   gy1=y+1; gz1=z+1; break;
+                    default: gx1=x; gy1=y; gz1=z; break;
+                }
 
-                            // Collect edge crossings and solve QEF
-                            QEF qef;
-                            for (int e = 0; e < 12; e++) {
-                                int i0 = edges[e][0], i1 = edges[e][1];
-                                if (!signChange(v[i0], v[i1])) continue;
-
-                                // Interpolate crossing position
-                                float t = (isolevel - v[i0]) / (v[i1] - v[i0]);
-                                t = std::max(0.0f, std::min(1.0f, t));
-                                Vec3 crossPos = p[i0] + (p[i1] - p[i0]) * t;
-
-                                // Interpolate grid coordinates for normal lookup
-                                int gx0, gy0, gz0, gx1, gy1, gz1;
-                                switch(i0) {
-                                    case 0: gx0=x;   gy0=y;   gz0=z;   break;
-                                    case 1: gx0=x+1; gy0=y;   gz0=z;   break;
-                                    case 2: gx0=x+1; gy0=y+1; gz0=z;   break;
-                                    case 3: gx0=x;   gy0=y+1; gz0=z;   break;
-                                    case 4: gx0=x;   gy0=y;   gz0=z+1; break;
-                                    case 5: gx0=x+1; gy0=y;   gz0=z+1; break;
-                                    case 6: gx0=x+1; gy0=y+1; gz0=z+1; break;
-                                    case 7: gx0=x;   gy0=y+1; gz0=z+1; break;
-                                    default: gx0=x; gy0=y; gz0=z; break;
-                                }
-                                switch(i1) {
-                                    case 0: gx1=x;   gy1=y;   gz1=z;   break;
-                                    case 1: gx1=x+1; gy1=y;   gz1=z;   break;
-                                    case 2: gx1=x+1; gy1=y+1; gz1=z;   break;
-                                    case 3: gx1=x;   gy1=y+1; gz1=z;   break;
-                                    case 4: gx1=x;   gy1=y;   gz1=z+1; break;
-                                    case 5: gx1=x+1; gy1=y;   gz1=z+1; break;
-                                    case 6: gx1=x+1; gy1=y+1; gz1=z+1; break;
-                                    case 7: gx1=x;   gy1=y+1; gz1=z+1; break;
-                                    default: gx1=x; gy1=y; gz1=z; break;
-                                }
-
-                                // Get normals at corners and interpolate
-                                Vec3 n0 = computeNormalFromGrid(distances, res, gx0, gy0, gz0);
-                                Vec3 n1 = computeNormalFromGrid(distances, res, gx1, gy1, gz1);
-                                Vec3 crossNormal = n0 + (n1 - n0) * t;
-
-                                qef.add(crossPos, crossNormal);
-                            }
+                // Get normals at corners and interpolate
+                Vec3 n0 = computeNormalFromGrid(distances, res, gx0, gy0, gz0);
+                Vec3 n1 = computeNormalFromGrid(distances, res, gx1, gy1, gz1);
+                Vec3 crossNormal = n0 + (n1 - n0) * t;
 
-                            // Solve QEF to get vertex position
-                            Vec3 cellCenter = {
-                                (cellMin.x + cellMax.x) * 0.5f,
-                                (cellMin.y + cellMax.y) * 0.5f,
-                                (cellMin.z + cellMax.z) * 0.5f
-                            };
-                            // Vec3 vertex = qef.solve(cellMin, cellMax);  // TODO: Enable QEF solve
-                            Vec3 vertex = cellCenter;  // Use cell center for now
+                qef.add(crossPos - cellMin, crossNormal);  // cell-local (see QEF::shifted)
+            }
 
-                            int ci = cellIdx(x, y, z);
-                            cellVertices[ci] = vertex;
-                            cellHasVertex[ci] = 1;
-                        }
-                    }
-                }
-            });
+            // Vertex = cellMin + cell-local QEF solution (solved below)
+            cellVertices[i] = cellMin;
+            batch.qefs.push_back(qef);
+            if (adaptive) leafQefs[i] = qef;
         }
 
-        // Wait for all threads
-        for (auto& t : threads) {
-            t.join();
+        if (fillWithCubes || batch.qefs.empty()) return;
+
+        // Solve the tile's QEFs in SIMD batches, all inside [0, cell_size]
+        auto solveStart = std::chrono::high_resolution_clock::now();
+        size_t n = batch.qefs.size();
+        batch.lo.assign(n, Vec3{0, 0, 0});
+        batch.hi.assign(n, cell_size);
+        batch.out.resize(n);
+        solveQEFs(batch.qefs.data(), batch.lo.data(), batch.hi.data(), batch.out.data(), n);
+        uint32_t first = active.tileStart[tile];
+        for (size_t k = 0; k < n; k++) {
+            cellVertices[first + k] = cellVertices[first + k] + batch.out[k];
         }
-    }
+        qefSolveNs += std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::high_resolution_clock::now() - solveStart).count();
+    });
 
     // =========================================================================
     // Phase 2 & 3: Generate mesh (different paths for DC vs Cubes)
     // =========================================================================
-    Mesh mesh;
+    Mesh mesh = scratch.takeMesh();
 
     if (fillWithCubes) {
         // =====================================================================
         // CUBE MODE: Generate solid voxel cube for each active cell (PARALLEL)
         // =====================================================================
-
-        // Per-thread mesh buffers
-        struct ThreadCubeMesh {
-            std::vector<Vec3> vertices;
-            std::vector<uint32_t> indices;
+        // Every cube is 8 vertices / 36 indices, so entry i writes straight
+        // into its own slot of the preallocated mesh
+
+        // 12 triangles (6 faces, 2 tris each) in MC winding (CW seen from outside)
+        static const uint32_t cubeIndices[36] = {
+            0, 1, 2,  0, 2, 3,   // Front face (z-)
+            4, 6, 5,  4, 7, 6,   // Back face (z+)
+            0, 7, 4,  0, 3, 7,   // Left face (x-)
+            1, 6, 2,  1, 5, 6,   // Right face (x+)
+            0, 5, 1,  0, 4, 5,   // Bottom face (y-)
+            3, 6, 7,  3, 2, 6    // Top face (y+)
         };
-        std::vector<ThreadCubeMesh> threadMeshes(numThreads);
-
-        {
-            std::vector<std::thread> threads;
-            int zPerThread = (res - 1 + numThreads - 1) / numThreads;
-
-            for (unsigned int t = 0; t < numThreads; t++) {
-                int zStart = t * zPerThread;
-                int zEnd = std::min(zStart + zPerThread, res - 1);
-
-                threads.emplace_back([&, t, zStart, zEnd]() {
-                    ThreadCubeMesh& tm = threadMeshes[t];
-
-                    for (int z = zStart; z < zEnd; z++) {
-                        for (int y = 0; y < res - 1; y++) {
-                            for (int x = 0; x < res - 1; x++) {
-                                int ci = cellIdx(x, y, z);
-                                if (!cellHasVertex[ci]) continue;
-
-                                // Cell center and scaled half-size
-                                Vec3 center = {
-                                    bounds_min.x + (x + 0.5f) * cell_size.x,
-                                    bounds_min.y + (y + 0.5f) * cell_size.y,
-                                    bounds_min.z + (z + 0.5f) * cell_size.z
-                                };
-                                float hx = cell_size.x * 0.5f * voxelSize;
-                                float hy = cell_size.y * 0.5f * voxelSize;
-                                float hz = cell_size.z * 0.5f * voxelSize;
-                                Vec3 cmin = {center.x - hx, center.y - hy, center.z - hz};
-                                Vec3 cmax = {center.x + hx, center.y + hy, center.z + hz};
-
-                                // 8 vertices of cube
-                                uint32_t base = (uint32_t)tm.vertices.size();
-                                tm.vertices.push_back({cmin.x, cmin.y, cmin.z}); // 0: ---
-                                tm.vertices.push_back({cmax.x, cmin.y, cmin.z}); // 1: +--
-                                tm.vertices.push_back({cmax.x, cmax.y, cmin.z}); // 2: ++-
-                                tm.vertices.push_back({cmin.x, cmax.y, cmin.z}); // 3: -+-
-                                tm.vertices.push_back({cmin.x, cmin.y, cmax.z}); // 4: --+
-                                tm.vertices.push_back({cmax.x, cmin.y, cmax.z}); // 5: +-+
-                                tm.vertices.push_back({cmax.x, cmax.y, cmax.z}); // 6: +++
-                                tm.vertices.push_back({cmin.x, cmax.y, cmax.z}); // 7: -++
-
-                                // 12 triangles (6 faces, 2 tris each) - CCW winding for outward normals
-                                // Front face (z-)
-                                tm.indices.push_back(base+0); tm.indices.push_back(base+2); tm.indices.push_back(base+1);
-                                tm.indices.push_back(base+0); tm.indices.push_back(base+3); tm.indices.push_back(base+2);
-                                // Back face (z+)
-                                tm.indices.push_back(base+4); tm.indices.push_back(base+5); tm.indices.push_back(base+6);
-                                tm.indices.push_back(base+4); tm.indices.push_back(base+6); tm.indices.push_back(base+7);
-                                // Left face (x-)
-                                tm.indices.push_back(base+0); tm.indices.push_back(base+4); tm.indices.push_back(base+7);
-                                tm.indices.push_back(base+0); tm.indices.push_back(base+7); tm.indices.push_back(base+3);
-                                // Right face (x+)
-                                tm.indices.push_back(base+1); tm.indices.push_back(base+2); tm.indices.push_back(base+6);
-                                tm.indices.push_back(base+1); tm.indices.push_back(base+6); tm.indices.push_back(base+5);
-                                // Bottom face (y-)
-                                tm.indices.push_back(base+0); tm.indices.push_back(base+1); tm.indices.push_back(base+5);
-                                tm.indices.push_back(base+0); tm.indices.push_back(base+5); tm.indices.push_back(base+4);
-                                // Top face (y+)
-                                tm.indices.push_back(base+3); tm.indices.push_back(base+7); tm.indices.push_back(base+6);
-                                tm.indices.push_back(base+3); tm.indices.push_back(base+6); tm.indices.push_back(base+2);
-                            }
-                        }
-                    }
-                });
-            }
 
-            for (auto& t : threads) t.join();
-        }
+        mesh.vertices.resize(active.size() * 8);
+        mesh.indices.resize(active.size() * 36);
 
-        // Merge thread meshes
-        size_t totalVerts = 0, totalIndices = 0;
-        for (const auto& tm : threadMeshes) {
-            totalVerts += tm.vertices.size();
-            totalIndices += tm.indices.size();
-        }
-        mesh.vertices.reserve(totalVerts);
-        mesh.indices.reserve(totalIndices);
+        pool.parallelFor(tiles.count(), [&](size_t tile, unsigned) {
+            for (uint32_t i = active.tileStart[tile]; i < active.tileStart[tile + 1]; i++) {
+                int x, y, z;
+                tiles.cellCoords(tile, active.cells[i].local, x, y, z);
 
-        uint32_t indexOffset = 0;
-        for (const auto& tm : threadMeshes) {
-            mesh.vertices.insert(mesh.vertices.end(), tm.vertices.begin(), tm.vertices.end());
-            for (uint32_t idx : tm.indices) {
-                mesh.indices.push_back(idx + indexOffset);
+                // Cell center and scaled half-size
+                Vec3 center = {
+                    bounds_min.x + (x + 0.5f) * cell_size.x,
+                    bounds_min.y + (y + 0.5f) * cell_size.y,
+                    bounds_min.z + (z + 0.5f) * cell_size.z
+                };
+                float hx = cell_size.x * 0.5f * voxelSize;
+                float hy = cell_size.y * 0.5f * voxelSize;
+                float hz = cell_size.z * 0.5f * voxelSize;
+                Vec3 cmin = {center.x - hx, center.y - hy, center.z - hz};
+                Vec3 cmax = {center.x + hx, center.y + hy, center.z + hz};
+
+                // 8 vertices of cube
+                uint32_t base = i * 8;
+                Vec3* cv = &mesh.vertices[base];
+                cv[0] = {cmin.x, cmin.y, cmin.z}; // 0: ---
+                cv[1] = {cmax.x, cmin.y, cmin.z}; // 1: +--
+                cv[2] = {cmax.x, cmax.y, cmin.z}; // 2: ++-
+                cv[3] = {cmin.x, cmax.y, cmin.z}; // 3: -+-
+                cv[4] = {cmin.x, cmin.y, cmax.z}; // 4: --+
+                cv[5] = {cmax.x, cmin.y, cmax.z}; // 5: +-+
+                cv[6] = {cmax.x, cmax.y, cmax.z}; // 6: +++
+                cv[7] = {cmin.x, cmax.y, cmax.z}; // 7: -++
+
+                uint32_t* ci = &mesh.indices[(size_t)i * 36];
+                for (int k = 0; k < 36; k++) ci[k] = base + cubeIndices[k];
             }
-            indexOffset += (uint32_t)tm.vertices.size();
-        }
+        });
 
         auto dcEnd = std::chrono::high_resolution_clock::now();
         auto dcDuration = std::chrono::duration_cast<std::chrono::milliseconds>(dcEnd - dcStart);
@@ -1460,123 +5734,123 @@ inline Mesh generateMeshDC(
 
     } else {
         // =====================================================================
-        // NORMAL DC MODE: Build vertex array and generate quads
+        // NORMAL DC MODE: Active-cell entries are the vertices; generate quads
         // =====================================================================
+        // Adaptive: collapse octree nodes per tile, then renumber the
+        // surviving vertices tile by tile. entryVertex maps entry -> vertex.
+        std::vector<uint32_t>& entryVertex = scratch.entryVertex;
+        if (adaptive) {
+            float minCell = std::min(cell_size.x, std::min(cell_size.y, cell_size.z));
+            entryVertex.resize(active.size());
+            std::vector<std::vector<Vec3>>& tileVertices = scratch.tileVertices;
+            resetBuffers(tileVertices, tiles.count());
+            scratch.workerOctree.resize(pool.size());
+
+            pool.parallelFor(tiles.count(), [&](size_t tile, unsigned worker) {
+                if (active.tileStart[tile] == active.tileStart[tile + 1]) return;
+                clusterTileDC(active, tile, leafQefs, cellVertices, distances.data(), res, isolevel,
+                              bounds_min, cell_size,
+                              simplifyTolerance * minCell, scratch.workerOctree[worker],
+                              entryVertex, tileVertices[tile]);
+            });
 
-        std::vector<int> cellToVertex((res-1) * (res-1) * (res-1), -1);
-
-        // Count active cells first for reserve
-        size_t activeCount = 0;
-        for (size_t i = 0; i < cellHasVertex.size(); i++) {
-            if (cellHasVertex[i]) activeCount++;
-        }
-        mesh.vertices.reserve(activeCount);
-
-        for (int z = 0; z < res - 1; z++) {
-            for (int y = 0; y < res - 1; y++) {
-                for (int x = 0; x < res - 1; x++) {
-                    int ci = cellIdx(x, y, z);
-                    if (cellHasVertex[ci]) {
-                        cellToVertex[ci] = (int)mesh.vertices.size();
-                        mesh.vertices.push_back(cellVertices[ci]);
-                    }
+            std::vector<size_t>& tileBase = scratch.offsets[3];
+            prefixOffsets(tileBase, tiles.count(), [&](size_t t) { return tileVertices[t].size(); });
+            mesh.vertices.resize(tileBase.back());
+            pool.parallelFor(tiles.count(), [&](size_t tile, unsigned) {
+                std::copy(tileVertices[tile].begin(), tileVertices[tile].end(),
+                          mesh.vertices.begin() + tileBase[tile]);
+                for (uint32_t i = active.tileStart[tile]; i < active.tileStart[tile + 1]; i++) {
+                    entryVertex[i] += (uint32_t)tileBase[tile];
                 }
-            }
+            });
+        } else {
+            // Hand the vertices over; the arena keeps the mesh's old buffer
+            mesh.vertices.swap(cellVertices);
         }
 
         // Phase 3: Generate quads for edges that cross the surface (PARALLEL)
-        std::vector<std::vector<uint32_t>> threadIndices(numThreads);
-
-        {
-            std::vector<std::thread> threads;
-            int zPerThread = (res - 1 + numThreads - 1) / numThreads;
-
-            for (unsigned int t = 0; t < numThreads; t++) {
-                int zStart = t * zPerThread;
-                int zEnd = std::min(zStart + zPerThread, res - 1);
-
-                threads.emplace_back([&, t, zStart, zEnd]() {
-                    std::vector<uint32_t>& localIndices = threadIndices[t];
-
-                    auto addQuad = [&localIndices](int v0, int v1, int v2, int v3, bool flip) {
-                        if (v0 < 0 || v1 < 0 || v2 < 0 || v3 < 0) return;
-                        if (flip) {
-                            localIndices.push_back(v0); localIndices.push_back(v2); localIndices.push_back(v1);
-                            localIndices.push_back(v0); localIndices.push_back(v3); localIndices.push_back(v2);
-                        } else {
-                            localIndices.push_back(v0); localIndices.push_back(v1); localIndices.push_back(v2);
-                            localIndices.push_back(v0); localIndices.push_back(v2); localIndices.push_back(v3);
-                        }
-                    };
-
-                    // Process X-aligned edges
-                    for (int z = std::max(1, zStart); z < std::min(zEnd + 1, res - 1); z++) {
-                        for (int y = 1; y < res - 1; y++) {
-                            for (int x = 0; x < res - 1; x++) {
-                                float v0 = distances[idx(x, y, z)];
-                                float v1 = distances[idx(x+1, y, z)];
-                                if (!signChange(v0, v1)) continue;
-                                int c0 = cellToVertex[cellIdx(x, y-1, z-1)];
-                                int c1 = cellToVertex[cellIdx(x, y, z-1)];
-                                int c2 = cellToVertex[cellIdx(x, y, z)];
-                                int c3 = cellToVertex[cellIdx(x, y-1, z)];
-                                addQuad(c0, c1, c2, c3, v0 >= isolevel);
-                            }
-                        }
+        // Each active cell handles the three edges leaving its min corner. A
+        // crossing edge makes every cell around it active, so walking the index
+        // covers all quads. The X edge needs y,z >= 1, the Y edge x,z >= 1 and
+        // the Z edge x,y >= 1 so all four cells around the edge exist.
+        std::vector<std::vector<uint32_t>>& tileIndices = scratch.tileIndices;
+        resetBuffers(tileIndices, tiles.count());
+
+        pool.parallelFor(tiles.count(), [&](size_t tile, unsigned) {
+            std::vector<uint32_t>& localIndices = tileIndices[tile];
+
+            // Upper bound: two triangles per crossing min-corner edge
+            size_t crossings = 0;
+            for (uint32_t i = active.tileStart[tile]; i < active.tileStart[tile + 1]; i++) {
+                int ci = active.cells[i].cubeIndex;
+                int in0 = ci & 1;
+                crossings += (in0 != ((ci >> 1) & 1)) + (in0 != ((ci >> 3) & 1)) + (in0 != ((ci >> 4) & 1));
+            }
+            localIndices.reserve(6 * crossings);
+
+            auto addQuad = [&](int64_t v0, int64_t v1, int64_t v2, int64_t v3, bool flip) {
+                if (v0 < 0 || v1 < 0 || v2 < 0 || v3 < 0) return;
+                if (adaptive) {
+                    // Collapsed cells share a vertex: emit only non-degenerate triangles
+                    v0 = entryVertex[v0]; v1 = entryVertex[v1];
+                    v2 = entryVertex[v2]; v3 = entryVertex[v3];
+                    if (flip) std::swap(v1, v3);
+                    if (v0 != v1 && v1 != v2 && v0 != v2) {
+                        localIndices.push_back(v0); localIndices.push_back(v1); localIndices.push_back(v2);
                     }
-
-                    // Process Y-aligned edges
-                    for (int z = std::max(1, zStart); z < std::min(zEnd + 1, res - 1); z++) {
-                        for (int y = 0; y < res - 1; y++) {
-                            for (int x = 1; x < res - 1; x++) {
-                                float v0 = distances[idx(x, y, z)];
-                                float v1 = distances[idx(x, y+1, z)];
-                                if (!signChange(v0, v1)) continue;
-                                int c0 = cellToVertex[cellIdx(x-1, y, z-1)];
-                                int c1 = cellToVertex[cellIdx(x, y, z-1)];
-                                int c2 = cellToVertex[cellIdx(x, y, z)];
-                                int c3 = cellToVertex[cellIdx(x-1, y, z)];
-                                addQuad(c0, c1, c2, c3, v0 >= isolevel);
-                            }
-                        }
+                    if (v0 != v2 && v2 != v3 && v0 != v3) {
+                        localIndices.push_back(v0); localIndices.push_back(v2); localIndices.push_back(v3);
                     }
+                    return;
+                }
+                if (flip) {
+                    localIndices.push_back(v0); localIndices.push_back(v2); localIndices.push_back(v1);
+                    localIndices.push_back(v0); localIndices.push_back(v3); localIndices.push_back(v2);
+                } else {
+                    localIndices.push_back(v0); localIndices.push_back(v1); localIndices.push_back(v2);
+                    localIndices.push_back(v0); localIndices.push_back(v2); localIndices.push_back(v3);
+                }
+            };
+
+            for (uint32_t i = active.tileStart[tile]; i < active.tileStart[tile + 1]; i++) {
+                int x, y, z;
+                tiles.cellCoords(tile, active.cells[i].local, x, y, z);
+                int cubeIndex = active.cells[i].cubeIndex;
+                bool inside0 = cubeIndex & 1;     // corner 0 = grid point (x, y, z)
+                bool flip = inside0;              // v0 < isolevel: MC winding, as in computeNormals
+
+                // X-aligned edge: corners 0 -> 1
+                if (y >= 1 && z >= 1 && inside0 != bool(cubeIndex & 2)) {
+                    addQuad(active.find(x, y-1, z-1), active.find(x, y, z-1),
+                            (int64_t)i, active.find(x, y-1, z), flip);
+                }
 
-                    // Process Z-aligned edges
-                    for (int z = zStart; z < zEnd; z++) {
-                        for (int y = 1; y < res - 1; y++) {
-                            for (int x = 1; x < res - 1; x++) {
-                                float v0 = distances[idx(x, y, z)];
-                                float v1 = distances[idx(x, y, z+1)];
-                                if (!signChange(v0, v1)) continue;
-                                int c0 = cellToVertex[cellIdx(x-1, y-1, z)];
-                                int c1 = cellToVertex[cellIdx(x, y-1, z)];
-                                int c2 = cellToVertex[cellIdx(x, y, z)];
-                                int c3 = cellToVertex[cellIdx(x-1, y, z)];
-                                addQuad(c0, c1, c2, c3, v0 >= isolevel);
-                            }
-                        }
-                    }
-                });
-            }
+                // Y-aligned edge: corners 0 -> 3. This quad runs x before z,
+                // the opposite turn to the X and Z quads, so it flips the other way.
+                if (x >= 1 && z >= 1 && inside0 != bool(cubeIndex & 8)) {
+                    addQuad(active.find(x-1, y, z-1), active.find(x, y, z-1),
+                            (int64_t)i, active.find(x-1, y, z), !flip);
+                }
 
-            for (auto& t : threads) t.join();
-        }
+                // Z-aligned edge: corners 0 -> 4
+                if (x >= 1 && y >= 1 && inside0 != bool(cubeIndex & 16)) {
+                    addQuad(active.find(x-1, y-1, z), active.find(x, y-1, z),
+                            (int64_t)i, active.find(x-1, y, z), flip);
+                }
+            }
+        });
 
-        // Merge thread-local index buffers
-        size_t totalIndices = 0;
-        for (const auto& ti : threadIndices) {
-            totalIndices += ti.size();
-        }
-        mesh.indices.reserve(totalIndices);
-        for (const auto& ti : threadIndices) {
-            mesh.indices.insert(mesh.indices.end(), ti.begin(), ti.end());
-        }
+        // Merge tile-local index buffers
+        mergeIndexBuffers(tileIndices, mesh.indices, scratch);
 
         auto dcEnd = std::chrono::high_resolution_clock::now();
         auto dcDuration = std::chrono::duration_cast<std::chrono::milliseconds>(dcEnd - dcStart);
-        std::cout << "DC mesh: " << mesh.vertices.size() << " vertices, "
+        std::cout << (adaptive ? "DC mesh (adaptive): " : "DC mesh: ") << mesh.vertices.size() << " vertices, "
                   << (mesh.indices.size() / 3) << " triangles"
-                  << " (threads: " << numThreads << ", " << dcDuration.count() << " ms)" << std::endl;
+                  << " (threads: " << numThreads << ", " << dcDuration.count() << " ms"
+                  << ", QEF solve " << (active.size() ? (double)qefSolveNs / active.size() : 0.0)
+                  << " ns/cell)" << std::endl;
     }
 
     return mesh;
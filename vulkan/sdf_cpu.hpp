@@ -0,0 +1,736 @@
+// CPU SDF evaluation - headless backend for the GPU SDF sampler
+// Evaluates scene SDFs described as an expression DAG without a Vulkan device
+//
+// Features:
+//   - Expression IR (Expr) with constant folding, remap and GLSL-style primitives
+//   - Compiled to a flat tape with common-subexpression elimination (compile)
+//   - SIMD tape interpreter (SDF_BATCH points per instruction, GCC/Clang vectors)
+//   - Parallel grid/slab sampling on the shared mc::ThreadPool, same grid
+//     positions and layout as sdf_sampler.comp (sampleGrid, sampleSlices)
+//   - Interval arithmetic (IntervalEvaluator) proving octree nodes empty or
+//     full, so brick maps only sample where the surface can be (sampleBricks)
+//   - Headless meshing straight from an expression (meshScene)
+//
+// Usage:
+//   using namespace sdfcpu;
+//   Expr scene = smoothUnion(sphere(1.0f), translate(box(0.5f, 0.5f, 0.5f), 1.0f, 0, 0), 0.1f);
+//   Tape tape = compile(scene);
+//   auto distances = sdfcpu::sampleGrid(tape, 256, {-2,-2,-2}, {2,2,2});
+//   mc::BrickMap bricks = sdfcpu::sampleBricks(tape, 2048, {-2,-2,-2}, {2,2,2});
+//   auto mesh = sdfcpu::meshScene(tape, 256, {-2,-2,-2}, {2,2,2});
+//
+//   // In the engine: route sample_sdf_* through this backend
+//   sdfx::set_cpu_scene(scene);
+
+#pragma once
+
+#include "marching_cubes.hpp"
+
+namespace sdfcpu {
+
+using mc::Vec3;
+
+// ============================================================================
+// EXPRESSION IR
+// ============================================================================
+
+// Opcodes. X/Y/Z are the sample position, T the engine time (iTime).
+enum class Op : uint8_t {
+    X, Y, Z, T, Const,
+    Add, Sub, Mul, Div, Min, Max,
+    Neg, Abs, Sqrt, Square, Sin, Cos, Floor
+};
+
+inline bool isUnary(Op op) { return op >= Op::Neg; }
+inline bool isBinary(Op op) { return op >= Op::Add && op < Op::Neg; }
+
+struct Node {
+    Op op;
+    float value = 0.0f;             // Op::Const only
+    std::shared_ptr<const Node> a, b;
+};
+
+inline float applyScalar(Op op, float a, float b) {
+    switch (op) {
+        case Op::Add: return a + b;
+        case Op::Sub: return a - b;
+        case Op::Mul: return a * b;
+        case Op::Div: return a / b;
+        case Op::Min: return std::min(a, b);
+        case Op::Max: return std::max(a, b);
+        case Op::Neg: return -a;
+        case Op::Abs: return std::fabs(a);
+        case Op::Sqrt: return std::sqrt(a);
+        case Op::Square: return a * a;
+        case Op::Sin: return std::sin(a);
+        case Op::Cos: return std::cos(a);
+        case Op::Floor: return std::floor(a);
+        default: return a;
+    }
+}
+
+// Immutable handle to a node of the expression DAG. Shared subtrees stay
+// shared, so building a scene is cheap and compile() sees the reuse.
+class Expr {
+public:
+    Expr(float c = 0.0f) : node(std::make_shared<Node>(Node{Op::Const, c, nullptr, nullptr})) {}
+
+    static Expr X() { return leaf(Op::X); }
+    static Expr Y() { return leaf(Op::Y); }
+    static Expr Z() { return leaf(Op::Z); }
+    static Expr T() { return leaf(Op::T); }
+
+    static Expr make(Op op, const Expr& a, const Expr& b = Expr()) {
+        bool binary = isBinary(op);
+        if (a.isConst() && (!binary || b.isConst())) {
+            return Expr(applyScalar(op, a.value(), b.value()));
+        }
+        // Identities that remap() and the primitive helpers produce a lot of
+        if (binary && b.isConst()) {
+            float c = b.value();
+            if ((op == Op::Add || op == Op::Sub) && c == 0.0f) return a;
+            if ((op == Op::Mul || op == Op::Div) && c == 1.0f) return a;
+        }
+        if (binary && a.isConst()) {
+            float c = a.value();
+            if (op == Op::Add && c == 0.0f) return b;
+            if (op == Op::Mul && c == 1.0f) return b;
+        }
+        return Expr(std::make_shared<Node>(Node{op, 0.0f, a.node, binary ? b.node : nullptr}));
+    }
+
+    Op op() const { return node->op; }
+    bool isConst() const { return node->op == Op::Const; }
+    float value() const { return node->value; }
+
+    // Substitute x, y, z (and leave t) throughout the expression
+    Expr remap(const Expr& x, const Expr& y, const Expr& z) const {
+        std::unordered_map<const Node*, Expr> memo;
+        return remapNode(node, x, y, z, memo);
+    }
+
+    std::shared_ptr<const Node> node;
+
+private:
+    explicit Expr(std::shared_ptr<const Node> n) : node(std::move(n)) {}
+
+    static Expr leaf(Op op) {
+        return Expr(std::make_shared<Node>(Node{op, 0.0f, nullptr, nullptr}));
+    }
+
+    static Expr remapNode(const std::shared_ptr<const Node>& n,
+                          const Expr& x, const Expr& y, const Expr& z,
+                          std::unordered_map<const Node*, Expr>& memo) {
+        switch (n->op) {
+            case Op::X: return x;
+            case Op::Y: return y;
+            case Op::Z: return z;
+            case Op::T: case Op::Const: return Expr(n);
+            default: break;
+        }
+        auto it = memo.find(n.get());
+        if (it != memo.end()) return it->second;
+        Expr a = remapNode(n->a, x, y, z, memo);
+        Expr b = n->b ? remapNode(n->b, x, y, z, memo) : Expr();
+        Expr r = make(n->op, a, b);
+        memo.emplace(n.get(), r);
+        return r;
+    }
+};
+
+inline Expr operator+(const Expr& a, const Expr& b) { return Expr::make(Op::Add, a, b); }
+inline Expr operator-(const Expr& a, const Expr& b) { return Expr::make(Op::Sub, a, b); }
+inline Expr operator*(const Expr& a, const Expr& b) { return Expr::make(Op::Mul, a, b); }
+inline Expr operator/(const Expr& a, const Expr& b) { return Expr::make(Op::Div, a, b); }
+inline Expr operator-(const Expr& a) { return Expr::make(Op::Neg, a); }
+inline Expr min(const Expr& a, const Expr& b) { return Expr::make(Op::Min, a, b); }
+inline Expr max(const Expr& a, const Expr& b) { return Expr::make(Op::Max, a, b); }
+inline Expr abs(const Expr& a) { return Expr::make(Op::Abs, a); }
+inline Expr sqrt(const Expr& a) { return Expr::make(Op::Sqrt, a); }
+inline Expr square(const Expr& a) { return Expr::make(Op::Square, a); }
+inline Expr sin(const Expr& a) { return Expr::make(Op::Sin, a); }
+inline Expr cos(const Expr& a) { return Expr::make(Op::Cos, a); }
+inline Expr floor(const Expr& a) { return Expr::make(Op::Floor, a); }
+inline Expr clamp(const Expr& v, const Expr& lo, const Expr& hi) { return min(max(v, lo), hi); }
+inline Expr length(const Expr& x, const Expr& y) { return sqrt(square(x) + square(y)); }
+inline Expr length(const Expr& x, const Expr& y, const Expr& z) {
+    return sqrt(square(x) + square(y) + square(z));
+}
+
+// ============================================================================
+// PRIMITIVES AND OPERATORS (same formulas as vulkan_kim/sdf_lib.glsl)
+// ============================================================================
+
+inline Expr sphere(float r, float cx = 0, float cy = 0, float cz = 0) {
+    return length(Expr::X() - cx, Expr::Y() - cy, Expr::Z() - cz) - r;
+}
+
+// Exact box (sdBox), half extents sx, sy, sz
+inline Expr box(float sx, float sy, float sz, float cx = 0, float cy = 0, float cz = 0) {
+    Expr qx = abs(Expr::X() - cx) - sx;
+    Expr qy = abs(Expr::Y() - cy) - sy;
+    Expr qz = abs(Expr::Z() - cz) - sz;
+    Expr outside = length(max(qx, 0.0f), max(qy, 0.0f), max(qz, 0.0f));
+    Expr inside = min(max(qx, max(qy, qz)), 0.0f);
+    return outside + inside;
+}
+
+inline Expr roundBox(float sx, float sy, float sz, float r, float cx = 0, float cy = 0, float cz = 0) {
+    return box(sx, sy, sz, cx, cy, cz) - r;
+}
+
+// Capped cylinder along Y (sdCylinder): half height h, radius r
+inline Expr cylinder(float r, float h, float cx = 0, float cy = 0, float cz = 0) {
+    Expr dx = length(Expr::X() - cx, Expr::Z() - cz) - r;
+    Expr dy = abs(Expr::Y() - cy) - h;
+    return min(max(dx, dy), 0.0f) + length(max(dx, 0.0f), max(dy, 0.0f));
+}
+
+inline Expr torus(float R, float r, float cx = 0, float cy = 0, float cz = 0) {
+    Expr q = length(Expr::X() - cx, Expr::Z() - cz) - R;
+    return length(q, Expr::Y() - cy) - r;
+}
+
+// sdEllipsoid (bound, not exact): radii rx, ry, rz
+inline Expr ellipsoid(float rx, float ry, float rz, float cx = 0, float cy = 0, float cz = 0) {
+    Expr px = Expr::X() - cx, py = Expr::Y() - cy, pz = Expr::Z() - cz;
+    Expr k0 = length(px * (1.0f / rx), py * (1.0f / ry), pz * (1.0f / rz));
+    Expr k1 = length(px * (1.0f / (rx * rx)), py * (1.0f / (ry * ry)), pz * (1.0f / (rz * rz)));
+    return k0 * (k0 - 1.0f) / k1;
+}
+
+// sdCapsule: segment a-b, radius r
+inline Expr capsule(float ax, float ay, float az, float bx, float by, float bz, float r) {
+    Expr pax = Expr::X() - ax, pay = Expr::Y() - ay, paz = Expr::Z() - az;
+    float bax = bx - ax, bay = by - ay, baz = bz - az;
+    float invLen2 = 1.0f / (bax * bax + bay * bay + baz * baz);
+    Expr h = clamp((pax * bax + pay * bay + paz * baz) * invLen2, 0.0f, 1.0f);
+    return length(pax - h * bax, pay - h * bay, paz - h * baz) - r;
+}
+
+// sdPlane: dot(p, n) + h
+inline Expr plane(float nx, float ny, float nz, float h) {
+    return Expr::X() * nx + Expr::Y() * ny + Expr::Z() * nz + h;
+}
+
+inline Expr opUnion(const Expr& a, const Expr& b) { return min(a, b); }
+inline Expr opSubtract(const Expr& a, const Expr& b) { return max(a, -b); }
+inline Expr opIntersect(const Expr& a, const Expr& b) { return max(a, b); }
+
+// sminQuadratic
+inline Expr smoothUnion(const Expr& a, const Expr& b, float k) {
+    k *= 4.0f;
+    Expr h = max(k - abs(a - b), 0.0f) * (1.0f / k);
+    return min(a, b) - h * h * (k * 0.25f);
+}
+
+// Classic opSmoothUnion / opSmoothSubtract, GLSL argument order:
+// opSmoothSubtract(d1, d2, k) carves d1 out of d2
+inline Expr opSmoothUnion(const Expr& d1, const Expr& d2, float k) {
+    Expr h = clamp(0.5f + (d2 - d1) * (0.5f / k), 0.0f, 1.0f);
+    return d2 + (d1 - d2) * h - h * (1.0f - h) * k;
+}
+
+inline Expr opSmoothSubtract(const Expr& d1, const Expr& d2, float k) {
+    Expr h = clamp(0.5f - (d2 + d1) * (0.5f / k), 0.0f, 1.0f);
+    return d2 + (-d1 - d2) * h + h * (1.0f - h) * k;
+}
+
+inline Expr translate(const Expr& e, float dx, float dy, float dz) {
+    return e.remap(Expr::X() - dx, Expr::Y() - dy, Expr::Z() - dz);
+}
+
+inline Expr scale(const Expr& e, float s) {
+    return e.remap(Expr::X() / s, Expr::Y() / s, Expr::Z() / s) * s;
+}
+
+inline Expr rotateX(const Expr& e, float angle) {
+    float c = std::cos(angle), s = std::sin(angle);
+    return e.remap(Expr::X(), Expr::Y() * c + Expr::Z() * s, Expr::Z() * c - Expr::Y() * s);
+}
+
+inline Expr rotateY(const Expr& e, float angle) {
+    float c = std::cos(angle), s = std::sin(angle);
+    return e.remap(Expr::X() * c - Expr::Z() * s, Expr::Y(), Expr::X() * s + Expr::Z() * c);
+}
+
+inline Expr rotateZ(const Expr& e, float angle) {
+    float c = std::cos(angle), s = std::sin(angle);
+    return e.remap(Expr::X() * c + Expr::Y() * s, Expr::Y() * c - Expr::X() * s, Expr::Z());
+}
+
+// ============================================================================
+// TAPE
+// ============================================================================
+
+// One instruction per distinct DAG node, operands referencing earlier slots;
+// the last instruction is the result
+struct Instr {
+    Op op;
+    uint32_t a = 0, b = 0;
+    float value = 0.0f;
+};
+
+struct Tape {
+    std::vector<Instr> instrs;
+    size_t size() const { return instrs.size(); }
+    bool empty() const { return instrs.empty(); }
+};
+
+// True when the tape reads the engine time (Op::T), so samples change every frame
+inline bool usesTime(const Tape& tape) {
+    for (const Instr& in : tape.instrs) {
+        if (in.op == Op::T) return true;
+    }
+    return false;
+}
+
+// Flatten the DAG in post order. Nodes are deduplicated by identity and by
+// (op, operands, value), so the repeated subtrees remap() creates for every
+// primitive collapse into one slot.
+inline Tape compile(const Expr& root) {
+    Tape tape;
+    std::unordered_map<const Node*, uint32_t> slots;
+    struct Key {
+        uint64_t bits;
+        uint32_t value;
+        bool operator==(const Key& o) const { return bits == o.bits && value == o.value; }
+    };
+    struct KeyHash {
+        size_t operator()(const Key& k) const {
+            return std::hash<uint64_t>()(k.bits * 0x9E3779B97F4A7C15ull ^ k.value);
+        }
+    };
+    std::unordered_map<Key, uint32_t, KeyHash> unique;
+
+    auto emit = [&](const Instr& in) {
+        uint32_t valueBits;
+        memcpy(&valueBits, &in.value, sizeof(valueBits));
+        Key key{(uint64_t)in.op << 56 | (uint64_t)in.a << 28 | in.b, valueBits};
+        auto it = unique.find(key);
+        if (it != unique.end()) return it->second;
+        uint32_t slot = (uint32_t)tape.instrs.size();
+        tape.instrs.push_back(in);
+        unique.emplace(key, slot);
+        return slot;
+    };
+
+    // Explicit stack: long union chains would otherwise recurse once per object
+    std::vector<std::pair<const Node*, bool>> stack = {{root.node.get(), false}};
+    while (!stack.empty()) {
+        auto [n, expanded] = stack.back();
+        stack.pop_back();
+        if (slots.count(n)) continue;
+        if (!expanded && n->a) {
+            stack.push_back({n, true});
+            if (n->b) stack.push_back({n->b.get(), false});
+            stack.push_back({n->a.get(), false});
+            continue;
+        }
+        Instr in{n->op};
+        if (n->op == Op::Const) in.value = n->value;
+        if (n->a) in.a = slots.at(n->a.get());
+        if (n->b) in.b = slots.at(n->b.get());
+        slots.emplace(n, emit(in));
+    }
+    return tape;
+}
+
+// ============================================================================
+// SIMD INTERPRETER
+// ============================================================================
+
+// Points are evaluated SDF_BATCH at a time: every instruction runs over
+// SDF_GROUPS independent vectors so the sqrt/div latency chains overlap and
+// the interpreter's dispatch is paid once per batch, not once per point.
+constexpr int SDF_LANES = mc::QEF_LANES;
+constexpr int SDF_GROUPS = 4;
+constexpr int SDF_BATCH = SDF_LANES * SDF_GROUPS;
+
+using Lanes = mc::QEFLanes;
+using LaneMask = mc::QEFMask;
+
+// Per-thread register file: one Lanes[SDF_GROUPS] block per tape slot
+class Evaluator {
+public:
+    explicit Evaluator(const Tape& t) : tape(&t), regs(t.size() * SDF_GROUPS) {}
+
+    // Evaluate count <= SDF_BATCH points; y and z are shared by the batch
+    // (one grid row). Tail lanes repeat the last point and are discarded.
+    void evalRow(const float* x, float y, float z, float time, float* out, int count) {
+        run(x, nullptr, nullptr, y, z, time, out, count);
+    }
+
+    // Evaluate count <= SDF_BATCH arbitrary points
+    void evalPoints(const float* x, const float* y, const float* z, float time, float* out, int count) {
+        run(x, y, z, 0.0f, 0.0f, time, out, count);
+    }
+
+private:
+    const Tape* tape;
+    std::vector<Lanes> regs;
+
+    void run(const float* x, const float* y, const float* z, float yRow, float zRow,
+             float time, float* out, int count) {
+        Lanes* r = regs.data();
+        const Instr* code = tape->instrs.data();
+        size_t n = tape->instrs.size();
+        for (size_t i = 0; i < n; i++) {
+            const Instr& in = code[i];
+            Lanes* d = r + i * SDF_GROUPS;
+            const Lanes* a = r + in.a * SDF_GROUPS;
+            const Lanes* b = r + in.b * SDF_GROUPS;
+            switch (in.op) {
+                case Op::X: load(d, x, count); break;
+                case Op::Y: if (y) load(d, y, count); else broadcast(d, yRow); break;
+                case Op::Z: if (z) load(d, z, count); else broadcast(d, zRow); break;
+                case Op::T: broadcast(d, time); break;
+                case Op::Const: broadcast(d, in.value); break;
+                case Op::Add: for (int g = 0; g < SDF_GROUPS; g++) d[g] = a[g] + b[g]; break;
+                case Op::Sub: for (int g = 0; g < SDF_GROUPS; g++) d[g] = a[g] - b[g]; break;
+                case Op::Mul: for (int g = 0; g < SDF_GROUPS; g++) d[g] = a[g] * b[g]; break;
+                case Op::Div: for (int g = 0; g < SDF_GROUPS; g++) d[g] = a[g] / b[g]; break;
+                case Op::Min: for (int g = 0; g < SDF_GROUPS; g++) d[g] = mc::qefMin(a[g], b[g]); break;
+                case Op::Max: for (int g = 0; g < SDF_GROUPS; g++) d[g] = mc::qefMax(a[g], b[g]); break;
+                case Op::Neg: for (int g = 0; g < SDF_GROUPS; g++) d[g] = -a[g]; break;
+                case Op::Abs: for (int g = 0; g < SDF_GROUPS; g++) d[g] = mc::qefAbs(a[g]); break;
+                case Op::Sqrt: for (int g = 0; g < SDF_GROUPS; g++) d[g] = mc::qefSqrt(a[g]); break;
+                case Op::Square: for (int g = 0; g < SDF_GROUPS; g++) d[g] = a[g] * a[g]; break;
+                case Op::Sin: scalar(d, a, [](float v) { return std::sin(v); }); break;
+                case Op::Cos: scalar(d, a, [](float v) { return std::cos(v); }); break;
+                case Op::Floor: scalar(d, a, [](float v) { return std::floor(v); }); break;
+            }
+        }
+        const float* result = reinterpret_cast<const float*>(r + (n - 1) * SDF_GROUPS);
+        memcpy(out, result, count * sizeof(float));
+    }
+
+    static void load(Lanes* d, const float* v, int count) {
+        for (int g = 0; g < SDF_GROUPS; g++) {
+            for (int l = 0; l < SDF_LANES; l++) d[g][l] = v[std::min(g * SDF_LANES + l, count - 1)];
+        }
+    }
+
+    static void broadcast(Lanes* d, float v) {
+        for (int g = 0; g < SDF_GROUPS; g++) d[g] = Lanes{} + v;
+    }
+
+    template<typename Fn>
+    static void scalar(Lanes* d, const Lanes* a, Fn fn) {
+        for (int g = 0; g < SDF_GROUPS; g++) {
+            for (int l = 0; l < SDF_LANES; l++) d[g][l] = fn(a[g][l]);
+        }
+    }
+};
+
+// ============================================================================
+// INTERVAL ARITHMETIC
+// ============================================================================
+
+// Closed range containing every value an expression takes over a box.
+// Bounds use round-to-nearest; the band they are compared against is many
+// ulps wide, so that slack never decides a cull.
+struct Interval {
+    float lo, hi;
+};
+
+// sin over [lo, hi] (cos is sin shifted by pi/2): endpoint values plus the
+// extrema that fall inside the range
+inline Interval intervalSin(Interval a) {
+    constexpr float PI = 3.14159265358979f, TWO_PI = 2.0f * PI;
+    if (!(a.hi - a.lo < TWO_PI)) return {-1.0f, 1.0f};
+    float s0 = std::sin(a.lo), s1 = std::sin(a.hi);
+    Interval r{std::min(s0, s1), std::max(s0, s1)};
+    if (std::ceil((a.lo - 0.5f * PI) / TWO_PI) * TWO_PI + 0.5f * PI <= a.hi) r.hi = 1.0f;
+    if (std::ceil((a.lo + 0.5f * PI) / TWO_PI) * TWO_PI - 0.5f * PI <= a.hi) r.lo = -1.0f;
+    return r;
+}
+
+// Per-thread interval register file, one Interval per tape slot
+class IntervalEvaluator {
+public:
+    explicit IntervalEvaluator(const Tape& t) : tape(&t), regs(t.size()) {}
+
+    // Range of the tape over the box [lo, hi] at time t
+    Interval eval(Vec3 lo, Vec3 hi, float time) {
+        const Instr* code = tape->instrs.data();
+        size_t n = tape->instrs.size();
+        for (size_t i = 0; i < n; i++) {
+            const Instr& in = code[i];
+            Interval a = regs[in.a], b = regs[in.b], r;
+            switch (in.op) {
+                case Op::X: r = {lo.x, hi.x}; break;
+                case Op::Y: r = {lo.y, hi.y}; break;
+                case Op::Z: r = {lo.z, hi.z}; break;
+                case Op::T: r = {time, time}; break;
+                case Op::Const: r = {in.value, in.value}; break;
+                case Op::Add: r = {a.lo + b.lo, a.hi + b.hi}; break;
+                case Op::Sub: r = {a.lo - b.hi, a.hi - b.lo}; break;
+                case Op::Mul: r = mul(a, b); break;
+                case Op::Div:
+                    r = b.lo > 0.0f || b.hi < 0.0f ? mul(a, {1.0f / b.hi, 1.0f / b.lo})
+                                                   : Interval{-INFINITY, INFINITY};
+                    break;
+                case Op::Min: r = {std::min(a.lo, b.lo), std::min(a.hi, b.hi)}; break;
+                case Op::Max: r = {std::max(a.lo, b.lo), std::max(a.hi, b.hi)}; break;
+                case Op::Neg: r = {-a.hi, -a.lo}; break;
+                case Op::Abs: r = absolute(a); break;
+                case Op::Sqrt: r = {std::sqrt(std::max(a.lo, 0.0f)), std::sqrt(std::max(a.hi, 0.0f))}; break;
+                case Op::Square: {
+                    Interval m = absolute(a);
+                    r = {m.lo * m.lo, m.hi * m.hi};
+                    break;
+                }
+                case Op::Sin: r = intervalSin(a); break;
+                case Op::Cos: r = intervalSin({a.lo + 1.57079632679f, a.hi + 1.57079632679f}); break;
+                case Op::Floor: r = {std::floor(a.lo), std::floor(a.hi)}; break;
+            }
+            // NaN (inf * 0, inf - inf) would vanish in a later min/max
+            if (!(r.lo <= r.hi)) r = {-INFINITY, INFINITY};
+            regs[i] = r;
+        }
+        return regs[n - 1];
+    }
+
+private:
+    const Tape* tape;
+    std::vector<Interval> regs;
+
+    static Interval mul(Interval a, Interval b) {
+        float p[4] = {a.lo * b.lo, a.lo * b.hi, a.hi * b.lo, a.hi * b.hi};
+        return {std::min({p[0], p[1], p[2], p[3]}), std::max({p[0], p[1], p[2], p[3]})};
+    }
+
+    static Interval absolute(Interval a) {
+        if (a.lo >= 0.0f) return a;
+        if (a.hi <= 0.0f) return {-a.hi, -a.lo};
+        return {0.0f, std::max(-a.lo, a.hi)};
+    }
+};
+
+// ============================================================================
+// GRID SAMPLING
+// ============================================================================
+
+// Sample grid points [lo, lo + dims) of the res³ grid spanning [bmin, bmax]
+// into out (x fastest). Grid positions are computed exactly as in
+// sdf_sampler.comp so CPU and GPU grids line up; points past res - 1 simply
+// continue the spacing.
+inline bool sampleBox(const Tape& tape, float* out, int res, Vec3 bmin, Vec3 bmax,
+                      const int lo[3], const int dims[3], float time = 0.0f) {
+    if (tape.empty() || res < 2 || dims[0] <= 0 || dims[1] <= 0 || dims[2] <= 0) return false;
+
+    float stepX = (bmax.x - bmin.x) / float(res - 1);
+    float stepY = (bmax.y - bmin.y) / float(res - 1);
+    float stepZ = (bmax.z - bmin.z) / float(res - 1);
+    std::vector<float> xs(dims[0]);
+    for (int ix = 0; ix < dims[0]; ix++) xs[ix] = bmin.x + float(lo[0] + ix) * stepX;
+
+    mc::ThreadPool& pool = mc::ThreadPool::instance();
+    std::vector<std::unique_ptr<Evaluator>> evaluators(pool.size());
+    size_t rows = static_cast<size_t>(dims[1]) * dims[2];
+
+    pool.parallelFor(rows, [&](size_t row, unsigned worker) {
+        auto& ev = evaluators[worker];
+        if (!ev) ev.reset(new Evaluator(tape));
+        int iy = lo[1] + (int)(row % dims[1]);
+        int iz = lo[2] + (int)(row / dims[1]);
+        float y = bmin.y + float(iy) * stepY;
+        float z = bmin.z + float(iz) * stepZ;
+        float* dst = out + row * dims[0];
+        for (int ix = 0; ix < dims[0]; ix += SDF_BATCH) {
+            ev->evalRow(xs.data() + ix, y, z, time, dst + ix, std::min(SDF_BATCH, dims[0] - ix));
+        }
+    });
+    return true;
+}
+
+// Sample zCount Z slices [zStart, zStart+zCount) of the res³ grid into out
+// (res*res*zCount floats, x fastest)
+inline bool sampleSlices(const Tape& tape, float* out, int res, Vec3 bmin, Vec3 bmax,
+                         int zStart, int zCount, float time = 0.0f) {
+    int lo[3] = {0, 0, zStart};
+    int dims[3] = {res, res, zCount};
+    return sampleBox(tape, out, res, bmin, bmax, lo, dims, time);
+}
+
+inline std::vector<float> sampleGrid(const Tape& tape, int res, Vec3 bmin, Vec3 bmax, float time = 0.0f) {
+    std::vector<float> distances(static_cast<size_t>(res) * res * res);
+    if (!sampleSlices(tape, distances.data(), res, bmin, bmax, 0, res, time)) return {};
+    return distances;
+}
+
+// Evaluate arbitrary points (PARALLEL over batches)
+inline std::vector<float> evaluate(const Tape& tape, const std::vector<Vec3>& points, float time = 0.0f) {
+    std::vector<float> out(points.size());
+    if (tape.empty()) return out;
+    mc::ThreadPool& pool = mc::ThreadPool::instance();
+    std::vector<std::unique_ptr<Evaluator>> evaluators(pool.size());
+    size_t batches = (points.size() + SDF_BATCH - 1) / SDF_BATCH;
+    pool.parallelFor(batches, [&](size_t batch, unsigned worker) {
+        auto& ev = evaluators[worker];
+        if (!ev) ev.reset(new Evaluator(tape));
+        size_t first = batch * SDF_BATCH;
+        int count = (int)std::min((size_t)SDF_BATCH, points.size() - first);
+        float x[SDF_BATCH], y[SDF_BATCH], z[SDF_BATCH];
+        for (int i = 0; i < count; i++) {
+            x[i] = points[first + i].x;
+            y[i] = points[first + i].y;
+            z[i] = points[first + i].z;
+        }
+        ev->evalPoints(x, y, z, time, &out[first], count);
+    });
+    return out;
+}
+
+// Normals from the SDF gradient (central differences, step h) at every vertex
+inline void computeGradientNormals(const Tape& tape, mc::Mesh& mesh, float h, float time = 0.0f) {
+    size_t n = mesh.vertices.size();
+    std::vector<Vec3> probes(n * 6);
+    for (size_t i = 0; i < n; i++) {
+        const Vec3& p = mesh.vertices[i];
+        Vec3* q = &probes[i * 6];
+        q[0] = {p.x + h, p.y, p.z}; q[1] = {p.x - h, p.y, p.z};
+        q[2] = {p.x, p.y + h, p.z}; q[3] = {p.x, p.y - h, p.z};
+        q[4] = {p.x, p.y, p.z + h}; q[5] = {p.x, p.y, p.z - h};
+    }
+    std::vector<float> d = evaluate(tape, probes, time);
+    mesh.normals.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        const float* g = &d[i * 6];
+        mesh.normals[i] = Vec3(g[0] - g[1], g[2] - g[3], g[4] - g[5]).normalized();
+    }
+}
+
+// ============================================================================
+// SPARSE SAMPLING
+// ============================================================================
+
+// Octree walk behind cullBricks. A node covers bricks [b, b + size) per axis
+// and is bounded by its first and last grid points.
+struct BrickCuller {
+    mc::BrickMap& map;
+    std::vector<uint8_t>& candidate;
+    float time;
+
+    void visit(IntervalEvaluator& ev, size_t& evaluations, const int b[3], int size) {
+        const float origin[3] = {map.boundsMin.x, map.boundsMin.y, map.boundsMin.z};
+        const float step[3] = {map.cellSize.x, map.cellSize.y, map.cellSize.z};
+        int end[3];
+        float lo[3], hi[3];
+        for (int a = 0; a < 3; a++) {
+            end[a] = std::min(b[a] + size, map.bricksPerAxis);
+            if (end[a] <= b[a]) return;
+            lo[a] = origin[a] + float(b[a] * mc::BRICK_SIZE) * step[a];
+            hi[a] = origin[a] + float(std::min(end[a] * mc::BRICK_SIZE, map.res) - 1) * step[a];
+        }
+        Interval r = ev.eval({lo[0], lo[1], lo[2]}, {hi[0], hi[1], hi[2]}, time);
+        evaluations++;
+
+        int32_t side = r.lo > map.band ? mc::BrickMap::OUTSIDE : r.hi < -map.band ? mc::BrickMap::INSIDE : 0;
+        if (side != 0 || size == 1) {
+            for (int z = b[2]; z < end[2]; z++)
+                for (int y = b[1]; y < end[1]; y++)
+                    for (int x = b[0]; x < end[0]; x++) {
+                        size_t i = map.brickIndex(x, y, z);
+                        if (side != 0) map.table[i] = side;
+                        else candidate[i] = 1;
+                    }
+            return;
+        }
+        int half = size / 2;
+        for (int c = 0; c < 8; c++) {
+            int child[3] = {b[0] + (c & 1) * half, b[1] + ((c >> 1) & 1) * half, b[2] + ((c >> 2) & 1) * half};
+            visit(ev, evaluations, child, half);
+        }
+    }
+};
+
+// Classify the bricks of a reset map by interval arithmetic over an octree.
+// A node whose range lies beyond +-band is proven outside/inside and all its
+// bricks are dropped unsampled; other nodes split down to single bricks,
+// which become the candidates for mc::fillBrickMap. The culling itself
+// assumes no Lipschitz bound and never drops a brick the surface passes
+// through, but fillBrickMap still drops candidates from their samples alone
+// (BrickMap::needsBrick): all of them beyond the band on one side. That is
+// only safe for 1-Lipschitz fields (or a band widened by the Lipschitz
+// bound), so BrickMap's caveat applies to the map as a whole. Roots are
+// BRICK_FETCH_GROUP³ bricks (PARALLEL over roots).
+inline std::vector<uint8_t> cullBricks(const Tape& tape, mc::BrickMap& map, float time = 0.0f) {
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<uint8_t> candidate(map.table.size());
+    if (tape.empty() || !map.valid()) return candidate;
+
+    const int G = mc::BRICK_FETCH_GROUP;
+    const int groups = (map.bricksPerAxis + G - 1) / G;
+    mc::ThreadPool& pool = mc::ThreadPool::instance();
+    std::vector<std::unique_ptr<IntervalEvaluator>> evaluators(pool.size());
+    std::vector<size_t> evaluations(pool.size());
+    BrickCuller culler{map, candidate, time};
+
+    pool.parallelFor((size_t)groups * groups * groups, [&](size_t g, unsigned worker) {
+        auto& ev = evaluators[worker];
+        if (!ev) ev.reset(new IntervalEvaluator(tape));
+        int b[3] = {(int)(g % groups) * G, (int)((g / groups) % groups) * G, (int)(g / ((size_t)groups * groups)) * G};
+        culler.visit(*ev, evaluations[worker], b, G);
+    });
+
+    size_t candidates = 0, total = 0;
+    for (uint8_t c : candidate) candidates += c;
+    for (size_t c : evaluations) total += c;
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "Interval culling: " << candidates << "/" << candidate.size() << " bricks may hold the band ("
+              << total << " interval evaluations, "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms)" << std::endl;
+    return candidate;
+}
+
+// Narrow-band brick map of the res³ grid: interval culling, then only the
+// candidate bricks are sampled
+inline mc::BrickMap sampleBricks(const Tape& tape, int res, Vec3 bmin, Vec3 bmax, float time = 0.0f,
+                                 float bandCells = mc::BRICK_BAND_CELLS) {
+    mc::BrickMap map;
+    map.reset(res, bmin, bmax, bandCells);
+    if (tape.empty() || !map.valid()) return mc::BrickMap();
+    std::vector<uint8_t> candidate = cullBricks(tape, map, time);
+    bool ok = mc::fillBrickMap(map, candidate, [&](const int lo[3], const int dims[3], float* dst) {
+        return sampleBox(tape, dst, res, bmin, bmax, lo, dims, time);
+    });
+    return ok ? map : mc::BrickMap();
+}
+
+// Dense res³ grid through the brick map: samples of the bricks interval
+// culling keeps, +-farValue of the proven side everywhere else. Meshes like
+// sampleGrid (same band caveat as BrickMap) without evaluating far points.
+inline std::vector<float> sampleGridCulled(const Tape& tape, int res, Vec3 bmin, Vec3 bmax, float time = 0.0f,
+                                           float bandCells = mc::BRICK_BAND_CELLS) {
+    mc::BrickMap bricks = sampleBricks(tape, res, bmin, bmax, time, bandCells);
+    if (!bricks.valid()) return {};
+    std::vector<float> grid((size_t)res * res * res);
+    size_t slice = (size_t)res * res;
+    mc::ThreadPool::instance().parallelFor((size_t)res, [&](size_t z, unsigned) {
+        int lo[3] = {0, 0, (int)z}, dims[3] = {res, res, 1};
+        bricks.extract(lo, dims, grid.data() + z * slice);
+    });
+    return grid;
+}
+
+// Headless welded marching cubes with gradient normals. Only the bricks that
+// interval culling cannot rule out are sampled, so memory and time follow
+// the surface area rather than res³.
+inline mc::Mesh meshScene(const Tape& tape, int res, Vec3 bmin, Vec3 bmax, float time = 0.0f) {
+    auto start = std::chrono::high_resolution_clock::now();
+    mc::BrickMap bricks = sampleBricks(tape, res, bmin, bmax, time);
+    if (!bricks.valid()) return {};
+    auto sampled = std::chrono::high_resolution_clock::now();
+    mc::Mesh mesh = mc::generateMeshBricks(bricks);
+    computeGradientNormals(tape, mesh, 0.5f * std::min({bricks.cellSize.x, bricks.cellSize.y, bricks.cellSize.z}), time);
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "CPU SDF mesh " << res << "³ (" << tape.size() << " instructions): sampled in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(sampled - start).count() << " ms, "
+              << mesh.indices.size() / 3 << " triangles in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - sampled).count() << " ms" << std::endl;
+    return mesh;
+}
+
+} // namespace sdfcpu
@@ -0,0 +1,207 @@
+// CPU translations of the bundled GLSL scenes (vulkan_kim/*.comp sceneSDF)
+// Lets the CPU sampler backend mesh and export the same shapes the GPU
+// sampler sees, on machines without a Vulkan device.
+//
+// Usage:
+//   sdfcpu::Expr scene;
+//   mc::Vec3 bmin, bmax;
+//   if (sdfcpu::sceneForShader("sdf_scene", scene, bmin, bmax)) {
+//       auto mesh = sdfcpu::meshScene(sdfcpu::compile(scene), 256, bmin, bmax);
+//   }
+//
+//   // In the engine: sdfx::set_cpu_scene_for_shader("sdf_scene")
+//
+// Each translation mirrors its shader line by line (same constants, same
+// operator formulas); keep them in sync when editing the .comp file.
+
+#pragma once
+
+#include "sdf_cpu.hpp"
+
+namespace sdfcpu {
+
+// ============================================================================
+// KIM KITSURAGI (vulkan_kim/sdf_scene.comp)
+// ============================================================================
+
+namespace kim {
+
+// GLSL rotateX(a) * (p - c) around a primitive built at the origin
+inline Expr atRotX(const Expr& e, float a, float cx, float cy, float cz) {
+    return translate(rotateX(e, a), cx, cy, cz);
+}
+
+inline Expr atRotZ(const Expr& e, float a, float cx, float cy, float cz) {
+    return translate(rotateZ(e, a), cx, cy, cz);
+}
+
+inline Expr head() {
+    Expr head = ellipsoid(0.085f, 0.115f, 0.095f, 0.0f, 1.72f, 0.0f);
+    Expr jaw = ellipsoid(0.075f, 0.065f, 0.075f, 0.0f, 1.63f, 0.02f);
+    head = opSmoothUnion(head, jaw, 0.04f);
+
+    Expr cheeks = opUnion(
+        atRotZ(ellipsoid(0.032f, 0.022f, 0.022f), 0.4f, -0.062f, 1.685f, 0.055f),
+        atRotZ(ellipsoid(0.032f, 0.022f, 0.022f), -0.4f, 0.062f, 1.685f, 0.055f));
+    head = opSmoothUnion(head, cheeks, 0.045f);
+
+    Expr ears = opUnion(
+        ellipsoid(0.015f, 0.03f, 0.01f, -0.09f, 1.72f, 0.0f),
+        ellipsoid(0.015f, 0.03f, 0.01f, 0.09f, 1.72f, 0.0f));
+    head = opSmoothUnion(head, ears, 0.01f);
+
+    Expr nose = ellipsoid(0.015f, 0.025f, 0.02f, 0.0f, 1.68f, 0.1f);
+    head = opSmoothUnion(head, nose, 0.02f);
+
+    Expr sockets = opUnion(
+        ellipsoid(0.024f, 0.020f, 0.030f, -0.035f, 1.72f, 0.08f),
+        ellipsoid(0.024f, 0.020f, 0.030f, 0.035f, 1.72f, 0.08f));
+    head = opSmoothSubtract(sockets, head, 0.02f);
+
+    Expr mouthArea = ellipsoid(0.022f, 0.008f, 0.015f, 0.0f, 1.615f, 0.088f);
+    return opSmoothUnion(head, mouthArea, 0.015f);
+}
+
+inline Expr eyes() {
+    return opUnion(sphere(0.012f, -0.032f, 1.72f, 0.055f), sphere(0.012f, 0.032f, 1.72f, 0.055f));
+}
+
+inline Expr lips() {
+    Expr upper = ellipsoid(0.018f, 0.0025f, 0.006f, 0.0f, 1.618f, 0.092f);
+    Expr lower = ellipsoid(0.016f, 0.0035f, 0.007f, 0.0f, 1.612f, 0.092f);
+    return opSmoothUnion(upper, lower, 0.002f);
+}
+
+inline Expr hair() {
+    Expr hair = ellipsoid(0.09f, 0.05f, 0.105f, 0.0f, 1.82f, -0.01f);
+    Expr sides = opUnion(
+        ellipsoid(0.025f, 0.05f, 0.07f, -0.085f, 1.76f, 0.0f),
+        ellipsoid(0.025f, 0.05f, 0.07f, 0.085f, 1.76f, 0.0f));
+    hair = opSmoothUnion(hair, sides, 0.03f);
+
+    Expr back = ellipsoid(0.08f, 0.07f, 0.04f, 0.0f, 1.75f, -0.08f);
+    hair = opSmoothUnion(hair, back, 0.03f);
+
+    Expr tufts = ellipsoid(0.03f, 0.015f, 0.03f, 0.0f, 1.87f, 0.04f);
+    tufts = opSmoothUnion(tufts, ellipsoid(0.025f, 0.012f, 0.025f, -0.04f, 1.86f, 0.02f), 0.01f);
+    tufts = opSmoothUnion(tufts, ellipsoid(0.022f, 0.010f, 0.025f, 0.035f, 1.86f, 0.025f), 0.01f);
+    return opSmoothUnion(hair, tufts, 0.015f);
+}
+
+inline Expr glasses() {
+    // glassP = p - (0, 1.72, 0.08)
+    const float gy = 1.72f, gz = 0.08f;
+    Expr frameL = atRotX(torus(0.022f, 0.003f), 1.57f, -0.035f, gy, gz);
+    Expr frameR = atRotX(torus(0.022f, 0.003f), 1.57f, 0.035f, gy, gz);
+    Expr lensL = atRotX(cylinder(0.021f, 0.002f), 1.57f, -0.035f, gy, gz);
+    Expr lensR = atRotX(cylinder(0.021f, 0.002f), 1.57f, 0.035f, gy, gz);
+    Expr bridge = translate(capsule(-0.01f, 0, 0, 0.01f, 0, 0, 0.002f), 0.0f, gy + 0.005f, gz);
+    Expr arms = opUnion(
+        translate(capsule(0, 0, 0, -0.04f, 0, -0.04f, 0.002f), -0.06f, gy, gz - 0.02f),
+        translate(capsule(0, 0, 0, 0.04f, 0, -0.04f, 0.002f), 0.06f, gy, gz - 0.02f));
+    Expr frames = opUnion(opUnion(frameL, frameR), opUnion(bridge, arms));
+    return opUnion(frames, opUnion(lensL, lensR));
+}
+
+inline Expr neck() {
+    return cylinder(0.035f, 0.06f, 0.0f, 1.52f, 0.0f);
+}
+
+inline Expr jacket() {
+    Expr torso = roundBox(0.12f, 0.18f, 0.07f, 0.025f, 0.0f, 1.3f, 0.0f);
+
+    // sdPlane(collarP, (0, -1, 0), 0) keeps the lower half of the collar ring
+    Expr collar = atRotX(torus(0.05f, 0.02f), 1.57f, 0.0f, 1.48f, 0.02f);
+    collar = opIntersect(collar, -(Expr::Y() - 1.48f));
+    torso = opSmoothUnion(torso, collar, 0.015f);
+
+    Expr shoulders = opUnion(
+        ellipsoid(0.045f, 0.035f, 0.05f, -0.14f, 1.42f, 0.0f),
+        ellipsoid(0.045f, 0.035f, 0.05f, 0.14f, 1.42f, 0.0f));
+    torso = opSmoothUnion(torso, shoulders, 0.025f);
+
+    Expr rib = cylinder(0.125f, 0.018f, 0.0f, 1.12f, 0.0f);
+    return opSmoothUnion(torso, rib, 0.01f);
+}
+
+inline Expr arms() {
+    Expr upper = opUnion(
+        translate(capsule(0, 0, 0, -0.04f, -0.14f, 0.02f, 0.035f), -0.18f, 1.35f, 0.0f),
+        translate(capsule(0, 0, 0, 0.04f, -0.14f, 0.02f, 0.035f), 0.18f, 1.35f, 0.0f));
+    Expr lower = opUnion(
+        translate(capsule(0, 0, 0, 0.0f, -0.16f, 0.04f, 0.03f), -0.22f, 1.21f, 0.02f),
+        translate(capsule(0, 0, 0, 0.0f, -0.16f, 0.04f, 0.03f), 0.22f, 1.21f, 0.02f));
+    return opSmoothUnion(upper, lower, 0.018f);
+}
+
+inline Expr hands() {
+    return opUnion(
+        ellipsoid(0.022f, 0.035f, 0.012f, -0.22f, 1.02f, 0.07f),
+        ellipsoid(0.022f, 0.035f, 0.012f, 0.22f, 1.02f, 0.07f));
+}
+
+inline Expr watch() {
+    Expr face = atRotX(cylinder(0.015f, 0.006f), 1.57f, -0.22f, 1.04f, 0.055f);
+    Expr band = box(0.02f, 0.012f, 0.006f, -0.22f, 1.04f, 0.055f);
+    return opUnion(face, band);
+}
+
+inline Expr badge() {
+    Expr shield = roundBox(0.03f, 0.035f, 0.006f, 0.008f, -0.08f, 1.38f, 0.10f);
+    Expr star = sphere(0.015f, -0.08f, 1.385f, 0.108f);
+    return opUnion(shield, star);
+}
+
+inline Expr pants() {
+    Expr hips = roundBox(0.09f, 0.09f, 0.055f, 0.018f, 0.0f, 1.0f, 0.0f);
+    Expr leftLeg = translate(capsule(0, 0.18f, 0, 0, -0.32f, 0, 0.045f), -0.05f, 0.7f, 0.0f);
+    Expr rightLeg = translate(capsule(0, 0.18f, 0, 0, -0.32f, 0, 0.045f), 0.05f, 0.7f, 0.0f);
+    return opSmoothUnion(hips, opUnion(leftLeg, rightLeg), 0.035f);
+}
+
+inline Expr shoes() {
+    return opUnion(
+        roundBox(0.035f, 0.018f, 0.06f, 0.012f, -0.05f, 0.35f, 0.02f),
+        roundBox(0.035f, 0.018f, 0.06f, 0.012f, 0.05f, 0.35f, 0.02f));
+}
+
+inline Expr shirt() {
+    return box(0.04f, 0.015f, 0.015f, 0.0f, 1.46f, 0.025f);
+}
+
+}  // namespace kim
+
+// sceneSDF of sdf_scene.comp: Kim (breathing with the engine time) on the ground
+inline Expr kimScene() {
+    using namespace kim;
+    Expr body = head();
+    for (const Expr& part : {eyes(), lips(), hair(), glasses(), neck(), shirt(), jacket(),
+                             arms(), hands(), watch(), badge(), pants(), shoes()}) {
+        body = opUnion(body, part);
+    }
+    // kimP.y -= sin(time * 1.5) * 0.002
+    Expr breathe = sin(Expr::T() * 1.5f) * 0.002f;
+    body = body.remap(Expr::X(), Expr::Y() - breathe, Expr::Z());
+
+    Expr ground = plane(0, 1, 0, -0.3f);
+    return opUnion(ground, body);
+}
+
+// Bounds enclosing kimScene's figure, ground slab included
+inline void kimSceneBounds(Vec3& bmin, Vec3& bmax) {
+    bmin = Vec3(-0.4f, 0.25f, -0.25f);
+    bmax = Vec3(0.4f, 1.95f, 0.25f);
+}
+
+// CPU translation of a bundled shader's sceneSDF, by shader name (no .comp),
+// with bounds enclosing what it models
+inline bool sceneForShader(const std::string& name, Expr& scene, Vec3& bmin, Vec3& bmax) {
+    if (name == "sdf_scene") {
+        scene = kimScene();
+        kimSceneBounds(bmin, bmax);
+        return true;
+    }
+    return false;
+}
+
+}  // namespace sdfcpu
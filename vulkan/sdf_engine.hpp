@@ -21,9 +21,16 @@
 #include <cmath>
 #include <chrono>
 #include <set>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <memory>
 #include <sys/stat.h>
+#include <unistd.h>
 #include <csignal>
 #include <dirent.h>
+#include <utime.h>
 
 // iOS doesn't have shaderc - we use pre-compiled SPIR-V files instead
 #if defined(__APPLE__)
@@ -47,6 +54,10 @@ typedef int shaderc_shader_kind;
 // CPU Marching Cubes for GPU-sampled SDF grids (standalone, no dependencies)
 #include "marching_cubes.hpp"
 
+// CPU SDF evaluator (headless sampler backend for IR-described scenes)
+#include "sdf_cpu.hpp"
+#include "sdf_cpu_scenes.hpp"
+
 namespace sdfx {
 
 // SIGINT handler for Ctrl+C
@@ -73,6 +84,7 @@ struct SceneObject {
     float rotation[3] = {0, 0, 0};  // Euler angles in radians
     int type = 0;  // Object type for shader
     bool selectable = true;
+    float boundRadius = 0.0f;  // Sphere around position enclosing the surface (0 = use meshEditRadius)
 
     SceneObject() = default;
     SceneObject(float x, float y, float z, int objType = 0, bool sel = true)
@@ -81,6 +93,22 @@ struct SceneObject {
     }
 };
 
+// Inputs besides the objects that decide the sampled SDF. A change means
+// every cached mesh block is stale (see mesh_source_state).
+struct MeshSourceState {
+    std::string shaderName;
+    time_t shaderModTime = 0;
+    uint64_t cpuSceneVersion = 0;  // Nonzero when the CPU backend samples
+    bool animated = false;         // The scene reads the time
+    float time = 0.0f;             // Only tracked for animated scenes
+
+    bool operator==(const MeshSourceState& o) const {
+        return shaderName == o.shaderName && shaderModTime == o.shaderModTime &&
+               cpuSceneVersion == o.cpuSceneVersion && animated == o.animated && time == o.time;
+    }
+    bool operator!=(const MeshSourceState& o) const { return !(*this == o); }
+};
+
 struct UBO {
     float cameraPos[4];
     float cameraTarget[4];
@@ -141,6 +169,48 @@ struct Camera {
     }
 };
 
+// SDF compute pipeline handles, as built by build_compute_pipeline
+struct ComputePipelineBuild {
+    uint64_t generation = 0;  // ShaderCompileQueue::generation of the request
+    std::string shaderName;
+    VkShaderModule module = VK_NULL_HANDLE;
+    VkPipelineLayout layout = VK_NULL_HANDLE;
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    double compileMs = 0.0;
+    double pipelineMs = 0.0;
+};
+
+// Pipeline replaced at a frame boundary; still referenced by command buffers
+// until every frame in flight at swap time has signalled its fence
+struct RetiredComputePipeline {
+    ComputePipelineBuild build;
+    uint64_t destroyAtFrame = 0;
+};
+
+// Background shader compile service (request_shader_compile). The worker
+// compiles and builds the pipeline; draw_frame swaps it in. Only the newest
+// request matters: a queued name is overwritten and a superseded build dropped.
+struct ShaderCompileQueue {
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::string requested;       // Shader waiting for the worker ("" = none)
+    uint64_t requestedGeneration = 0;
+    uint64_t generation = 0;     // Bumped by each request and by synchronous loads
+    bool busy = false;           // Worker is compiling
+    bool lastFailed = false;     // Most recent build failed (old pipeline kept)
+    bool stop = false;
+    std::unique_ptr<ComputePipelineBuild> ready;  // Built, waiting for draw_frame
+
+    // Invalidate queued and in-flight work (a synchronous load replaced it)
+    void cancel() {
+        std::lock_guard<std::mutex> lock(mutex);
+        requested.clear();
+        generation++;
+        lastFailed = false;
+    }
+};
+
 struct Engine {
     SDL_Window* window = nullptr;
     bool running = true;
@@ -188,6 +258,7 @@ struct Engine {
     VkPipelineLayout computePipelineLayout = VK_NULL_HANDLE;
     VkPipeline computePipeline = VK_NULL_HANDLE;
     VkShaderModule computeShaderModule = VK_NULL_HANDLE;
+    VkPipelineCache pipelineCache = VK_NULL_HANDLE;  // Persisted to <spirv cache>/pipeline.cache
 
     VkRenderPass renderPass = VK_NULL_HANDLE;
     std::vector<VkFramebuffer> framebuffers;
@@ -210,6 +281,7 @@ struct Engine {
     std::vector<VkFence> inFlightFences;
     uint32_t currentFrame = 0;
     uint32_t currentImageIndex = 0;  // For viewport screenshot
+    uint64_t frameIndex = 0;         // Frames submitted so far (deferred pipeline destruction)
 
     float time = 0.0f;
     bool initialized = false;
@@ -217,11 +289,19 @@ struct Engine {
     bool continuousMode = false;  // When true, always re-render (for animations)
     std::string shaderDir;
 
+    // Compiled SPIR-V cache (compile_glsl_to_spirv); "" = <shaderDir>/.spirv-cache
+    std::string spirvCacheDir;
+    bool spirvCacheEnabled = true;
+    std::atomic<uint32_t> spirvCacheHits{0};    // Atomic: the compile worker updates these too
+    std::atomic<uint32_t> spirvCacheMisses{0};
+
     // Shader switching
     std::vector<std::string> shaderList;  // List of .comp files
     int currentShaderIndex = 0;           // Currently loaded shader
     std::string currentShaderName;        // Name of current shader (without path/extension)
     time_t lastShaderModTime = 0;
+    ShaderCompileQueue shaderCompile;
+    std::vector<RetiredComputePipeline> retiredPipelines;
 
     // Edit mode state
     bool editMode = false;
@@ -262,6 +342,8 @@ struct Engine {
     bool meshFillWithCubes = true;      // true = voxel cubes for each active cell (default on)
     bool meshUseGpuDC = true;           // true = use GPU compute for DC (default on)
     float meshVoxelSize = 1.0f;         // Voxel size multiplier for fill-with-cubes mode (1.0 = cell size)
+    float meshDCSimplify = 0.0f;        // Adaptive DC collapse tolerance in cells (0 = uniform, CPU only)
+    float meshSdfLipschitz = 1.0f;      // Bound on |grad d| of the scene SDF, widens sparse sampling culls
     float meshScale = 1.0f;       // Scale factor for mesh preview
     int meshPreviewResolution = 1024;   // Default to 1024 for GPU cubes mode
     VkBuffer meshVertexBuffer = VK_NULL_HANDLE;
@@ -270,6 +352,10 @@ struct Engine {
     VkDeviceMemory meshIndexMemory = VK_NULL_HANDLE;
     uint32_t meshIndexCount = 0;
     uint32_t meshVertexCount = 0;
+    std::vector<mc::MeshCluster> meshClusters;  // Index buffer runs for per-frame culling (empty = draw whole)
+    bool meshClusterCulling = true;             // Frustum/backface cull clusters each frame
+    uint32_t meshVisibleTriangles = 0;          // Triangles drawn last frame
+    mc::PositionQuantizer meshQuantizer;        // Grid of the preview's 16-bit positions (push constants)
     VkPipeline meshPipeline = VK_NULL_HANDLE;
     VkPipelineLayout meshPipelineLayout = VK_NULL_HANDLE;
     VkDescriptorSetLayout meshDescriptorSetLayout = VK_NULL_HANDLE;
@@ -281,6 +367,17 @@ struct Engine {
     // Stored mesh for export (shared between preview and export)
     mc::Mesh currentMesh;
     int currentMeshResolution = 0;  // Resolution at which currentMesh was generated
+    mc::MeshArena meshArena;        // CPU mesher scratch reused by generate_mesh_preview
+    mc::MeshChunkCache meshChunks;  // Per-block MC cache for update_mesh_preview_incremental
+    std::vector<SceneObject> meshObjectSnapshot;  // Objects as of the last mesh update
+    MeshSourceState meshSourceSnapshot;           // Shader/scene/time as of the last mesh update
+    float meshEditRadius = 1.0f;    // Reach of objects without a boundRadius
+    float meshExportDetail = 1.0f;  // Fraction of triangles kept on export (1 = no simplification)
+    float meshExportMaxError = 0.0f;  // Simplification error bound in world units (0 = none)
+    bool meshOptimizeForGPU = true;   // Tipsify/overdraw/fetch-order exports and preview indices
+    bool meshExportQuantized = false;  // GLB exports use KHR_mesh_quantization attributes
+    bool meshRepairSeams = true;       // Weld chunk seams / duplicate vertices of DC and cubes meshes
+    mc::ManifoldReport meshManifold;   // Edge check from the last repair
 
     // Initialize default scene objects
     void initDefaultScene() {
@@ -703,6 +800,7 @@ inline void select_object(Engine* e, int id) {
 // Forward declarations for shader switching
 inline void scan_shaders();
 inline void load_shader_by_name(const std::string& name);
+inline void sync_cpu_scene(Engine* e);
 #if HAS_SHADERC
 inline std::vector<uint32_t> compile_glsl_to_spirv(const std::string& source,
                                                     const std::string& filename,
@@ -772,6 +870,8 @@ inline void load_shader_by_name(const std::string& name) {
     }
     std::cout << "[DEBUG] load_shader_by_name: engine OK, shaderDir=" << e->shaderDir << std::endl;
 
+    // This load wins over any background build still queued or in flight
+    e->shaderCompile.cancel();
     vkDeviceWaitIdle(e->device);
 
     std::string compPath = e->shaderDir + "/" + name + ".comp";
@@ -829,7 +929,7 @@ inline void load_shader_by_name(const std::string& name) {
     pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
     pipelineInfo.stage = stageInfo;
     pipelineInfo.layout = e->computePipelineLayout;
-    VkResult pipelineResult = vkCreateComputePipelines(e->device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &e->computePipeline);
+    VkResult pipelineResult = vkCreateComputePipelines(e->device, e->pipelineCache, 1, &pipelineInfo, nullptr, &e->computePipeline);
     if (pipelineResult != VK_SUCCESS) {
         std::cerr << "[DEBUG] load_shader_by_name: vkCreateComputePipelines FAILED! result=" << pipelineResult << std::endl;
         return;
@@ -837,6 +937,7 @@ inline void load_shader_by_name(const std::string& name) {
     std::cout << "[DEBUG] load_shader_by_name: pipeline created successfully, handle=" << (void*)e->computePipeline << std::endl;
 
     e->currentShaderName = name;
+    sync_cpu_scene(e);
     e->dirty = true;
     std::cout << "[DEBUG] load_shader_by_name: dirty flag set to TRUE" << std::endl;
 
@@ -907,6 +1008,39 @@ inline std::vector<uint32_t> load_spirv_file(const std::string& spv_path) {
     return spirv;
 }
 
+// Shader caches (compiled SPIR-V and the Vulkan pipeline cache) live here
+inline std::string spirv_cache_dir() {
+    auto* e = get_engine();
+    if (e && !e->spirvCacheDir.empty()) return e->spirvCacheDir;
+    return (e ? e->shaderDir : std::string("vulkan_kim")) + "/.spirv-cache";
+}
+
+// Write through a temporary file + rename, so a concurrent reader or a crash
+// never leaves a truncated cache entry behind
+inline void write_cache_file(const std::string& dir, const std::string& path,
+                             const void* data, size_t bytes) {
+    mkdir(dir.c_str(), 0755);  // EEXIST is fine; open below reports real failures
+    // Unique per process and thread (the shader compile worker writes here too)
+    std::string tmp = path + ".tmp" + std::to_string(getpid()) + "-" +
+                      std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    {
+        std::ofstream file(tmp, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            std::cerr << "Shader cache: cannot write " << tmp << std::endl;
+            return;
+        }
+        file.write(static_cast<const char*>(data), bytes);
+        if (!file) {
+            file.close();
+            std::remove(tmp.c_str());
+            return;
+        }
+    }
+    if (std::rename(tmp.c_str(), path.c_str()) != 0) {
+        std::remove(tmp.c_str());
+    }
+}
+
 #if HAS_SHADERC
 // File-based includer for shaderc to support #include directives
 class FileIncluder : public shaderc::CompileOptions::IncluderInterface {
@@ -983,21 +1117,149 @@ private:
     std::string base_dir_;
 };
 
+// ============================================================================
+// SPIR-V disk cache
+// ============================================================================
+// Compiled modules are stored as <key>.spv, content-addressed by a hash of the
+// preprocessed source (which inlines every resolved #include), the compile
+// options, the shader kind and file name, and the shaderc SPIR-V version.
+// Editing a shader or any header it includes changes the key, so entries
+// never need invalidating; stale ones are simply no longer looked up.
+//
+// Stale entries are evicted after each new one is written: files unused for
+// SPIRV_CACHE_MAX_AGE_DAYS go first, then the least recently used until the
+// rest fit in SPIRV_CACHE_MAX_BYTES (a hit refreshes the file's mtime). To
+// clear the cache by hand, delete the directory (<shaderDir>/.spirv-cache
+// unless set_spirv_cache_dir moved it) or call clear_spirv_cache(); either is
+// safe while the engine runs.
+
+// Bump when the key material or file layout changes
+constexpr uint32_t SPIRV_CACHE_VERSION = 2;
+constexpr uint32_t SPIRV_MAGIC = 0x07230203;
+constexpr uint64_t SPIRV_CACHE_MAX_BYTES = 64ull << 20;
+constexpr int SPIRV_CACHE_MAX_AGE_DAYS = 30;
+
+// Compile settings for every runtime compile; the cache key is built from
+// these same values
+constexpr shaderc_target_env SPIRV_TARGET_ENV = shaderc_target_env_vulkan;
+constexpr uint32_t SPIRV_TARGET_ENV_VERSION = shaderc_env_version_vulkan_1_2;
+constexpr shaderc_optimization_level SPIRV_OPT_LEVEL = shaderc_optimization_level_performance;
+
+// 128-bit key (two independent 64-bit FNV-1a style hashes) as 32 hex digits
+inline std::string spirv_cache_key(const std::string& material) {
+    uint64_t h0 = 0xcbf29ce484222325ull;
+    uint64_t h1 = 0x9e3779b97f4a7c15ull ^ material.size();
+    for (unsigned char c : material) {
+        h0 = (h0 ^ c) * 0x100000001b3ull;
+        h1 = ((h1 ^ c) * 0xff51afd7ed558ccdull);
+        h1 ^= h1 >> 29;
+    }
+    char key[33];
+    snprintf(key, sizeof(key), "%016llx%016llx", (unsigned long long)h0, (unsigned long long)h1);
+    return key;
+}
+
+inline bool read_spirv_cache(const std::string& path, std::vector<uint32_t>& spirv) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) return false;
+    size_t fileSize = file.tellg();
+    if (fileSize < 5 * sizeof(uint32_t) || fileSize % sizeof(uint32_t) != 0) return false;
+    file.seekg(0);
+    spirv.resize(fileSize / sizeof(uint32_t));
+    file.read(reinterpret_cast<char*>(spirv.data()), fileSize);
+    return file && spirv[0] == SPIRV_MAGIC;
+}
+
+inline void write_spirv_cache(const std::string& dir, const std::string& path,
+                              const std::vector<uint32_t>& spirv) {
+    write_cache_file(dir, path, spirv.data(), spirv.size() * sizeof(uint32_t));
+}
+
+// Delete .spv entries older than maxAgeSeconds, then the oldest of the rest
+// until they total at most maxBytes. Only touches .spv files (pipeline.cache
+// and other files are left alone). Returns the number of entries removed.
+inline int prune_spirv_cache(const std::string& dir, uint64_t maxBytes, int64_t maxAgeSeconds) {
+    DIR* d = opendir(dir.c_str());
+    if (!d) return 0;
+    struct Entry {
+        std::string path;
+        time_t mtime;
+        uint64_t bytes;
+    };
+    std::vector<Entry> entries;
+    while (struct dirent* ent = readdir(d)) {
+        std::string name = ent->d_name;
+        if (name.size() <= 4 || name.compare(name.size() - 4, 4, ".spv") != 0) continue;
+        std::string path = dir + "/" + name;
+        struct stat st;
+        if (stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode)) {
+            entries.push_back({path, st.st_mtime, (uint64_t)st.st_size});
+        }
+    }
+    closedir(d);
+
+    // Newest first; everything past the age or size limit goes
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry& a, const Entry& b) { return a.mtime > b.mtime; });
+    time_t now = time(nullptr);
+    uint64_t kept = 0;
+    int removed = 0;
+    for (const Entry& entry : entries) {
+        if (now - entry.mtime > maxAgeSeconds || kept + entry.bytes > maxBytes) {
+            if (std::remove(entry.path.c_str()) == 0) removed++;
+        } else {
+            kept += entry.bytes;
+        }
+    }
+    return removed;
+}
+
 // Compile GLSL source to SPIR-V in memory using shaderc
-// Returns empty vector on failure
+// Returns empty vector on failure. Results are cached on disk (see above):
+// a hit costs one preprocess pass instead of an optimizing compile.
 inline std::vector<uint32_t> compile_glsl_to_spirv(const std::string& source,
                                                     const std::string& filename,
                                                     shaderc_shader_kind kind) {
     static shaderc::Compiler compiler;
     shaderc::CompileOptions options;
-    options.SetTargetEnvironment(shaderc_target_env_vulkan, shaderc_env_version_vulkan_1_2);
-    options.SetOptimizationLevel(shaderc_optimization_level_performance);
+    options.SetTargetEnvironment(SPIRV_TARGET_ENV, SPIRV_TARGET_ENV_VERSION);
+    options.SetOptimizationLevel(SPIRV_OPT_LEVEL);
 
     // Enable include support - resolve from vulkan_kim directory
     auto* e = get_engine();
     std::string include_dir = e ? e->shaderDir : "vulkan_kim";
     options.SetIncluder(std::make_unique<FileIncluder>(include_dir));
 
+    auto start = std::chrono::high_resolution_clock::now();
+    std::string cacheDir, cachePath;
+    if (!e || e->spirvCacheEnabled) {
+        auto pre = compiler.PreprocessGlsl(source, kind, filename.c_str(), options);
+        // Preprocessing errors fall through to the compile below, which reports them
+        if (pre.GetCompilationStatus() == shaderc_compilation_status_success) {
+            unsigned int spvVersion = 0, spvRevision = 0;
+            shaderc_get_spv_version(&spvVersion, &spvRevision);
+            std::string material = "sdfx-spirv " + std::to_string(SPIRV_CACHE_VERSION) +
+                " spv " + std::to_string(spvVersion) + "." + std::to_string(spvRevision) +
+                " env " + std::to_string((int)SPIRV_TARGET_ENV) + "." + std::to_string(SPIRV_TARGET_ENV_VERSION) +
+                " opt " + std::to_string((int)SPIRV_OPT_LEVEL) + " kind " + std::to_string((int)kind) +
+                " file " + filename + "\n";
+            material.append(pre.cbegin(), pre.cend());
+
+            cacheDir = spirv_cache_dir();
+            cachePath = cacheDir + "/" + spirv_cache_key(material) + ".spv";
+            std::vector<uint32_t> cached;
+            if (read_spirv_cache(cachePath, cached)) {
+                if (e) e->spirvCacheHits++;
+                utime(cachePath.c_str(), nullptr);  // Recently used, for eviction
+                auto end = std::chrono::high_resolution_clock::now();
+                std::cout << "SPIR-V cache hit: " << filename << " ("
+                          << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
+                          << " ms)" << std::endl;
+                return cached;
+            }
+        }
+    }
+
     auto result = compiler.CompileGlslToSpv(source, kind, filename.c_str(), options);
 
     if (result.GetCompilationStatus() != shaderc_compilation_status_success) {
@@ -1005,7 +1267,17 @@ inline std::vector<uint32_t> compile_glsl_to_spirv(const std::string& source,
         return {};
     }
 
-    return std::vector<uint32_t>(result.cbegin(), result.cend());
+    std::vector<uint32_t> spirv(result.cbegin(), result.cend());
+    if (!cachePath.empty()) {
+        if (e) e->spirvCacheMisses++;
+        write_spirv_cache(cacheDir, cachePath, spirv);
+        prune_spirv_cache(cacheDir, SPIRV_CACHE_MAX_BYTES, int64_t(SPIRV_CACHE_MAX_AGE_DAYS) * 24 * 3600);
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << "Compiled " << filename << " in "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
+                  << " ms (cached)" << std::endl;
+    }
+    return spirv;
 }
 #else
 // iOS: Use pre-compiled SPIR-V files instead of runtime compilation
@@ -1030,6 +1302,287 @@ inline std::vector<uint32_t> compile_glsl_to_spirv(const std::string& source,
 }
 #endif
 
+// ============================================================================
+// Pipeline cache
+// ============================================================================
+
+inline std::string pipeline_cache_path() {
+    return spirv_cache_dir() + "/pipeline.cache";
+}
+
+// Create e->pipelineCache, seeded from disk when the saved data came from this
+// driver and device (header vendorID, deviceID and pipelineCacheUUID match)
+inline void create_pipeline_cache(Engine* e) {
+    std::vector<char> data;
+    std::ifstream file(pipeline_cache_path(), std::ios::binary | std::ios::ate);
+    if (file.is_open()) {
+        size_t fileSize = file.tellg();
+        file.seekg(0);
+        data.resize(fileSize);
+        file.read(data.data(), fileSize);
+        if (!file) data.clear();
+    }
+
+    if (!data.empty()) {
+        // VkPipelineCacheHeaderVersionOne: headerSize, headerVersion, vendorID, deviceID, UUID
+        VkPhysicalDeviceProperties props;
+        vkGetPhysicalDeviceProperties(e->physicalDevice, &props);
+        uint32_t header[4] = {};
+        bool compatible = data.size() >= sizeof(header) + VK_UUID_SIZE;
+        if (compatible) {
+            memcpy(header, data.data(), sizeof(header));
+            compatible = header[1] == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+                         header[2] == props.vendorID && header[3] == props.deviceID &&
+                         memcmp(data.data() + sizeof(header), props.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+        }
+        if (!compatible) {
+            std::cout << "Pipeline cache: ignoring data from another driver/device" << std::endl;
+            data.clear();
+        }
+    }
+
+    VkPipelineCacheCreateInfo cacheInfo{};
+    cacheInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    cacheInfo.initialDataSize = data.size();
+    cacheInfo.pInitialData = data.empty() ? nullptr : data.data();
+    if (vkCreatePipelineCache(e->device, &cacheInfo, nullptr, &e->pipelineCache) != VK_SUCCESS) {
+        std::cerr << "Pipeline cache creation failed, pipelines will not be cached" << std::endl;
+        e->pipelineCache = VK_NULL_HANDLE;
+        return;
+    }
+    if (!data.empty()) {
+        std::cout << "Pipeline cache: loaded " << data.size() << " bytes" << std::endl;
+    }
+}
+
+inline void save_pipeline_cache(Engine* e) {
+    if (e->pipelineCache == VK_NULL_HANDLE) return;
+    size_t size = 0;
+    if (vkGetPipelineCacheData(e->device, e->pipelineCache, &size, nullptr) != VK_SUCCESS || size == 0) return;
+    std::vector<char> data(size);
+    if (vkGetPipelineCacheData(e->device, e->pipelineCache, &size, data.data()) != VK_SUCCESS) return;
+    write_cache_file(spirv_cache_dir(), pipeline_cache_path(), data.data(), size);
+}
+
+// ============================================================================
+// Async shader compilation
+// ============================================================================
+// request_shader_compile hands a shader name to a worker thread, which reads,
+// compiles (through the SPIR-V cache) and builds the compute pipeline against
+// e->pipelineCache. draw_frame then calls apply_shader_compile_result right
+// after its fence wait: the new pipeline is installed for the frame about to
+// be recorded and the old one is retired until the frames that may still
+// reference it have completed. The render thread never blocks on shaderc or
+// on pipeline creation, and no vkDeviceWaitIdle is needed.
+
+// Read and compile <shaderDir>/<name>.comp (iOS: load the pre-compiled .spv)
+inline std::vector<uint32_t> compile_compute_shader(Engine* e, const std::string& name) {
+    std::string compPath = e->shaderDir + "/" + name + ".comp";
+#if HAS_SHADERC
+    std::string glslSource = read_text_file(compPath);
+    if (glslSource.empty()) {
+        std::cerr << "Failed to read shader source: " << compPath << std::endl;
+        return {};
+    }
+    return compile_glsl_to_spirv(glslSource, name + ".comp", shaderc_compute_shader);
+#else
+    return compile_glsl_to_spirv("", compPath, shaderc_compute_shader);
+#endif
+}
+
+inline void destroy_compute_pipeline(Engine* e, const ComputePipelineBuild& build) {
+    vkDestroyPipeline(e->device, build.pipeline, nullptr);
+    vkDestroyPipelineLayout(e->device, build.layout, nullptr);
+    vkDestroyShaderModule(e->device, build.module, nullptr);
+}
+
+// Create module, layout and pipeline for the SDF compute shader. Callable off
+// the render thread: it only reads handles fixed at init, and the pipeline
+// cache is internally synchronized. On failure nothing is left allocated.
+inline bool build_compute_pipeline(Engine* e, const std::vector<uint32_t>& spirv, ComputePipelineBuild& out) {
+    VkShaderModuleCreateInfo moduleInfo{};
+    moduleInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    moduleInfo.codeSize = spirv.size() * sizeof(uint32_t);
+    moduleInfo.pCode = spirv.data();
+    if (vkCreateShaderModule(e->device, &moduleInfo, nullptr, &out.module) != VK_SUCCESS) {
+        out.module = VK_NULL_HANDLE;
+        return false;
+    }
+
+    VkPipelineLayoutCreateInfo layoutInfo{};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    layoutInfo.setLayoutCount = 1;
+    layoutInfo.pSetLayouts = &e->descriptorSetLayout;
+    if (vkCreatePipelineLayout(e->device, &layoutInfo, nullptr, &out.layout) != VK_SUCCESS) {
+        vkDestroyShaderModule(e->device, out.module, nullptr);
+        out.module = VK_NULL_HANDLE;
+        out.layout = VK_NULL_HANDLE;
+        return false;
+    }
+
+    VkPipelineShaderStageCreateInfo stageInfo{};
+    stageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    stageInfo.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    stageInfo.module = out.module;
+    stageInfo.pName = "main";
+
+    VkComputePipelineCreateInfo pipelineInfo{};
+    pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+    pipelineInfo.stage = stageInfo;
+    pipelineInfo.layout = out.layout;
+    if (vkCreateComputePipelines(e->device, e->pipelineCache, 1, &pipelineInfo, nullptr, &out.pipeline) != VK_SUCCESS) {
+        vkDestroyPipelineLayout(e->device, out.layout, nullptr);
+        vkDestroyShaderModule(e->device, out.module, nullptr);
+        out.module = VK_NULL_HANDLE;
+        out.layout = VK_NULL_HANDLE;
+        out.pipeline = VK_NULL_HANDLE;
+        return false;
+    }
+    return true;
+}
+
+inline void shader_compile_worker(Engine* e) {
+    auto& q = e->shaderCompile;
+    std::unique_lock<std::mutex> lock(q.mutex);
+    while (true) {
+        q.wake.wait(lock, [&q] { return q.stop || !q.requested.empty(); });
+        if (q.stop) return;
+
+        auto build = std::make_unique<ComputePipelineBuild>();
+        build->shaderName = std::move(q.requested);
+        build->generation = q.requestedGeneration;
+        q.requested.clear();
+        q.busy = true;
+        lock.unlock();
+
+        auto start = std::chrono::high_resolution_clock::now();
+        auto spirv = compile_compute_shader(e, build->shaderName);
+        auto compiled = std::chrono::high_resolution_clock::now();
+        bool ok = !spirv.empty() && build_compute_pipeline(e, spirv, *build);
+        auto built = std::chrono::high_resolution_clock::now();
+        build->compileMs = std::chrono::duration<double, std::milli>(compiled - start).count();
+        build->pipelineMs = std::chrono::duration<double, std::milli>(built - compiled).count();
+        if (!ok) {
+            std::cerr << "Background shader build failed: " << build->shaderName
+                      << (spirv.empty() ? " (compile error)" : " (pipeline creation)")
+                      << ", keeping current pipeline" << std::endl;
+        }
+
+        lock.lock();
+        q.busy = false;
+        q.lastFailed = !ok;
+        if (!ok) continue;
+        // A build nobody swapped in yet was never bound, so it can go right away
+        if (q.ready) destroy_compute_pipeline(e, *q.ready);
+        q.ready = std::move(build);
+    }
+}
+
+// Queue <shaderDir>/<name>.comp for a background build; replaces any request
+// the worker has not started yet. Returns the request generation (0 = refused).
+inline int request_shader_compile(const char* name) {
+    auto* e = get_engine();
+    if (!e || !e->initialized || !name || !*name) return 0;
+    auto& q = e->shaderCompile;
+    std::lock_guard<std::mutex> lock(q.mutex);
+    if (!q.worker.joinable()) {
+        q.worker = std::thread(shader_compile_worker, e);
+    }
+    q.requested = name;
+    q.requestedGeneration = ++q.generation;
+    q.wake.notify_one();
+    return static_cast<int>(q.requestedGeneration);
+}
+
+// Frame-boundary half of the service; called by draw_frame after it waited on
+// the current frame's fence, before recording
+inline void apply_shader_compile_result(Engine* e) {
+    // A pipeline last recorded in frame N-1 is idle once that frame's fence has
+    // been waited on, i.e. at frame N-1+MAX_FRAMES_IN_FLIGHT
+    auto& retired = e->retiredPipelines;
+    for (size_t i = 0; i < retired.size();) {
+        if (e->frameIndex >= retired[i].destroyAtFrame) {
+            destroy_compute_pipeline(e, retired[i].build);
+            retired[i] = retired.back();
+            retired.pop_back();
+        } else {
+            i++;
+        }
+    }
+
+    std::unique_ptr<ComputePipelineBuild> build;
+    {
+        std::lock_guard<std::mutex> lock(e->shaderCompile.mutex);
+        if (!e->shaderCompile.ready) return;
+        build = std::move(e->shaderCompile.ready);
+        if (build->generation != e->shaderCompile.generation) {
+            // Superseded by a synchronous load; never bound
+            destroy_compute_pipeline(e, *build);
+            return;
+        }
+    }
+
+    RetiredComputePipeline old;
+    old.build.module = e->computeShaderModule;
+    old.build.layout = e->computePipelineLayout;
+    old.build.pipeline = e->computePipeline;
+    old.destroyAtFrame = e->frameIndex + MAX_FRAMES_IN_FLIGHT - 1;
+    retired.push_back(old);
+
+    e->computeShaderModule = build->module;
+    e->computePipelineLayout = build->layout;
+    e->computePipeline = build->pipeline;
+    e->currentShaderName = build->shaderName;
+    sync_cpu_scene(e);
+    for (size_t i = 0; i < e->shaderList.size(); i++) {
+        if (e->shaderList[i] == build->shaderName) {
+            e->currentShaderIndex = static_cast<int>(i);
+            break;
+        }
+    }
+    std::string shaderPath = e->shaderDir + "/" + build->shaderName + ".comp";
+    struct stat st;
+    if (stat(shaderPath.c_str(), &st) == 0) {
+        e->lastShaderModTime = st.st_mtime;
+    }
+    e->dirty = true;
+
+    std::cout << "Shader swapped in: " << build->shaderName << " (compile "
+              << (int)build->compileMs << " ms, pipeline " << (int)build->pipelineMs
+              << " ms)" << std::endl;
+}
+
+// Stop the worker and release everything it or the swap path still owns.
+// Call before destroying the device (cleanup does).
+inline void shutdown_shader_compiler(Engine* e) {
+    auto& q = e->shaderCompile;
+    {
+        std::lock_guard<std::mutex> lock(q.mutex);
+        q.stop = true;
+        q.requested.clear();
+    }
+    q.wake.notify_all();
+    if (q.worker.joinable()) q.worker.join();
+
+    vkDeviceWaitIdle(e->device);
+    if (q.ready) {
+        destroy_compute_pipeline(e, *q.ready);
+        q.ready.reset();
+    }
+    for (auto& r : e->retiredPipelines) destroy_compute_pipeline(e, r.build);
+    e->retiredPipelines.clear();
+}
+
+// 0 = idle, 1 = compile queued/running or waiting for the swap, 2 = last build failed
+inline int get_shader_compile_status() {
+    auto* e = get_engine();
+    if (!e) return 0;
+    std::lock_guard<std::mutex> lock(e->shaderCompile.mutex);
+    const auto& q = e->shaderCompile;
+    if (q.busy || !q.requested.empty() || q.ready) return 1;
+    return q.lastFailed ? 2 : 0;
+}
+
 // Main API functions
 inline bool init(const char* shader_dir) {
     if (get_engine() && get_engine()->initialized) {
@@ -1319,6 +1872,10 @@ inline bool init(const char* shader_dir) {
 
     // Set default shader name BEFORE loading
     e->currentShaderName = "hand_cigarette";  // Default shader name (without .comp extension)
+    sync_cpu_scene(e);
+
+    // Pipeline cache shared by every compute pipeline the engine builds
+    create_pipeline_cache(e);
 
     // Load and compile compute shader
     std::string shaderPath = e->shaderDir + "/" + e->currentShaderName + ".comp";
@@ -1368,7 +1925,7 @@ inline bool init(const char* shader_dir) {
     pipelineInfo.stage = shaderStageInfo;
     pipelineInfo.layout = e->computePipelineLayout;
 
-    vkCreateComputePipelines(e->device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &e->computePipeline);
+    vkCreateComputePipelines(e->device, e->pipelineCache, 1, &pipelineInfo, nullptr, &e->computePipeline);
 
     // Descriptor pools
     std::array<VkDescriptorPoolSize, 3> poolSizes{};
@@ -2043,6 +2600,9 @@ inline void draw_frame() {
 
     vkWaitForFences(e->device, 1, &e->inFlightFences[e->currentFrame], VK_TRUE, UINT64_MAX);
 
+    // Frame boundary: install a background-built shader, free retired pipelines
+    apply_shader_compile_result(e);
+
     uint32_t imageIndex;
     vkAcquireNextImageKHR(e->device, e->swapchain, UINT64_MAX,
                           e->imageAvailableSemaphores[e->currentFrame], VK_NULL_HANDLE, &imageIndex);
@@ -2153,6 +2713,7 @@ inline void draw_frame() {
     vkQueuePresentKHR(e->presentQueue, &presentInfo);
 
     e->currentFrame = (e->currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
+    e->frameIndex++;
 }
 
 // ImGui frame management for native rendering (without jank)
@@ -2170,6 +2731,7 @@ inline void cleanup() {
     auto* e = get_engine();
     if (!e || !e->initialized) return;
 
+    shutdown_shader_compiler(e);
     vkDeviceWaitIdle(e->device);
 
     // Cleanup ImGui
@@ -2198,6 +2760,9 @@ inline void cleanup() {
     vkDestroyPipelineLayout(e->device, e->computePipelineLayout, nullptr);
     vkDestroyShaderModule(e->device, e->computeShaderModule, nullptr);
 
+    save_pipeline_cache(e);
+    vkDestroyPipelineCache(e->device, e->pipelineCache, nullptr);
+
     vkDestroyDescriptorPool(e->device, e->descriptorPool, nullptr);
     vkDestroyDescriptorPool(e->device, e->blitDescriptorPool, nullptr);
     vkDestroyDescriptorSetLayout(e->device, e->descriptorSetLayout, nullptr);
@@ -2231,6 +2796,8 @@ inline int compile_glsl_to_spirv_stored(const char* glsl_source, const char* sha
     auto* e = get_engine();
     if (!e || !e->initialized) return 1;
 
+    // The jank-side pipeline recreation replaces any pending background build
+    e->shaderCompile.cancel();
     auto spirv = compile_glsl_to_spirv(glsl_source, shader_name, shaderc_compute_shader);
     if (spirv.empty()) {
         return 1;  // Compile error
@@ -2466,6 +3033,41 @@ inline void set_last_shader_mod_time(int64_t t) {
     if (e) e->lastShaderModTime = static_cast<time_t>(t);
 }
 
+// SPIR-V disk cache controls
+inline bool get_spirv_cache_enabled() {
+    auto* e = get_engine();
+    return e ? e->spirvCacheEnabled : true;
+}
+
+inline void set_spirv_cache_enabled(bool enabled) {
+    auto* e = get_engine();
+    if (e) e->spirvCacheEnabled = enabled;
+}
+
+inline void set_spirv_cache_dir(const char* dir) {
+    auto* e = get_engine();
+    if (e) e->spirvCacheDir = dir ? dir : "";
+}
+
+inline int get_spirv_cache_hits() {
+    auto* e = get_engine();
+    return e ? (int)e->spirvCacheHits.load() : 0;
+}
+
+inline int get_spirv_cache_misses() {
+    auto* e = get_engine();
+    return e ? (int)e->spirvCacheMisses.load() : 0;
+}
+
+// Delete every cached SPIR-V module; returns how many were removed
+inline int clear_spirv_cache() {
+#if HAS_SHADERC
+    return prune_spirv_cache(spirv_cache_dir(), 0, 0);
+#else
+    return 0;
+#endif
+}
+
 // Pending shader switch - consumed by Jank main loop
 inline int get_pending_shader_switch() {
     auto* e = get_engine();
@@ -2523,6 +3125,15 @@ inline bool get_object_selectable(int idx) {
     if (e && idx >= 0 && idx < (int)e->objects.size()) return e->objects[idx].selectable;
     return false;
 }
+inline float get_object_bound_radius(int idx) {
+    auto* e = get_engine();
+    if (e && idx >= 0 && idx < (int)e->objects.size()) return e->objects[idx].boundRadius;
+    return 0.0f;
+}
+inline void set_object_bound_radius(int idx, float radius) {
+    auto* e = get_engine();
+    if (e && idx >= 0 && idx < (int)e->objects.size()) e->objects[idx].boundRadius = std::max(0.0f, radius);
+}
 
 inline int get_object_count() {
     auto* e = get_engine();
@@ -2578,6 +3189,11 @@ inline VkPipelineLayout get_compute_pipeline_layout() {
     return e ? e->computePipelineLayout : VK_NULL_HANDLE;
 }
 
+inline VkPipelineCache get_pipeline_cache() {
+    auto* e = get_engine();
+    return e ? e->pipelineCache : VK_NULL_HANDLE;
+}
+
 inline VkDescriptorSet get_descriptor_set() {
     auto* e = get_engine();
     return e ? e->descriptorSet : VK_NULL_HANDLE;
@@ -2830,6 +3446,13 @@ struct SDFSampler {
     size_t maxPoints = 0;
     std::string cachedShaderName;
     time_t cachedShaderModTime = 0;  // Track shader modification for hot reload
+    // CPU backend (sdf_cpu.hpp): sample_sdf_* evaluate this tape instead of
+    // dispatching sdf_sampler.comp when preferCpu is set or there is no device
+    std::shared_ptr<const sdfcpu::Tape> cpuScene;
+    uint64_t cpuSceneVersion = 0;  // Bumped by every set_cpu_scene / clear_cpu_scene
+    std::string cpuSceneShader;    // Shader whose sceneSDF cpuScene translates ("" = set by hand)
+    bool preferCpu = false;
+    bool sceneAnimated = false;  // Extracted sceneSDF reads the time (ubo.resolution.z)
 };
 
 inline SDFSampler* g_sampler = nullptr;
@@ -2841,6 +3464,18 @@ inline SDFSampler* get_sampler() {
     return g_sampler;
 }
 
+// True when sampling should go through the CPU evaluator
+inline bool use_cpu_sampler() {
+    auto* s = get_sampler();
+    auto* e = get_engine();
+    return s->cpuScene && (s->preferCpu || !e || !e->initialized);
+}
+
+inline float sampler_time() {
+    auto* e = get_engine();
+    return e ? e->time : 0.0f;
+}
+
 // Extract sceneSDF function and its dependencies from a shader source
 inline std::string extract_scene_sdf(const std::string& shaderSource) {
     std::string result;
@@ -2889,8 +3524,9 @@ inline std::string extract_scene_sdf(const std::string& shaderSource) {
     return helpers + "\n" + sceneSdf;
 }
 
-// Build the sampler shader from template and current scene
-inline std::string build_sampler_shader(const std::string& sceneShaderPath) {
+// Build the sampler shader from template and current scene. animated
+// (optional) is set when the scene code reads the time.
+inline std::string build_sampler_shader(const std::string& sceneShaderPath, bool* animated = nullptr) {
     std::string templatePath = sceneShaderPath.substr(0, sceneShaderPath.rfind('/')) + "/sdf_sampler.comp";
     std::string templateSrc = read_text_file(templatePath);
     if (templateSrc.empty()) {
@@ -2909,6 +3545,7 @@ inline std::string build_sampler_shader(const std::string& sceneShaderPath) {
         std::cerr << "Could not extract sceneSDF from shader" << std::endl;
         return "";
     }
+    if (animated) *animated = sceneCode.find("resolution.z") != std::string::npos;
 
     size_t markerStart = templateSrc.find("// MARKER_SCENE_SDF_START");
     size_t markerEnd = templateSrc.find("// MARKER_SCENE_SDF_END");
@@ -2973,7 +3610,7 @@ inline bool init_sampler(size_t numPoints) {
 
     std::cout << "Initializing SDF sampler for " << numPoints << " points..." << std::endl;
 
-    std::string samplerSrc = build_sampler_shader(shaderPath);
+    std::string samplerSrc = build_sampler_shader(shaderPath, &s->sceneAnimated);
     if (samplerSrc.empty()) {
         return false;
     }
@@ -2997,8 +3634,9 @@ inline bool init_sampler(size_t numPoints) {
     // MEMORY OPTIMIZED: No more input buffer - positions computed in shader!
     // Only need output buffer for distances and params buffer for grid parameters
     VkDeviceSize outputSize = numPoints * sizeof(float);
-    // Params: resolution(uint) + time(float) + minXYZ(3 floats) + maxXYZ(3 floats) = 32 bytes
-    VkDeviceSize paramsSize = 32;
+    // Params: resolution(uint) + time(float) + minXYZ(3 floats) + maxXYZ(3 floats)
+    //         + zStart(uint) + zCount(uint) = 40 bytes, padded to 48
+    VkDeviceSize paramsSize = 48;
 
     VkBufferCreateInfo bufferInfo{};
     bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
@@ -3120,36 +3758,23 @@ inline bool init_sampler(size_t numPoints) {
     return true;
 }
 
-// Sample a single region of SDF grid (used by hierarchical sampler)
-inline bool sample_sdf_region(
-    std::vector<float>& output,
-    float minX, float minY, float minZ,
-    float maxX, float maxY, float maxZ,
-    int res,
-    size_t outputOffset = 0) {
+// Parameters of the sampler compute shader: resolution(uint), time(float),
+// minXYZ(3 floats), maxXYZ(3 floats), zStart, zCount (zCount 0 = all slices)
+struct SamplerParams {
+    uint32_t resolution;
+    float time;
+    float minX, minY, minZ;
+    float maxX, maxY, maxZ;
+    uint32_t zStart, zCount;
+};
 
+// Run the sampler shader over totalPoints grid points and read them back
+// into out; false if the submit fails. The sampler must already be
+// initialized for totalPoints.
+inline bool dispatch_sampler(const SamplerParams& params, size_t totalPoints, float* out) {
     auto* s = get_sampler();
     auto* e = get_engine();
 
-    size_t totalPoints = static_cast<size_t>(res) * res * res;
-    if (totalPoints == 0) return false;
-
-    if (!init_sampler(totalPoints)) {
-        return false;
-    }
-
-    struct SamplerParams {
-        uint32_t resolution;
-        float time;
-        float minX, minY, minZ;
-        float maxX, maxY, maxZ;
-    } params = {
-        static_cast<uint32_t>(res),
-        e->time,
-        minX, minY, minZ,
-        maxX, maxY, maxZ
-    };
-
     void* data;
     vkMapMemory(e->device, s->paramsMemory, 0, sizeof(params), 0, &data);
     memcpy(data, &params, sizeof(params));
@@ -3193,21 +3818,55 @@ inline bool sample_sdf_region(
     submitInfo.commandBufferCount = 1;
     submitInfo.pCommandBuffers = &cmdBuffer;
 
-    vkQueueSubmit(e->graphicsQueue, 1, &submitInfo, VK_NULL_HANDLE);
-    vkQueueWaitIdle(e->graphicsQueue);
+    bool ok = vkQueueSubmit(e->graphicsQueue, 1, &submitInfo, VK_NULL_HANDLE) == VK_SUCCESS &&
+              vkQueueWaitIdle(e->graphicsQueue) == VK_SUCCESS;
 
     vkFreeCommandBuffers(e->device, e->commandPool, 1, &cmdBuffer);
+    if (!ok) return false;
 
-    // Read back results directly to output at offset
     vkMapMemory(e->device, s->outputMemory, 0, totalPoints * sizeof(float), 0, &data);
-    memcpy(output.data() + outputOffset, data, totalPoints * sizeof(float));
+    memcpy(out, data, totalPoints * sizeof(float));
     vkUnmapMemory(e->device, s->outputMemory);
-
     return true;
 }
 
+// Sample a single region of SDF grid (used by hierarchical sampler)
+inline bool sample_sdf_region(
+    std::vector<float>& output,
+    float minX, float minY, float minZ,
+    float maxX, float maxY, float maxZ,
+    int res,
+    size_t outputOffset = 0) {
+
+    auto* s = get_sampler();
+    auto* e = get_engine();
+
+    size_t totalPoints = static_cast<size_t>(res) * res * res;
+    if (totalPoints == 0) return false;
+
+    if (use_cpu_sampler()) {
+        return sdfcpu::sampleSlices(*s->cpuScene, output.data() + outputOffset, res,
+                                    {minX, minY, minZ}, {maxX, maxY, maxZ}, 0, res, sampler_time());
+    }
+
+    if (!init_sampler(totalPoints)) {
+        return false;
+    }
+
+    SamplerParams params = {
+        static_cast<uint32_t>(res),
+        e->time,
+        minX, minY, minZ,
+        maxX, maxY, maxZ,
+        0, 0
+    };
+    return dispatch_sampler(params, totalPoints, output.data() + outputOffset);
+}
+
 // Hierarchical SDF sampling - coarse pass to find surface, batched fine pass
-// Uses super-cell batching to minimize GPU dispatch count
+// Uses super-cell batching to minimize GPU dispatch count. A CPU scene skips
+// the coarse pass and its distance heuristic: interval culling
+// (sdfcpu::sampleGridCulled) samples only the bricks that may hold the band.
 inline std::vector<float> sample_sdf_grid_hierarchical(
     float minX, float minY, float minZ,
     float maxX, float maxY, float maxZ,
@@ -3216,6 +3875,16 @@ inline std::vector<float> sample_sdf_grid_hierarchical(
     auto* e = get_engine();
     auto start = std::chrono::high_resolution_clock::now();
 
+    if (use_cpu_sampler()) {
+        float bandCells = mc::BRICK_BAND_CELLS * (e ? e->meshSdfLipschitz : 1.0f);
+        std::vector<float> fine = sdfcpu::sampleGridCulled(*get_sampler()->cpuScene, fineRes, {minX, minY, minZ},
+                                                           {maxX, maxY, maxZ}, sampler_time(), bandCells);
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << "SDF sampling (hierarchical, CPU interval culling) completed in "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+        return fine;
+    }
+
     // Use coarser grid (1/16 of fine) for faster initial pass
     // Then batch into super-cells (4x4x4 coarse cells = 64x64x64 fine cells per batch)
     int coarseRes = std::max(16, fineRes / 16);  // 1024 -> 64
@@ -3241,7 +3910,7 @@ inline std::vector<float> sample_sdf_grid_hierarchical(
     float stepY = (maxY - minY) / float(coarseRes - 1);
     float stepZ = (maxZ - minZ) / float(coarseRes - 1);
     float cellDiagonal = std::sqrt(stepX*stepX + stepY*stepY + stepZ*stepZ);
-    float threshold = cellDiagonal * 2.0f;
+    float threshold = cellDiagonal * 2.0f * (e ? e->meshSdfLipschitz : 1.0f);
 
     int coarseCellRes = coarseRes - 1;
     int superCellRes = (coarseCellRes + superCellSize - 1) / superCellSize;
@@ -3405,6 +4074,16 @@ inline std::vector<float> sample_sdf_grid(
     //     return sample_sdf_grid_hierarchical(minX, minY, minZ, maxX, maxY, maxZ, res);
     // }
 
+    if (use_cpu_sampler()) {
+        std::cout << "Sampling " << totalPoints << " SDF points on CPU..." << std::endl;
+        auto start = std::chrono::high_resolution_clock::now();
+        auto results = sdfcpu::sampleGrid(*s->cpuScene, res, {minX, minY, minZ}, {maxX, maxY, maxZ}, sampler_time());
+        auto end = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+        std::cout << "SDF sampling (CPU) completed in " << duration.count() << " ms" << std::endl;
+        return results;
+    }
+
     std::cout << "Sampling " << totalPoints << " SDF points on GPU (memory optimized)..." << std::endl;
     auto start = std::chrono::high_resolution_clock::now();
 
@@ -3413,80 +4092,173 @@ inline std::vector<float> sample_sdf_grid(
         return {};
     }
 
-    // Upload grid parameters to uniform buffer (no positions buffer needed!)
-    // Struct matches shader: resolution(uint), time(float), minXYZ(3 floats), maxXYZ(3 floats)
-    struct SamplerParams {
-        uint32_t resolution;
-        float time;
-        float minX, minY, minZ;
-        float maxX, maxY, maxZ;
-    } params = {
+    // Grid positions are computed in the shader (no positions buffer needed!)
+    SamplerParams params = {
         static_cast<uint32_t>(res),
         e->time,
         minX, minY, minZ,
-        maxX, maxY, maxZ
+        maxX, maxY, maxZ,
+        0, 0
     };
+    std::vector<float> results(totalPoints);
+    if (!dispatch_sampler(params, totalPoints, results.data())) return {};
 
-    void* data;
-    vkMapMemory(e->device, s->paramsMemory, 0, sizeof(params), 0, &data);
-    memcpy(data, &params, sizeof(params));
-    vkUnmapMemory(e->device, s->paramsMemory);
-
-    // Execute compute shader
-    VkCommandBufferAllocateInfo cmdAllocInfo{};
-    cmdAllocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-    cmdAllocInfo.commandPool = e->commandPool;
-    cmdAllocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-    cmdAllocInfo.commandBufferCount = 1;
+    auto end = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+    std::cout << "SDF sampling completed in " << duration.count() << " ms" << std::endl;
 
-    VkCommandBuffer cmdBuffer;
-    vkAllocateCommandBuffers(e->device, &cmdAllocInfo, &cmdBuffer);
+    return results;
+}
 
-    VkCommandBufferBeginInfo beginInfo{};
-    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-    vkBeginCommandBuffer(cmdBuffer, &beginInfo);
+// Sample zCount consecutive Z slices [zStart, zStart+zCount) of the res³ grid
+// into out (res*res*zCount floats). Used by slab-streaming marching cubes so
+// the full grid never has to be resident on the host.
+inline bool sample_sdf_slices(
+    float* out,
+    float minX, float minY, float minZ,
+    float maxX, float maxY, float maxZ,
+    int res, int zStart, int zCount) {
 
-    vkCmdBindPipeline(cmdBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, s->pipeline);
-    vkCmdBindDescriptorSets(cmdBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
-                            s->pipelineLayout, 0, 1, &s->descriptorSet, 0, nullptr);
+    auto* s = get_sampler();
+    auto* e = get_engine();
 
-    uint32_t groupCount = (static_cast<uint32_t>(totalPoints) + 63) / 64;
-    vkCmdDispatch(cmdBuffer, groupCount, 1, 1);
+    size_t totalPoints = static_cast<size_t>(res) * res * zCount;
+    if (totalPoints == 0) return false;
 
-    VkMemoryBarrier barrier{};
-    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
-    barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
-    barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    if (use_cpu_sampler()) {
+        return sdfcpu::sampleSlices(*s->cpuScene, out, res, {minX, minY, minZ}, {maxX, maxY, maxZ},
+                                    zStart, zCount, sampler_time());
+    }
 
-    vkCmdPipelineBarrier(cmdBuffer,
-        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
-        VK_PIPELINE_STAGE_HOST_BIT,
-        0, 1, &barrier, 0, nullptr, 0, nullptr);
+    if (!init_sampler(totalPoints)) {
+        return false;
+    }
 
-    vkEndCommandBuffer(cmdBuffer);
+    SamplerParams params = {
+        static_cast<uint32_t>(res),
+        e->time,
+        minX, minY, minZ,
+        maxX, maxY, maxZ,
+        static_cast<uint32_t>(zStart), static_cast<uint32_t>(zCount)
+    };
+    return dispatch_sampler(params, totalPoints, out);
+}
 
-    VkSubmitInfo submitInfo{};
-    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-    submitInfo.commandBufferCount = 1;
-    submitInfo.pCommandBuffers = &cmdBuffer;
+// Sample grid points [lo, lo + dims) of the res³ grid spanning [min, max]
+// into out (x fastest). The CPU backend samples the box exactly; the GPU
+// sampler only takes cubes, so it samples the enclosing cube on the grid's
+// spacing and keeps the box's part.
+inline bool sample_sdf_box(
+    float* out,
+    float minX, float minY, float minZ,
+    float maxX, float maxY, float maxZ,
+    int res, const int lo[3], const int dims[3]) {
+
+    if (use_cpu_sampler()) {
+        return sdfcpu::sampleBox(*get_sampler()->cpuScene, out, res, {minX, minY, minZ}, {maxX, maxY, maxZ},
+                                 lo, dims, sampler_time());
+    }
+
+    mc::Vec3 step((maxX - minX) / (res - 1), (maxY - minY) / (res - 1), (maxZ - minZ) / (res - 1));
+    int side = std::max({dims[0], dims[1], dims[2]});
+    std::vector<float> cube((size_t)side * side * side);
+    mc::Vec3 p0(minX + lo[0] * step.x, minY + lo[1] * step.y, minZ + lo[2] * step.z);
+    mc::Vec3 p1(p0.x + (side - 1) * step.x, p0.y + (side - 1) * step.y, p0.z + (side - 1) * step.z);
+    if (!sample_sdf_region(cube, p0.x, p0.y, p0.z, p1.x, p1.y, p1.z, side)) return false;
+    for (int z = 0; z < dims[2]; z++) {
+        for (int y = 0; y < dims[1]; y++) {
+            memcpy(out, &cube[((size_t)z * side + y) * side], dims[0] * sizeof(float));
+            out += dims[0];
+        }
+    }
+    return true;
+}
 
-    vkQueueSubmit(e->graphicsQueue, 1, &submitInfo, VK_NULL_HANDLE);
-    vkQueueWaitIdle(e->graphicsQueue);
+// Sample the res³ grid as a narrow-band brick map: one dispatch over the
+// brick centres, then one 64³ dispatch per group of bricks near the surface.
+// Host memory is the brick table plus the kept bricks, so 2048³ fits where
+// the dense grid (32GB) would not. With a CPU scene the centre pass is
+// replaced by interval culling (see sdfcpu::cullBricks for what it proves).
+inline mc::BrickMap sample_sdf_bricks(
+    float minX, float minY, float minZ,
+    float maxX, float maxY, float maxZ,
+    int res,
+    float bandCells = mc::BRICK_BAND_CELLS) {
 
-    vkFreeCommandBuffers(e->device, e->commandPool, 1, &cmdBuffer);
+    // Culling is exact for 1-Lipschitz SDFs; steeper scenes (ellipsoids,
+    // non-uniform scales) need the band and the centre reach widened
+    auto* e = get_engine();
+    float lipschitz = e ? e->meshSdfLipschitz : 1.0f;
+    bandCells *= lipschitz;
 
-    // Read back results
-    std::vector<float> results(totalPoints);
-    vkMapMemory(e->device, s->outputMemory, 0, totalPoints * sizeof(float), 0, &data);
-    memcpy(results.data(), data, totalPoints * sizeof(float));
-    vkUnmapMemory(e->device, s->outputMemory);
+    if (use_cpu_sampler()) {
+        return sdfcpu::sampleBricks(*get_sampler()->cpuScene, res, {minX, minY, minZ}, {maxX, maxY, maxZ},
+                                    sampler_time(), bandCells);
+    }
+
+    mc::BrickMap layout;
+    layout.reset(res, {minX, minY, minZ}, {maxX, maxY, maxZ}, bandCells);
+    if (!layout.valid()) return layout;
+
+    int nb = layout.bricksPerAxis;
+    mc::Vec3 c0 = layout.centerMin(), c1 = layout.centerMax();
+    std::vector<float> centers((size_t)nb * nb * nb);
+    if (!sample_sdf_region(centers, c0.x, c0.y, c0.z, c1.x, c1.y, c1.z, nb)) {
+        std::cerr << "Brick centre sampling failed" << std::endl;
+        return mc::BrickMap();
+    }
+
+    return mc::buildBrickMap(res, layout.boundsMin, layout.boundsMax, centers,
+        [&](const int lo[3], const int dims[3], float* dst) {
+            return sample_sdf_box(dst, minX, minY, minZ, maxX, maxY, maxZ, res, lo, dims);
+        }, bandCells, lipschitz);
+}
+
+// Number of Z slices sampled per GPU dispatch when streaming (64 slices of a
+// 1024² plane = 256MB staging instead of 4GB for the full grid)
+constexpr int GPU_STREAM_SLICES = 64;
+
+// Slab-streaming marching cubes: samples GPU_STREAM_SLICES slices at a time
+// and feeds them to mc::generateMeshStreaming, so host memory stays O(res²)
+// regardless of resolution. Output is welded.
+inline mc::Mesh generate_mesh_streaming(
+    int resolution,
+    float minX, float minY, float minZ,
+    float maxX, float maxY, float maxZ,
+    float isolevel = 0.0f) {
+
+    auto start = std::chrono::high_resolution_clock::now();
+    std::cout << "Streaming marching cubes at " << resolution << "³ ("
+              << GPU_STREAM_SLICES << " slices per dispatch)..." << std::endl;
+
+    size_t sliceSize = static_cast<size_t>(resolution) * resolution;
+    std::vector<float> batch;
+    int batchStart = 0;
+    int batchCount = 0;
+
+    auto fetchSlice = [&](int z, float* dst) -> bool {
+        if (z >= batchStart + batchCount) {
+            batchStart = z;
+            batchCount = std::min(GPU_STREAM_SLICES, resolution - z);
+            batch.resize(sliceSize * batchCount);
+            if (!sample_sdf_slices(batch.data(), minX, minY, minZ, maxX, maxY, maxZ,
+                                   resolution, batchStart, batchCount)) {
+                return false;
+            }
+        }
+        memcpy(dst, batch.data() + (z - batchStart) * sliceSize, sliceSize * sizeof(float));
+        return true;
+    };
+
+    mc::Vec3 bmin(minX, minY, minZ);
+    mc::Vec3 bmax(maxX, maxY, maxZ);
+    mc::Mesh mesh = mc::generateMeshStreaming(fetchSlice, resolution, bmin, bmax, isolevel);
 
     auto end = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
-    std::cout << "SDF sampling completed in " << duration.count() << " ms" << std::endl;
-
-    return results;
+    std::cout << "Streaming mesh: " << mesh.vertices.size() << " vertices, "
+              << mesh.indices.size() / 3 << " triangles in " << duration.count() << " ms" << std::endl;
+    return mesh;
 }
 
 // ============================================================================
@@ -4051,6 +4823,15 @@ inline bool init_dc_pipeline(int resolution, bool cubesOnly = false) {
 // Constants for chunked processing
 constexpr int GPU_DC_CHUNK_SIZE = 512;  // Process in 512³ chunks (larger = fewer chunks, less overhead)
 
+// Weld duplicate and seam vertices and keep the manifold check for the UI
+// (when meshRepairSeams). chunkFirstVertex marks where each merged chunk's
+// vertices start, for per-chunk seam statistics.
+inline void repair_mesh_seams(mc::Mesh& mesh, const std::vector<uint32_t>& chunkFirstVertex = {}) {
+    auto* e = get_engine();
+    if (!e || !e->meshRepairSeams || mesh.vertices.empty()) return;
+    e->meshManifold = mc::repairMesh(mesh, 0.0f, chunkFirstVertex).manifold;
+}
+
 // Process a single chunk of the SDF grid
 // chunkX/Y/Z are in chunk coordinates (0, 1, 2, ...)
 // Returns partial mesh for this chunk
@@ -4310,6 +5091,11 @@ inline mc::Mesh generate_mesh_cubes_gpu(
     float voxelSize,
     float isolevel);
 
+// GPU DC unless adaptive (octree) DC is requested, which only exists on the CPU
+inline bool use_gpu_dc(const Engine* e) {
+    return e->meshUseGpuDC && (e->meshFillWithCubes || e->meshDCSimplify <= 0.0f);
+}
+
 // Chunked GPU DC mesh generation - supports any resolution
 inline mc::Mesh generate_mesh_dc_gpu_chunked(
     const std::vector<float>& distances,
@@ -4350,6 +5136,7 @@ inline mc::Mesh generate_mesh_dc_gpu_chunked(
     std::cout << "GPU DC chunked: processing " << totalChunks << " chunks ("
               << numChunksX << "x" << numChunksY << "x" << numChunksZ << ")..." << std::endl;
 
+    std::vector<uint32_t> chunkFirstVertex;
     for (int cz = 0; cz < numChunksZ; cz++) {
         for (int cy = 0; cy < numChunksY; cy++) {
             for (int cx = 0; cx < numChunksX; cx++) {
@@ -4364,6 +5151,7 @@ inline mc::Mesh generate_mesh_dc_gpu_chunked(
 
                 // Offset indices for merged mesh
                 uint32_t vertexOffset = (uint32_t)finalMesh.vertices.size();
+                chunkFirstVertex.push_back(vertexOffset);
                 for (auto& idx : chunkMesh.indices) {
                     idx += vertexOffset;
                 }
@@ -4376,6 +5164,7 @@ inline mc::Mesh generate_mesh_dc_gpu_chunked(
             }
         }
     }
+    repair_mesh_seams(finalMesh, chunkFirstVertex);
 
     auto dcEnd = std::chrono::high_resolution_clock::now();
     auto dcDuration = std::chrono::duration_cast<std::chrono::milliseconds>(dcEnd - dcStart);
@@ -4387,9 +5176,12 @@ inline mc::Mesh generate_mesh_dc_gpu_chunked(
     return finalMesh;
 }
 
+// Cells per axis of one DC region in generate_mesh_sparse_streaming
+constexpr int SPARSE_REGION_CELLS = 4 * mc::BRICK_SIZE;
+
 // Streaming sparse mesh generation - avoids 4GB allocation by processing regions incrementally
-// 1. Coarse sample to find surface regions
-// 2. For each surface region: fine sample + DC + merge
+// 1. Sample a narrow-band brick map (sample_sdf_bricks)
+// 2. For each region holding kept bricks: extract its grid + DC + merge
 inline mc::Mesh generate_mesh_sparse_streaming(
     int resolution,
     float minX, float minY, float minZ,
@@ -4404,134 +5196,73 @@ inline mc::Mesh generate_mesh_sparse_streaming(
     auto* e = get_engine();
     if (!e || !e->initialized) return finalMesh;
 
-    // Step 1: Coarse sampling to find surface regions
-    // Use higher coarse resolution for better surface detection
-    int coarseRes = std::max(64, resolution / 8);  // 1024 -> 128
-    int superCellSize = 4;  // 4x4x4 coarse cells per super-cell
-
-    auto coarseStart = std::chrono::high_resolution_clock::now();
-    std::vector<float> coarseDistances = sample_sdf_grid(minX, minY, minZ, maxX, maxY, maxZ, coarseRes, false);
-    auto coarseEnd = std::chrono::high_resolution_clock::now();
-    auto coarseDuration = std::chrono::duration_cast<std::chrono::milliseconds>(coarseEnd - coarseStart);
+    // Step 1: Brick map - only the band around the surface is sampled and kept
+    auto bricksStart = std::chrono::high_resolution_clock::now();
+    mc::BrickMap bricks = sample_sdf_bricks(minX, minY, minZ, maxX, maxY, maxZ, resolution);
+    auto bricksEnd = std::chrono::high_resolution_clock::now();
+    auto bricksDuration = std::chrono::duration_cast<std::chrono::milliseconds>(bricksEnd - bricksStart);
 
-    if (coarseDistances.empty()) {
-        std::cerr << "Coarse sampling failed" << std::endl;
+    if (!bricks.valid()) {
+        std::cerr << "Brick map sampling failed" << std::endl;
         return finalMesh;
     }
 
-    // Step 2: Find super-cells containing surface
-    // Threshold based on coarse cell diagonal - be generous to capture all surface regions
-    float coarseStep = (maxX - minX) / float(coarseRes - 1);
-    float coarseCellDiag = std::sqrt(3.0f) * coarseStep;  // Diagonal of coarse cell
-    // Use super-cell diagonal as threshold since surface can be anywhere in the super-cell
-    float superCellDiag = coarseCellDiag * superCellSize;  // 4 coarse cells diagonal
-    float threshold = superCellDiag;
-
-    int coarseCellRes = coarseRes - 1;
-    int superCellRes = (coarseCellRes + superCellSize - 1) / superCellSize;
-
-    std::vector<std::tuple<int,int,int>> surfaceSuperCells;
-
-    for (int scz = 0; scz < superCellRes; scz++) {
-        for (int scy = 0; scy < superCellRes; scy++) {
-            for (int scx = 0; scx < superCellRes; scx++) {
+    // Step 2: Regions of SPARSE_REGION_CELLS³ cells that hold a kept brick.
+    // Every corner of a crossing cell is in the band, so the rest are empty.
+    const int regionBricks = SPARSE_REGION_CELLS / mc::BRICK_SIZE;
+    int regionsPerAxis = (bricks.bricksPerAxis + regionBricks - 1) / regionBricks;
+    std::vector<std::tuple<int,int,int>> surfaceRegions;
+    for (int rz = 0; rz < regionsPerAxis; rz++) {
+        for (int ry = 0; ry < regionsPerAxis; ry++) {
+            for (int rx = 0; rx < regionsPerAxis; rx++) {
                 bool hasSurface = false;
-
-                for (int lcz = 0; lcz < superCellSize && !hasSurface; lcz++) {
-                    for (int lcy = 0; lcy < superCellSize && !hasSurface; lcy++) {
-                        for (int lcx = 0; lcx < superCellSize && !hasSurface; lcx++) {
-                            int cx = scx * superCellSize + lcx;
-                            int cy = scy * superCellSize + lcy;
-                            int cz = scz * superCellSize + lcz;
-                            if (cx >= coarseCellRes || cy >= coarseCellRes || cz >= coarseCellRes) continue;
-
-                            // Check for sign change at cell corners (actual surface crossing)
-                            float minVal = std::numeric_limits<float>::max();
-                            float maxVal = std::numeric_limits<float>::lowest();
-                            for (int dz = 0; dz <= 1; dz++) {
-                                for (int dy = 0; dy <= 1; dy++) {
-                                    for (int dx = 0; dx <= 1; dx++) {
-                                        int ix = cx + dx;
-                                        int iy = cy + dy;
-                                        int iz = cz + dz;
-                                        size_t idx = ix + iy * coarseRes + iz * coarseRes * coarseRes;
-                                        float d = coarseDistances[idx];
-                                        minVal = std::min(minVal, d);
-                                        maxVal = std::max(maxVal, d);
-                                    }
-                                }
-                            }
-                            // Has surface if there's a sign change (surface crossing)
-                            if (minVal <= 0 && maxVal >= 0) {
-                                hasSurface = true;
-                            }
-                        }
-                    }
-                }
-
+                for (int bz = rz * regionBricks; bz < std::min((rz + 1) * regionBricks, bricks.bricksPerAxis) && !hasSurface; bz++)
+                    for (int by = ry * regionBricks; by < std::min((ry + 1) * regionBricks, bricks.bricksPerAxis) && !hasSurface; by++)
+                        for (int bx = rx * regionBricks; bx < std::min((rx + 1) * regionBricks, bricks.bricksPerAxis) && !hasSurface; bx++)
+                            hasSurface = bricks.table[bricks.brickIndex(bx, by, bz)] >= 0;
                 if (hasSurface) {
-                    surfaceSuperCells.push_back({scx, scy, scz});
+                    surfaceRegions.push_back({rx, ry, rz});
                 }
             }
         }
     }
 
-    std::cout << "Sparse streaming: " << surfaceSuperCells.size() << " surface regions, "
-              << "coarse " << coarseRes << "³ (" << coarseDuration.count() << " ms)" << std::endl;
+    std::cout << "Sparse streaming: " << surfaceRegions.size() << " surface regions, "
+              << bricks.brickCount() << " bricks (" << bricks.byteSize() / (1024 * 1024) << " MB, "
+              << bricksDuration.count() << " ms)" << std::endl;
 
-    if (surfaceSuperCells.empty()) return finalMesh;
+    if (surfaceRegions.empty()) return finalMesh;
 
-    // Step 3: Process each super-cell: sample fine + DC + merge
-    int finePerCoarse = resolution / coarseRes;
-    int finePerSuperCell = finePerCoarse * superCellSize;
+    // Step 3: Process each region: extract from the brick map + DC + merge.
+    // Regions are cubes on the global grid spacing; points past the grid read
+    // as outside, which closes surfaces that leave the bounds.
+    const int localRes = SPARSE_REGION_CELLS + 1;
+    std::vector<float> localDistances((size_t)localRes * localRes * localRes);
 
     auto processStart = std::chrono::high_resolution_clock::now();
     int processedRegions = 0;
+    std::vector<uint32_t> regionFirstVertex;
 
-    for (const auto& [scx, scy, scz] : surfaceSuperCells) {
-        // Compute fine grid bounds for this super-cell
-        int fineX0 = scx * finePerSuperCell;
-        int fineY0 = scy * finePerSuperCell;
-        int fineZ0 = scz * finePerSuperCell;
-        int fineX1 = std::min((scx + 1) * finePerSuperCell + 1, resolution);
-        int fineY1 = std::min((scy + 1) * finePerSuperCell + 1, resolution);
-        int fineZ1 = std::min((scz + 1) * finePerSuperCell + 1, resolution);
-
-        int localRes = std::max({fineX1 - fineX0, fineY1 - fineY0, fineZ1 - fineZ0});
+    for (const auto& [rx, ry, rz] : surfaceRegions) {
+        int lo[3] = {rx * SPARSE_REGION_CELLS, ry * SPARSE_REGION_CELLS, rz * SPARSE_REGION_CELLS};
+        int dims[3] = {localRes, localRes, localRes};
+        bricks.extract(lo, dims, localDistances.data());
 
-        // Compute world bounds for this region
-        float localMinX = minX + fineX0 * (maxX - minX) / float(resolution - 1);
-        float localMinY = minY + fineY0 * (maxY - minY) / float(resolution - 1);
-        float localMinZ = minZ + fineZ0 * (maxZ - minZ) / float(resolution - 1);
-        float localMaxX = minX + (fineX1 - 1) * (maxX - minX) / float(resolution - 1);
-        float localMaxY = minY + (fineY1 - 1) * (maxY - minY) / float(resolution - 1);
-        float localMaxZ = minZ + (fineZ1 - 1) * (maxZ - minZ) / float(resolution - 1);
-
-        // Sample this region
-        std::vector<float> localDistances = sample_sdf_grid(localMinX, localMinY, localMinZ,
-                                                            localMaxX, localMaxY, localMaxZ, localRes, false);
-        if (localDistances.empty()) continue;
+        float localMinX = minX + lo[0] * bricks.cellSize.x;
+        float localMinY = minY + lo[1] * bricks.cellSize.y;
+        float localMinZ = minZ + lo[2] * bricks.cellSize.z;
+        float localMaxX = localMinX + SPARSE_REGION_CELLS * bricks.cellSize.x;
+        float localMaxY = localMinY + SPARSE_REGION_CELLS * bricks.cellSize.y;
+        float localMaxZ = localMinZ + SPARSE_REGION_CELLS * bricks.cellSize.z;
 
         // Run DC on this region
         mc::Mesh localMesh;
         try {
             if (fillWithCubes) {
-                // Adjust voxel size to maintain consistent cube size across global resolution
-                // Local cell size is larger than global, so scale voxelSize down
-                float globalCellSize = (maxX - minX) / float(resolution - 1);
-                float localCellSize = (localMaxX - localMinX) / float(localRes - 1);
-                float adjustedVoxelSize = voxelSize * (globalCellSize / localCellSize);
-
-                if (processedRegions == 0) {
-                    std::cout << "  Voxel size adjustment: global=" << globalCellSize
-                              << " local=" << localCellSize
-                              << " ratio=" << (globalCellSize/localCellSize)
-                              << " adjusted=" << adjustedVoxelSize << std::endl;
-                }
-
+                // Regions share the global cell size, so voxelSize applies as is
                 localMesh = generate_mesh_cubes_gpu(localDistances, localRes,
                     localMinX, localMinY, localMinZ, localMaxX, localMaxY, localMaxZ,
-                    adjustedVoxelSize, isolevel);
+                    voxelSize, isolevel);
             } else {
                 localMesh = generate_mesh_dc_gpu(localDistances, localRes,
                     localMinX, localMinY, localMinZ, localMaxX, localMaxY, localMaxZ,
@@ -4546,6 +5277,7 @@ inline mc::Mesh generate_mesh_sparse_streaming(
 
         // Offset indices and merge
         uint32_t vertexOffset = (uint32_t)finalMesh.vertices.size();
+        regionFirstVertex.push_back(vertexOffset);
         for (auto& idx : localMesh.indices) {
             idx += vertexOffset;
         }
@@ -4557,6 +5289,7 @@ inline mc::Mesh generate_mesh_sparse_streaming(
 
         processedRegions++;
     }
+    repair_mesh_seams(finalMesh, regionFirstVertex);
 
     auto processEnd = std::chrono::high_resolution_clock::now();
     auto processDuration = std::chrono::duration_cast<std::chrono::milliseconds>(processEnd - processStart);
@@ -5472,6 +6205,55 @@ inline std::vector<mc::Color3> sample_vertex_colors(const mc::Mesh& mesh) {
     return colors;
 }
 
+// Simplified copy of mesh per the export settings (meshExportDetail,
+// meshExportMaxError), or the mesh itself when simplification is off
+inline mc::Mesh simplify_export_mesh(const mc::Mesh& mesh) {
+    auto* e = get_engine();
+    if (!e || (e->meshExportDetail >= 1.0f && e->meshExportMaxError <= 0.0f)) return mesh;
+    size_t target = (size_t)((double)(mesh.indices.size() / 3) * std::min(1.0f, e->meshExportDetail));
+    float maxError = e->meshExportMaxError > 0.0f ? e->meshExportMaxError : FLT_MAX;
+    return mc::simplifyMesh(mesh, target, maxError);
+}
+
+// Write mesh in the format picked by the file extension:
+// .glb/.gltf, .stl and .ply (binary), anything else as OBJ
+inline bool write_mesh_file(const char* filepath, const mc::Mesh& mesh,
+                            bool includeColors, bool includeUVs, const char*& error) {
+    auto* e = get_engine();
+    std::string path(filepath);
+    auto hasExt = [&](const char* ext) {
+        size_t n = strlen(ext);
+        return path.size() > n && path.compare(path.size() - n, n, ext) == 0;
+    };
+
+    auto start = std::chrono::high_resolution_clock::now();
+    bool ok;
+    const char* format;
+    if (hasExt(".glb") || hasExt(".gltf")) {
+        format = "GLB";
+        error = "Failed to write GLB file";
+        ok = mc::exportGLB(filepath, mesh, includeColors, e && e->meshExportQuantized);
+    } else if (hasExt(".stl")) {
+        format = "STL";
+        error = "Failed to write STL file";
+        ok = mc::exportSTL(filepath, mesh);
+    } else if (hasExt(".ply")) {
+        format = "PLY";
+        error = "Failed to write PLY file";
+        ok = mc::exportPLY(filepath, mesh, includeColors);
+    } else {
+        format = "OBJ";
+        error = "Failed to write OBJ file";
+        ok = mc::exportOBJ(filepath, mesh, includeColors, includeUVs);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+    if (!ok) return false;
+    std::cout << "  Wrote " << format << " in " << duration.count() << " ms" << std::endl;
+    return true;
+}
+
 // Export current scene SDF to mesh using GPU sampling + CPU marching cubes
 // This is the main function - no code duplication!
 inline MeshExportResult export_scene_mesh_gpu(
@@ -5502,14 +6284,17 @@ inline MeshExportResult export_scene_mesh_gpu(
     mc::Vec3 bounds_min{minX, minY, minZ};
     mc::Vec3 bounds_max{maxX, maxY, maxZ};
 
-    if (e->meshUseDualContouring && e->meshUseGpuDC && resolution > 256) {
+    if (e->meshUseDualContouring && use_gpu_dc(e) && resolution > 256) {
         // Use sparse streaming for efficient high-res export
         mesh = generate_mesh_sparse_streaming(resolution,
             minX, minY, minZ, maxX, maxY, maxZ,
             e->meshFillWithCubes, e->meshVoxelSize, 0.0f);
+    } else if (!e->meshUseDualContouring && resolution > 256) {
+        // Slab-streaming MC keeps only a few Z slices on the host
+        mesh = generate_mesh_streaming(resolution, minX, minY, minZ, maxX, maxY, maxZ, 0.0f);
     }
 
-    // Fallback to standard approach if sparse streaming didn't produce results
+    // Fallback to standard approach if streaming didn't produce results
     if (mesh.vertices.empty()) {
         auto distances = sample_sdf_grid(minX, minY, minZ, maxX, maxY, maxZ, resolution);
         if (distances.empty()) {
@@ -5522,9 +6307,10 @@ inline MeshExportResult export_scene_mesh_gpu(
 
         if (e->meshUseDualContouring) {
             mesh = mc::generateMeshDC(distances, resolution, bounds_min, bounds_max, 0.0f,
-                                      e->meshFillWithCubes, e->meshVoxelSize);
+                                      e->meshFillWithCubes, e->meshVoxelSize, e->meshDCSimplify);
+            repair_mesh_seams(mesh);
         } else {
-            mesh = mc::generateMesh(distances, resolution, bounds_min, bounds_max);
+            mesh = mc::generateMesh(distances, resolution, bounds_min, bounds_max, 0.0f, true, nullptr, true);
         }
 
         auto end = std::chrono::high_resolution_clock::now();
@@ -5537,8 +6323,15 @@ inline MeshExportResult export_scene_mesh_gpu(
         return result;
     }
 
-    // Compute normals (always useful for rendering)
-    mc::computeNormals(mesh);
+    // Decimate before sampling colors so only the kept vertices are sampled
+    if (e->meshExportDetail < 1.0f || e->meshExportMaxError > 0.0f) {
+        mesh = simplify_export_mesh(mesh);
+    }
+
+    // Compute normals (always useful for rendering); CPU MC already has gradient normals
+    if (!mesh.hasNormals()) {
+        mc::computeNormals(mesh);
+    }
 
     // Compute UVs if requested
     if (includeUVs) {
@@ -5558,33 +6351,108 @@ inline MeshExportResult export_scene_mesh_gpu(
         }
     }
 
+    // Reorder for the GPU caches last, since it renumbers every attribute
+    if (e->meshOptimizeForGPU) {
+        mc::optimizeMeshForGPU(mesh);
+    }
+
     result.vertices = mesh.vertices.size();
     result.triangles = mesh.indices.size() / 3;
 
     // Export based on file extension
-    std::string path(filepath);
-    bool isGLB = path.size() > 4 && (path.substr(path.size() - 4) == ".glb" || path.substr(path.size() - 5) == ".gltf");
-
-    bool exportSuccess = false;
-    if (isGLB) {
-        exportSuccess = mc::exportGLB(filepath, mesh, includeColors);
-    } else {
-        exportSuccess = mc::exportOBJ(filepath, mesh, includeColors, includeUVs);
-    }
-
-    if (exportSuccess) {
+    if (write_mesh_file(filepath, mesh, includeColors, includeUVs, result.message)) {
         result.success = true;
         result.message = "Export successful";
         std::cout << "Exported to " << filepath << std::endl;
         std::cout << "  Vertices: " << result.vertices << std::endl;
         std::cout << "  Triangles: " << result.triangles << std::endl;
-    } else {
-        result.message = isGLB ? "Failed to write GLB file" : "Failed to write OBJ file";
     }
 
     return result;
 }
 
+// CPU sampler backend: scenes described with sdfcpu expressions are sampled
+// on the thread pool, which is what headless exports and CI runs use.
+inline void set_cpu_scene(const sdfcpu::Expr& scene) {
+    auto tape = std::make_shared<sdfcpu::Tape>(sdfcpu::compile(scene));
+    std::cout << "CPU SDF scene: " << tape->size() << " instructions" << std::endl;
+    get_sampler()->cpuScene = std::move(tape);
+    get_sampler()->cpuSceneVersion++;
+    get_sampler()->cpuSceneShader.clear();
+}
+
+inline void clear_cpu_scene() {
+    get_sampler()->cpuScene.reset();
+    get_sampler()->cpuSceneVersion++;
+    get_sampler()->cpuSceneShader.clear();
+}
+
+// CPU scene from a bundled shader's sceneSDF translation (sdf_cpu_scenes.hpp).
+// Returns false, leaving the CPU scene alone, when the shader has none.
+inline bool set_cpu_scene_for_shader(const std::string& name) {
+    sdfcpu::Expr scene;
+    mc::Vec3 bmin, bmax;
+    if (!sdfcpu::sceneForShader(name, scene, bmin, bmax)) return false;
+    set_cpu_scene(scene);
+    get_sampler()->cpuSceneShader = name;
+    return true;
+}
+
+// Keep the CPU scene on the current shader: its translation when there is
+// one, otherwise drop a translation left over from the previous shader.
+// Scenes set by hand with set_cpu_scene are kept.
+inline void sync_cpu_scene(Engine* e) {
+    auto* s = get_sampler();
+    if (s->cpuSceneShader == e->currentShaderName) return;
+    if (!set_cpu_scene_for_shader(e->currentShaderName) && !s->cpuSceneShader.empty()) {
+        clear_cpu_scene();
+    }
+}
+
+inline bool has_cpu_scene() {
+    return get_sampler()->cpuScene != nullptr;
+}
+
+// Route sampling through the CPU scene even when a Vulkan device exists
+inline void set_sampler_prefer_cpu(bool prefer) {
+    get_sampler()->preferCpu = prefer;
+}
+
+inline bool get_sampler_prefer_cpu() {
+    return get_sampler()->preferCpu;
+}
+
+// Headless export of the CPU scene: needs no engine, only set_cpu_scene
+inline MeshExportResult export_scene_mesh_cpu(
+    const char* filepath,
+    float minX, float minY, float minZ,
+    float maxX, float maxY, float maxZ,
+    int resolution
+) {
+    MeshExportResult result{false, 0, 0, ""};
+    auto* s = get_sampler();
+    if (!s->cpuScene) {
+        result.message = "No CPU scene set";
+        return result;
+    }
+
+    mc::Mesh mesh = sdfcpu::meshScene(*s->cpuScene, resolution,
+        {minX, minY, minZ}, {maxX, maxY, maxZ}, sampler_time());
+    if (mesh.vertices.empty()) {
+        result.message = "No surface found in bounds";
+        return result;
+    }
+
+    result.vertices = mesh.vertices.size();
+    result.triangles = mesh.indices.size() / 3;
+    if (write_mesh_file(filepath, mesh, false, false, result.message)) {
+        result.success = true;
+        result.message = "Export successful";
+        std::cout << "Exported to " << filepath << std::endl;
+    }
+    return result;
+}
+
 // Convenience wrapper with default bounds
 // Convenience wrapper - uses stored mesh if available at matching resolution
 inline MeshExportResult export_scene_mesh_gpu(
@@ -5607,8 +6475,15 @@ inline MeshExportResult export_scene_mesh_gpu(
         if (includeColors) std::cout << "  Including vertex colors" << std::endl;
         if (includeUVs) std::cout << "  Including UV coordinates" << std::endl;
 
-        // Make a copy to add normals/colors/UVs if needed
+        // Make a copy (welded, simplified if requested) to add normals/colors/UVs.
+        // Preview DC/cubes meshes may come straight from a single GPU pass, unwelded.
         mc::Mesh exportMesh = e->currentMesh;
+        if (e->meshUseDualContouring) {
+            repair_mesh_seams(exportMesh);
+        }
+        if (e->meshExportDetail < 1.0f || e->meshExportMaxError > 0.0f) {
+            exportMesh = simplify_export_mesh(exportMesh);
+        }
 
         // Compute normals if not already present
         if (!exportMesh.hasNormals()) {
@@ -5632,28 +6507,20 @@ inline MeshExportResult export_scene_mesh_gpu(
             }
         }
 
+        if (e->meshOptimizeForGPU) {
+            mc::optimizeMeshForGPU(exportMesh);
+        }
+
         result.vertices = exportMesh.vertices.size();
         result.triangles = exportMesh.indices.size() / 3;
 
         // Export based on file extension
-        std::string path(filepath);
-        bool isGLB = path.size() > 4 && (path.substr(path.size() - 4) == ".glb" || path.substr(path.size() - 5) == ".gltf");
-
-        bool exportSuccess = false;
-        if (isGLB) {
-            exportSuccess = mc::exportGLB(filepath, exportMesh, includeColors);
-        } else {
-            exportSuccess = mc::exportOBJ(filepath, exportMesh, includeColors, includeUVs);
-        }
-
-        if (exportSuccess) {
+        if (write_mesh_file(filepath, exportMesh, includeColors, includeUVs, result.message)) {
             result.success = true;
             result.message = "Export successful";
             std::cout << "Exported to " << filepath << std::endl;
             std::cout << "  Vertices: " << result.vertices << std::endl;
             std::cout << "  Triangles: " << result.triangles << std::endl;
-        } else {
-            result.message = isGLB ? "Failed to write GLB file" : "Failed to write OBJ file";
         }
         return result;
     }
@@ -5663,16 +6530,136 @@ inline MeshExportResult export_scene_mesh_gpu(
                                   resolution, includeColors, includeUVs);
 }
 
+// Resolution cap for CPU DC LODs, which mesh a dense grid and its pyramid
+// (512³ floats = 512MB); MC and GPU DC levels are sparse and uncapped
+constexpr int MESH_LOD_DENSE_MAX_RES = 512;
+
+// Export a LOD chain (full, 1/2, 1/4 ... resolution) to one GLB. MC samples
+// one narrow-band brick map, widened to brickPyramidBandCells(levels), and
+// meshes it and its min-pooled brick pyramid, so no level is ever dense.
+// GPU DC meshes each level's resolution through the preview's GPU path
+// (sparse streaming above 256), sampling per level instead of min-pooling.
+// CPU (adaptive) DC needs the dense grid and is capped at
+// MESH_LOD_DENSE_MAX_RES. result.vertices / triangles are totals over all
+// levels.
+inline MeshExportResult export_scene_lods_gpu(
+    const char* filepath,
+    int resolution = 256,
+    int levels = 4,
+    bool includeColors = false
+) {
+    MeshExportResult result{false, 0, 0, ""};
+    auto* e = get_engine();
+    if (!e || !e->initialized) {
+        result.message = "Engine not initialized";
+        return result;
+    }
+
+    mc::Vec3 bounds_min{-2.0f, -2.0f, -2.0f};
+    mc::Vec3 bounds_max{2.0f, 2.0f, 2.0f};
+    std::vector<mc::Mesh> lods;
+    if (!e->meshUseDualContouring) {
+        std::cout << "Exporting " << levels << " MC LODs from one " << resolution << "³ brick map..." << std::endl;
+        mc::BrickMap map = sample_sdf_bricks(-2.0f, -2.0f, -2.0f, 2.0f, 2.0f, 2.0f, resolution,
+                                             mc::brickPyramidBandCells(levels));
+        if (!map.valid()) {
+            result.message = "Failed to sample SDF bricks";
+            return result;
+        }
+        lods = mc::generateMeshLODs(map, levels);
+    } else if (use_gpu_dc(e)) {
+        std::cout << "Exporting " << levels << " GPU DC LODs from " << resolution << "³..." << std::endl;
+        for (int l = 0, res = resolution; l < levels && res >= 4; l++, res = (res - 1) / 2 + 1) {
+            mc::Mesh mesh;
+            if (res > 256) {
+                mesh = generate_mesh_sparse_streaming(res, -2.0f, -2.0f, -2.0f, 2.0f, 2.0f, 2.0f,
+                                                      e->meshFillWithCubes, e->meshVoxelSize, 0.0f);
+            }
+            if (mesh.vertices.empty()) {
+                auto distances = sample_sdf_grid(-2.0f, -2.0f, -2.0f, 2.0f, 2.0f, 2.0f, res);
+                if (distances.empty()) {
+                    result.message = "Failed to sample SDF on GPU";
+                    return result;
+                }
+                mesh = generate_mesh_dc_gpu_chunked(distances, res, -2.0f, -2.0f, -2.0f, 2.0f, 2.0f, 2.0f,
+                                                    e->meshFillWithCubes, e->meshVoxelSize, 0.0f);
+            }
+            lods.push_back(std::move(mesh));
+        }
+    } else {
+        if (resolution > MESH_LOD_DENSE_MAX_RES) {
+            std::cout << "CPU DC LODs need a dense grid: capping " << resolution << "³ at "
+                      << MESH_LOD_DENSE_MAX_RES << "³" << std::endl;
+            resolution = MESH_LOD_DENSE_MAX_RES;
+        }
+        std::cout << "Exporting " << levels << " CPU DC LODs from one " << resolution << "³ sampling pass..." << std::endl;
+        auto distances = sample_sdf_grid(-2.0f, -2.0f, -2.0f, 2.0f, 2.0f, 2.0f, resolution);
+        if (distances.empty()) {
+            result.message = "Failed to sample SDF on GPU";
+            return result;
+        }
+        lods.push_back(mc::generateMeshDC(distances, resolution, bounds_min, bounds_max, 0.0f,
+                                          e->meshFillWithCubes, e->meshVoxelSize, e->meshDCSimplify));
+        for (const mc::GridLevel& l : mc::buildGridPyramid(distances, resolution, bounds_min, bounds_max, levels)) {
+            lods.push_back(mc::generateMeshDC(l.distances, l.res, l.boundsMin, l.boundsMax, 0.0f,
+                                              e->meshFillWithCubes, e->meshVoxelSize, e->meshDCSimplify));
+        }
+    }
+
+    if (lods.empty() || lods[0].vertices.empty()) {
+        result.message = "No surface found in bounds";
+        return result;
+    }
+
+    for (mc::Mesh& mesh : lods) {
+        if (mesh.vertices.empty()) continue;
+        if (e->meshUseDualContouring) {
+            repair_mesh_seams(mesh);
+        }
+        if (!mesh.hasNormals()) {
+            mc::computeNormals(mesh);
+        }
+        if (includeColors) {
+            auto colors = sample_vertex_colors(mesh);
+            if (!colors.empty()) {
+                mesh.colors = std::move(colors);
+            } else {
+                mc::setUniformColor(mesh, 0.8f, 0.8f, 0.8f);
+            }
+        }
+        if (e->meshOptimizeForGPU) mc::optimizeMeshForGPU(mesh);
+        result.vertices += mesh.vertices.size();
+        result.triangles += mesh.indices.size() / 3;
+    }
+
+    if (!mc::exportGLB(filepath, lods, includeColors, e->meshExportQuantized)) {
+        result.message = "Failed to write GLB file";
+        return result;
+    }
+
+    result.success = true;
+    result.message = "Export successful";
+    std::cout << "Exported " << lods.size() << " LODs to " << filepath << std::endl;
+    for (size_t i = 0; i < lods.size(); i++) {
+        std::cout << "  LOD" << i << ": " << lods[i].vertices.size() << " vertices, "
+                  << lods[i].indices.size() / 3 << " triangles" << std::endl;
+    }
+    return result;
+}
+
 // ============================================================================
 // Mesh Preview Rendering System
 // ============================================================================
 
-// Mesh vertex structure (position + normal)
-struct MeshVertex {
-    float pos[3];
-    float normal[3];
-    float color[3];
-};;
+// Mesh vertex: 16-bit position on meshQuantizer's grid, octahedral normal,
+// RGBA8 color (16 bytes instead of 36 for float attributes)
+using MeshVertex = mc::CompactVertex;
+
+// mesh.vert push constants: position = origin + unorm16 position * extent
+struct MeshPushConstants {
+    float origin[3];
+    float extent;
+};
 
 inline void cleanup_mesh_preview() {
     auto* e = get_engine();
@@ -5700,6 +6687,7 @@ inline void cleanup_mesh_preview() {
     e->meshDescriptorSet = VK_NULL_HANDLE;
     e->meshIndexCount = 0;
     e->meshVertexCount = 0;
+    e->meshClusters.clear();
     e->meshPipelineInitialized = false;
 }
 
@@ -5796,10 +6784,13 @@ inline bool init_mesh_pipeline() {
     write.pBufferInfo = &bufferInfo;
     vkUpdateDescriptorSets(e->device, 1, &write, 0, nullptr);
 
-    // Create pipeline layout
+    // Create pipeline layout (push constants dequantize positions)
+    VkPushConstantRange pushConstantRange{VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(MeshPushConstants)};
     VkPipelineLayoutCreateInfo pipelineLayoutInfo{VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO};
     pipelineLayoutInfo.setLayoutCount = 1;
     pipelineLayoutInfo.pSetLayouts = &e->meshDescriptorSetLayout;
+    pipelineLayoutInfo.pushConstantRangeCount = 1;
+    pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
 
     if (vkCreatePipelineLayout(e->device, &pipelineLayoutInfo, nullptr, &e->meshPipelineLayout) != VK_SUCCESS) {
         vkDestroyDescriptorPool(e->device, e->meshDescriptorPool, nullptr);
@@ -5820,12 +6811,12 @@ inline bool init_mesh_pipeline() {
     shaderStages[1].module = fragModule;
     shaderStages[1].pName = "main";
 
-    // Vertex input: position (vec3) + normal (vec3) + color (vec3)
+    // Vertex input: quantized position + octahedral normal + RGBA8 color
     VkVertexInputBindingDescription bindingDesc{0, sizeof(MeshVertex), VK_VERTEX_INPUT_RATE_VERTEX};
     VkVertexInputAttributeDescription attrDescs[3] = {
-        {0, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(MeshVertex, pos)},
-        {1, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(MeshVertex, normal)},
-        {2, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(MeshVertex, color)}
+        {0, 0, VK_FORMAT_R16G16B16A16_UNORM, offsetof(MeshVertex, position)},
+        {1, 0, VK_FORMAT_R16G16_SNORM, offsetof(MeshVertex, normal)},
+        {2, 0, VK_FORMAT_R8G8B8A8_UNORM, offsetof(MeshVertex, color)}
     };
 
     VkPipelineVertexInputStateCreateInfo vertexInputInfo{VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO};
@@ -5904,15 +6895,17 @@ inline bool init_mesh_pipeline() {
 }
 
 // Upload mesh data to GPU buffers
-inline bool upload_mesh_preview(const mc::Mesh& mesh, const std::vector<mc::Color3>& colors = {}) {
+// Replace the preview buffers with host-visible ones for vertexCount
+// vertices and indexCount indices and map both, so callers write the
+// interleaved vertices and indices in place (no staging copy). Vertices are
+// packed against quantizer, which must cover every position. Callers may
+// fill meshClusters for culling. Must be followed by finish_mesh_preview_upload().
+inline bool begin_mesh_preview_upload(size_t vertexCount, size_t indexCount,
+                                      const mc::PositionQuantizer& quantizer,
+                                      MeshVertex*& vertices, uint32_t*& indices) {
     auto* e = get_engine();
     if (!e || !e->initialized) return false;
 
-    if (mesh.vertices.empty() || mesh.indices.empty()) {
-        std::cerr << "Empty mesh data" << std::endl;
-        return false;
-    }
-
     // Destroy old buffers
     if (e->meshVertexBuffer) {
         vkDeviceWaitIdle(e->device);
@@ -5927,67 +6920,13 @@ inline bool upload_mesh_preview(const mc::Mesh& mesh, const std::vector<mc::Colo
         e->meshIndexBuffer = VK_NULL_HANDLE;
         e->meshIndexMemory = VK_NULL_HANDLE;
     }
+    e->meshVertexCount = 0;
+    e->meshIndexCount = 0;
+    e->meshClusters.clear();
+    e->meshQuantizer = quantizer;
 
-    // Compute normals for each vertex (average of face normals)
-    std::vector<mc::Vec3> normals(mesh.vertices.size(), {0, 0, 0});
-    for (size_t i = 0; i < mesh.indices.size(); i += 3) {
-        uint32_t i0 = mesh.indices[i];
-        uint32_t i1 = mesh.indices[i + 1];
-        uint32_t i2 = mesh.indices[i + 2];
-
-        mc::Vec3 v0 = mesh.vertices[i0];
-        mc::Vec3 v1 = mesh.vertices[i1];
-        mc::Vec3 v2 = mesh.vertices[i2];
-
-        // Edge vectors
-        mc::Vec3 e1 = {v1.x - v0.x, v1.y - v0.y, v1.z - v0.z};
-        mc::Vec3 e2 = {v2.x - v0.x, v2.y - v0.y, v2.z - v0.z};
-
-        // Cross product for face normal
-        mc::Vec3 n = {
-            e1.y * e2.z - e1.z * e2.y,
-            e1.z * e2.x - e1.x * e2.z,
-            e1.x * e2.y - e1.y * e2.x
-        };
-
-        normals[i0].x += n.x; normals[i0].y += n.y; normals[i0].z += n.z;
-        normals[i1].x += n.x; normals[i1].y += n.y; normals[i1].z += n.z;
-        normals[i2].x += n.x; normals[i2].y += n.y; normals[i2].z += n.z;
-    }
-
-    // Normalize
-    for (auto& n : normals) {
-        float len = sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
-        if (len > 0.0001f) {
-            n.x /= len; n.y /= len; n.z /= len;
-        }
-    }
-
-    // Check if we have valid colors
-    bool hasColors = !colors.empty() && colors.size() == mesh.vertices.size();
-
-    // Create interleaved vertex data
-    std::vector<MeshVertex> vertices(mesh.vertices.size());
-    for (size_t i = 0; i < mesh.vertices.size(); i++) {
-        vertices[i].pos[0] = mesh.vertices[i].x;
-        vertices[i].pos[1] = mesh.vertices[i].y;
-        vertices[i].pos[2] = mesh.vertices[i].z;
-        vertices[i].normal[0] = normals[i].x;
-        vertices[i].normal[1] = normals[i].y;
-        vertices[i].normal[2] = normals[i].z;
-        if (hasColors) {
-            vertices[i].color[0] = colors[i].r;
-            vertices[i].color[1] = colors[i].g;
-            vertices[i].color[2] = colors[i].b;
-        } else {
-            vertices[i].color[0] = 0.0f;
-            vertices[i].color[1] = 0.0f;
-            vertices[i].color[2] = 0.0f;
-        }
-    }
-
-    VkDeviceSize vertexBufferSize = sizeof(MeshVertex) * vertices.size();
-    VkDeviceSize indexBufferSize = sizeof(uint32_t) * mesh.indices.size();
+    VkDeviceSize vertexBufferSize = sizeof(MeshVertex) * vertexCount;
+    VkDeviceSize indexBufferSize = sizeof(uint32_t) * indexCount;
 
     // Create vertex buffer
     VkBufferCreateInfo bufferInfo{VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
@@ -5997,6 +6936,7 @@ inline bool upload_mesh_preview(const mc::Mesh& mesh, const std::vector<mc::Colo
 
     if (vkCreateBuffer(e->device, &bufferInfo, nullptr, &e->meshVertexBuffer) != VK_SUCCESS) {
         std::cerr << "Failed to create vertex buffer" << std::endl;
+        e->meshVertexBuffer = VK_NULL_HANDLE;
         return false;
     }
 
@@ -6010,23 +6950,26 @@ inline bool upload_mesh_preview(const mc::Mesh& mesh, const std::vector<mc::Colo
 
     if (vkAllocateMemory(e->device, &allocInfo, nullptr, &e->meshVertexMemory) != VK_SUCCESS) {
         vkDestroyBuffer(e->device, e->meshVertexBuffer, nullptr);
+        e->meshVertexBuffer = VK_NULL_HANDLE;
+        e->meshVertexMemory = VK_NULL_HANDLE;
         return false;
     }
     vkBindBufferMemory(e->device, e->meshVertexBuffer, e->meshVertexMemory, 0);
 
-    // Upload vertex data
-    void* data;
-    vkMapMemory(e->device, e->meshVertexMemory, 0, vertexBufferSize, 0, &data);
-    memcpy(data, vertices.data(), vertexBufferSize);
-    vkUnmapMemory(e->device, e->meshVertexMemory);
-
     // Create index buffer
     bufferInfo.size = indexBufferSize;
     bufferInfo.usage = VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
 
-    if (vkCreateBuffer(e->device, &bufferInfo, nullptr, &e->meshIndexBuffer) != VK_SUCCESS) {
+    auto destroyVertexBuffer = [e]() {
         vkDestroyBuffer(e->device, e->meshVertexBuffer, nullptr);
         vkFreeMemory(e->device, e->meshVertexMemory, nullptr);
+        e->meshVertexBuffer = VK_NULL_HANDLE;
+        e->meshVertexMemory = VK_NULL_HANDLE;
+    };
+
+    if (vkCreateBuffer(e->device, &bufferInfo, nullptr, &e->meshIndexBuffer) != VK_SUCCESS) {
+        destroyVertexBuffer();
+        e->meshIndexBuffer = VK_NULL_HANDLE;
         return false;
     }
 
@@ -6036,23 +6979,73 @@ inline bool upload_mesh_preview(const mc::Mesh& mesh, const std::vector<mc::Colo
         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
 
     if (vkAllocateMemory(e->device, &allocInfo, nullptr, &e->meshIndexMemory) != VK_SUCCESS) {
-        vkDestroyBuffer(e->device, e->meshVertexBuffer, nullptr);
-        vkFreeMemory(e->device, e->meshVertexMemory, nullptr);
+        destroyVertexBuffer();
         vkDestroyBuffer(e->device, e->meshIndexBuffer, nullptr);
+        e->meshIndexBuffer = VK_NULL_HANDLE;
+        e->meshIndexMemory = VK_NULL_HANDLE;
         return false;
     }
     vkBindBufferMemory(e->device, e->meshIndexBuffer, e->meshIndexMemory, 0);
 
-    // Upload index data
+    void* data;
+    vkMapMemory(e->device, e->meshVertexMemory, 0, vertexBufferSize, 0, &data);
+    vertices = static_cast<MeshVertex*>(data);
     vkMapMemory(e->device, e->meshIndexMemory, 0, indexBufferSize, 0, &data);
-    memcpy(data, mesh.indices.data(), indexBufferSize);
+    indices = static_cast<uint32_t*>(data);
+    return true;
+}
+
+// Unmap the buffers filled after begin_mesh_preview_upload() and draw them
+inline void finish_mesh_preview_upload(size_t vertexCount, size_t indexCount) {
+    auto* e = get_engine();
+    vkUnmapMemory(e->device, e->meshVertexMemory);
     vkUnmapMemory(e->device, e->meshIndexMemory);
 
-    e->meshVertexCount = static_cast<uint32_t>(vertices.size());
-    e->meshIndexCount = static_cast<uint32_t>(mesh.indices.size());
+    e->meshVertexCount = static_cast<uint32_t>(vertexCount);
+    e->meshIndexCount = static_cast<uint32_t>(indexCount);
 
     std::cout << "Mesh preview uploaded: " << e->meshVertexCount << " vertices, "
               << (e->meshIndexCount / 3) << " triangles" << std::endl;
+}
+
+inline bool upload_mesh_preview(const mc::Mesh& mesh, const std::vector<mc::Color3>& colors = {}) {
+    auto* e = get_engine();
+    if (!e || !e->initialized) return false;
+
+    if (mesh.vertices.empty() || mesh.indices.empty()) {
+        std::cerr << "Empty mesh data" << std::endl;
+        return false;
+    }
+
+    // Use the mesh's own normals (e.g. MC gradient normals) when present,
+    // otherwise average face normals per vertex (outward, as mc::computeNormals)
+    std::vector<mc::Vec3> faceNormals;
+    if (!mesh.hasNormals()) mc::computeNormals(mesh.vertices, mesh.indices, faceNormals);
+    const std::vector<mc::Vec3>& normals = mesh.hasNormals() ? mesh.normals : faceNormals;
+
+    // Check if we have valid colors
+    bool hasColors = !colors.empty() && colors.size() == mesh.vertices.size();
+
+    // Pack quantized vertices straight into the mapped buffer
+    mc::PositionQuantizer quantizer = mc::PositionQuantizer::fit(mesh.vertices, mesh.vertices.size());
+    MeshVertex* vertices;
+    uint32_t* indices;
+    if (!begin_mesh_preview_upload(mesh.vertices.size(), mesh.indices.size(), quantizer, vertices, indices)) {
+        return false;
+    }
+    for (size_t i = 0; i < mesh.vertices.size(); i++) {
+        vertices[i] = mc::packVertex(quantizer, mesh.vertices[i], normals[i], hasColors ? &colors[i] : nullptr);
+    }
+    if (mesh.indices.size() / 3 >= mc::MESH_CLUSTER_MIN_TRIANGLES) {
+        e->meshClusters = mc::buildMeshClusters(mesh.vertices, mesh.indices.data(), mesh.indices.size(), indices,
+                                                0, e->meshOptimizeForGPU);
+    } else if (e->meshOptimizeForGPU) {
+        mc::optimizeVertexCache(mesh.indices.data(), mesh.indices.size(), mesh.vertices.size(), indices);
+    } else {
+        memcpy(indices, mesh.indices.data(), sizeof(uint32_t) * mesh.indices.size());
+    }
+
+    finish_mesh_preview_upload(mesh.vertices.size(), mesh.indices.size());
     return true;
 }
 
@@ -6079,17 +7072,28 @@ inline bool load_glb_and_display(const char* filepath) {
         std::cout << "[load_glb_and_display] Resolved relative path to: " << resolvedPath << std::endl;
     }
 
-    mc::Mesh loadedMesh;
-    std::cout << "[load_glb_and_display] Calling mc::loadGLB with: " << resolvedPath << std::endl;
-    if (!mc::loadGLB(resolvedPath, loadedMesh)) {
-        std::cerr << "[load_glb_and_display] Failed to load GLB: " << resolvedPath << std::endl;
+    // Map the file and stream its mesh instances (all scenes, world space)
+    // into the preview buffers in one pass; the loaded mesh lives only on
+    // the GPU
+    auto start = std::chrono::high_resolution_clock::now();
+    mc::GLBFile file;
+    std::vector<mc::GLBPrimitive> prims;
+    if (!file.open(resolvedPath) || !file.primitives(prims) || prims.empty()) {
+        std::cerr << "[load_glb_and_display] Failed to load GLB: " << resolvedPath
+                  << (file.error.empty() ? "" : " (" + file.error + ")") << std::endl;
         return false;
     }
-    std::cout << "[load_glb_and_display] GLB loaded: " << loadedMesh.vertices.size() << " verts, "
-              << loadedMesh.indices.size() << " indices" << std::endl;
 
-    // Store the loaded mesh as current mesh
-    e->currentMesh = loadedMesh;
+    size_t vertexCount = 0, indexCount = 0;
+    bool withNormals = true;
+    for (const auto& p : prims) {
+        vertexCount += p.positions.size();
+        indexCount += p.indexCount();
+        withNormals = withNormals && !p.normals.empty();
+    }
+
+    e->meshArena.recycle(std::move(e->currentMesh));
+    e->currentMesh = mc::Mesh();
     e->currentMeshResolution = 0;  // Unknown resolution for loaded mesh
 
     // Initialize mesh pipeline if needed (required for rendering)
@@ -6100,13 +7104,59 @@ inline bool load_glb_and_display(const char* filepath) {
         }
     }
 
-    // Upload to GPU for display
-    bool success = upload_mesh_preview(loadedMesh, loadedMesh.colors);
+    bool success;
+    if (!withNormals) {
+        // Face normals need the whole mesh first, copied from the mapping
+        mc::Mesh loadedMesh;
+        mc::meshFromPrimitives(prims, loadedMesh);
+        success = upload_mesh_preview(loadedMesh, loadedMesh.colors);
+    } else {
+        mc::Vec3 lo(FLT_MAX, FLT_MAX, FLT_MAX), hi(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        for (const auto& p : prims) {
+            for (size_t i = 0; i < p.positions.size(); i++) {
+                const mc::Vec3& v = p.positions[i];
+                lo = {std::min(lo.x, v.x), std::min(lo.y, v.y), std::min(lo.z, v.z)};
+                hi = {std::max(hi.x, v.x), std::max(hi.y, v.y), std::max(hi.z, v.z)};
+            }
+        }
+        mc::PositionQuantizer quantizer(lo, hi);
+        MeshVertex* vertices;
+        uint32_t* indices;
+        success = begin_mesh_preview_upload(vertexCount, indexCount, quantizer, vertices, indices);
+        if (success) {
+            const uint32_t* indexStart = indices;
+            size_t baseVertex = 0;
+            for (const auto& p : prims) {
+                for (size_t i = 0; i < p.positions.size(); i++) {
+                    *vertices++ = mc::packVertex(quantizer, p.positions[i], p.normals[i],
+                                                 p.colors.empty() ? nullptr : &p.colors[i]);
+                }
+                size_t count = p.indexCount();
+                if (indexCount / 3 >= mc::MESH_CLUSTER_MIN_TRIANGLES) {
+                    std::vector<uint32_t> local(count);
+                    for (size_t i = 0; i < count; i++) local[i] = p.index(i);
+                    uint32_t firstIndex = (uint32_t)(indices - indexStart);
+                    for (mc::MeshCluster c : mc::buildMeshClusters(p.positions, local.data(), count, indices,
+                                                                   (uint32_t)baseVertex, e->meshOptimizeForGPU)) {
+                        c.firstIndex += firstIndex;
+                        e->meshClusters.push_back(c);
+                    }
+                    indices += count;
+                } else {
+                    for (size_t i = 0; i < count; i++) *indices++ = (uint32_t)(baseVertex + p.index(i));
+                }
+                baseVertex += p.positions.size();
+            }
+            finish_mesh_preview_upload(vertexCount, indexCount);
+        }
+    }
 
     if (success) {
         e->meshPreviewVisible = true;
         e->dirty = true;
-        std::cout << "GLB loaded and displayed: " << filepath << std::endl;
+        auto end = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+        std::cout << "GLB loaded and displayed: " << filepath << " in " << duration.count() << " ms" << std::endl;
     }
 
     return success;
@@ -6115,6 +7165,43 @@ inline bool load_glb_and_display(const char* filepath) {
 // Get path of last exported GLB (for reload button)
 inline std::string g_lastExportedGlbPath;
 
+// Everything besides the objects that the next samples depend on
+inline MeshSourceState mesh_source_state(Engine* e) {
+    auto* s = get_sampler();
+    MeshSourceState state;
+    if (use_cpu_sampler()) {
+        state.cpuSceneVersion = s->cpuSceneVersion;
+        state.animated = sdfcpu::usesTime(*s->cpuScene);
+        if (state.animated) state.time = sampler_time();
+        return state;
+    }
+    state.shaderName = e->currentShaderName;
+    struct stat st;
+    std::string shaderPath = e->shaderDir + "/" + e->currentShaderName + ".comp";
+    if (stat(shaderPath.c_str(), &st) == 0) state.shaderModTime = st.st_mtime;
+    state.animated = s->sceneAnimated;
+    if (state.animated) state.time = e->time;
+    return state;
+}
+
+// Fill the preview's block cache (MC) from full Z slabs: taken from dense
+// when the grid is already sampled, otherwise sampled one block layer at a
+// time, so host memory stays O(res²) like generate_mesh_streaming
+inline bool rebuild_mesh_chunks(Engine* e, int resolution, const std::vector<float>* dense = nullptr) {
+    mc::MeshChunkCache& chunks = e->meshChunks;
+    chunks.reset(resolution, {-2.0f, -2.0f, -2.0f}, {2.0f, 2.0f, 2.0f});
+    size_t slice = (size_t)resolution * resolution;
+    bool ok = chunks.rebuild([&](int zStart, int zCount, float* dst) {
+        if (dense) {
+            memcpy(dst, dense->data() + zStart * slice, zCount * slice * sizeof(float));
+            return true;
+        }
+        return sample_sdf_slices(dst, -2.0f, -2.0f, -2.0f, 2.0f, 2.0f, 2.0f, resolution, zStart, zCount);
+    });
+    if (!ok) chunks.clear();
+    return ok;
+}
+
 // Generate mesh from current scene and upload to GPU
 inline bool generate_mesh_preview(int resolution = -1) {
     auto* e = get_engine();
@@ -6129,8 +7216,13 @@ inline bool generate_mesh_preview(int resolution = -1) {
     mc::Vec3 bounds_min{-2.0f, -2.0f, -2.0f};
     mc::Vec3 bounds_max{2.0f, 2.0f, 2.0f};
 
+    // The previous mesh's storage backs the new one; this also makes sure the
+    // paths below always regenerate instead of keeping a stale mesh
+    e->meshArena.recycle(std::move(e->currentMesh));
+    e->currentMesh = mc::Mesh();
+
     // For GPU DC at high resolution, use sparse streaming to avoid 4GB allocation
-    if (e->meshUseDualContouring && e->meshUseGpuDC && resolution > 256) {
+    if (e->meshUseDualContouring && use_gpu_dc(e) && resolution > 256) {
         e->currentMesh = generate_mesh_sparse_streaming(resolution,
             -2.0f, -2.0f, -2.0f, 2.0f, 2.0f, 2.0f,
             e->meshFillWithCubes, e->meshVoxelSize, 0.0f);
@@ -6138,6 +7230,12 @@ inline bool generate_mesh_preview(int resolution = -1) {
         if (e->currentMesh.vertices.empty()) {
             std::cout << "Sparse streaming failed, falling back to standard approach..." << std::endl;
         }
+    } else if (!e->meshUseDualContouring && resolution > 256) {
+        // Slab-streamed through the block cache, which keeps only one layer of
+        // samples on the host and lets the next edit re-mesh just its blocks
+        if (rebuild_mesh_chunks(e, resolution)) {
+            e->currentMesh = e->meshChunks.assemble();
+        }
     }
 
     // Standard approach for small resolutions or fallback
@@ -6151,7 +7249,7 @@ inline bool generate_mesh_preview(int resolution = -1) {
 
         // Generate mesh using CPU marching cubes or dual contouring
         if (e->meshUseDualContouring) {
-            if (e->meshUseGpuDC) {
+            if (use_gpu_dc(e)) {
                 // Use chunked GPU processing - handles any resolution
                 e->currentMesh = generate_mesh_dc_gpu_chunked(distances, resolution,
                     -2.0f, -2.0f, -2.0f, 2.0f, 2.0f, 2.0f,
@@ -6159,19 +7257,24 @@ inline bool generate_mesh_preview(int resolution = -1) {
                 // Fall back to CPU if GPU fails
                 if (e->currentMesh.vertices.empty()) {
                     std::cout << "GPU DC failed, falling back to CPU..." << std::endl;
-                    e->currentMesh = mc::generateMeshDC(distances, resolution, bounds_min, bounds_max, 0.0f, e->meshFillWithCubes, e->meshVoxelSize);
+                    e->currentMesh = mc::generateMeshDC(distances, resolution, bounds_min, bounds_max, 0.0f, e->meshFillWithCubes, e->meshVoxelSize, 0.0f, &e->meshArena);
                 }
             } else {
                 // CPU DC
-                e->currentMesh = mc::generateMeshDC(distances, resolution, bounds_min, bounds_max, 0.0f, e->meshFillWithCubes, e->meshVoxelSize);
+                e->currentMesh = mc::generateMeshDC(distances, resolution, bounds_min, bounds_max, 0.0f, e->meshFillWithCubes, e->meshVoxelSize, e->meshDCSimplify, &e->meshArena);
             }
         } else {
-            e->currentMesh = mc::generateMesh(distances, resolution, bounds_min, bounds_max);
+            e->currentMesh = mc::generateMesh(distances, resolution, bounds_min, bounds_max, 0.0f, true, &e->meshArena, true);
             std::cout << "MC mesh: " << e->currentMesh.vertices.size() << " vertices, "
                       << (e->currentMesh.indices.size() / 3) << " triangles" << std::endl;
+            // Seed the block cache from the same grid for incremental edits
+            rebuild_mesh_chunks(e, resolution, &distances);
         }
     }
+    if (e->meshUseDualContouring) e->meshChunks.clear();
     e->currentMeshResolution = resolution;
+    e->meshObjectSnapshot = e->objects;
+    e->meshSourceSnapshot = mesh_source_state(e);
 
     if (e->currentMesh.vertices.empty()) {
         std::cerr << "No surface found" << std::endl;
@@ -6190,7 +7293,9 @@ inline bool generate_mesh_preview(int resolution = -1) {
     if (e->meshUseVertexColors) {
         std::cout << "Sampling vertex colors..." << std::endl;
         // Compute normals (required for color sampling)
-        mc::computeNormals(e->currentMesh);
+        if (!e->currentMesh.hasNormals()) {
+            mc::computeNormals(e->currentMesh);
+        }
         colors = sample_vertex_colors(e->currentMesh);
         if (colors.empty()) {
             std::cerr << "Warning: Failed to sample colors, using default" << std::endl;
@@ -6203,6 +7308,107 @@ inline bool generate_mesh_preview(int resolution = -1) {
     return upload_mesh_preview(e->currentMesh, colors);
 }
 
+// Whether two object states sample the same SDF (selectable is UI only)
+inline bool same_object_sdf(const SceneObject& a, const SceneObject& b) {
+    return memcmp(a.position, b.position, sizeof(a.position)) == 0 &&
+           memcmp(a.rotation, b.rotation, sizeof(a.rotation)) == 0 &&
+           a.type == b.type && a.boundRadius == b.boundRadius;
+}
+
+// Re-mesh only the blocks touched by objects that changed since the last
+// mesh update. The dirty box spans each changed object's old and new bounds
+// (boundRadius around its position, meshEditRadius when unset); untouched
+// blocks keep their cached triangles and are stitched with the re-meshed
+// ones, which are sampled a group of blocks per dispatch. A different
+// shader, CPU scene or object count rebuilds every block. An animated scene
+// has a new time every frame, so no block stays valid: the time alone does
+// not re-mesh it, and an edit re-meshes it in full. MC only - DC falls back
+// to a full generate_mesh_preview.
+inline bool update_mesh_preview_incremental() {
+    auto* e = get_engine();
+    if (!e || !e->initialized) return false;
+
+    if (e->meshUseDualContouring) {
+        return generate_mesh_preview();
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    int resolution = e->meshPreviewResolution;
+    mc::Vec3 bounds_min{-2.0f, -2.0f, -2.0f};
+    mc::Vec3 bounds_max{2.0f, 2.0f, 2.0f};
+    mc::MeshChunkCache& chunks = e->meshChunks;
+    MeshSourceState source = mesh_source_state(e);
+
+    if (source.animated) {
+        MeshSourceState was = e->meshSourceSnapshot;
+        was.time = source.time;
+        bool same = was == source && e->meshObjectSnapshot.size() == e->objects.size();
+        for (size_t i = 0; same && i < e->objects.size(); i++) {
+            same = same_object_sdf(e->objects[i], e->meshObjectSnapshot[i]);
+        }
+        return same || generate_mesh_preview();
+    }
+
+    if (!chunks.matches(resolution, bounds_min, bounds_max) ||
+        e->meshObjectSnapshot.size() != e->objects.size() ||
+        e->meshSourceSnapshot != source) {
+        if (!rebuild_mesh_chunks(e, resolution)) return false;
+        std::cout << "Incremental mesh: scene changed, rebuilt all " << chunks.blocks.size() << " blocks" << std::endl;
+    } else {
+        bool changed = false;
+        mc::Vec3 lo(FLT_MAX, FLT_MAX, FLT_MAX), hi(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        for (size_t i = 0; i < e->objects.size(); i++) {
+            const SceneObject& now = e->objects[i];
+            const SceneObject& was = e->meshObjectSnapshot[i];
+            if (same_object_sdf(now, was)) continue;
+            changed = true;
+            for (const SceneObject* o : {&now, &was}) {
+                float r = o->boundRadius > 0.0f ? o->boundRadius : e->meshEditRadius;
+                const float* p = o->position;
+                lo = mc::Vec3(std::min(lo.x, p[0] - r), std::min(lo.y, p[1] - r), std::min(lo.z, p[2] - r));
+                hi = mc::Vec3(std::max(hi.x, p[0] + r), std::max(hi.y, p[1] + r), std::max(hi.z, p[2] + r));
+            }
+        }
+        if (!changed) return true;
+
+        chunks.invalidate(lo, hi);
+        size_t dirty = chunks.dirtyCount();
+        size_t fetches = 0;
+        bool ok = chunks.update([&](const int blo[3], const int dims[3], float* dst) {
+            return sample_sdf_box(dst, bounds_min.x, bounds_min.y, bounds_min.z,
+                                  bounds_max.x, bounds_max.y, bounds_max.z, resolution, blo, dims);
+        }, &fetches);
+        if (!ok) {
+            chunks.clear();
+            return false;
+        }
+        std::cout << "Incremental mesh: re-meshed " << dirty << "/" << chunks.blocks.size() << " blocks in "
+                  << fetches << " fetches" << std::endl;
+    }
+
+    e->meshArena.recycle(std::move(e->currentMesh));
+    e->currentMesh = chunks.assemble();
+    e->currentMeshResolution = resolution;
+    e->meshObjectSnapshot = e->objects;
+    e->meshSourceSnapshot = source;
+
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "Incremental mesh: " << e->currentMesh.vertices.size() << " vertices, "
+              << (e->currentMesh.indices.size() / 3) << " triangles in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+
+    if (!e->meshPipelineInitialized && !init_mesh_pipeline()) {
+        return false;
+    }
+
+    std::vector<mc::Color3> colors;
+    if (e->meshUseVertexColors && !e->currentMesh.vertices.empty()) {
+        mc::computeNormals(e->currentMesh);
+        colors = sample_vertex_colors(e->currentMesh);
+    }
+    return upload_mesh_preview(e->currentMesh, colors);
+}
+
 // Render mesh preview (called from draw_frame)
 inline void render_mesh_preview(VkCommandBuffer cmd) {
     auto* e = get_engine();
@@ -6214,11 +7420,60 @@ inline void render_mesh_preview(VkCommandBuffer cmd) {
     vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, e->meshPipeline);
     vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, e->meshPipelineLayout,
                            0, 1, &e->meshDescriptorSet, 0, nullptr);
+    const mc::PositionQuantizer& q = e->meshQuantizer;
+    MeshPushConstants push{{q.origin.x, q.origin.y, q.origin.z}, q.step * mc::QUANTIZE_POSITION_MAX};
+    vkCmdPushConstants(cmd, e->meshPipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(push), &push);
 
     VkDeviceSize offsets[] = {0};
     vkCmdBindVertexBuffers(cmd, 0, 1, &e->meshVertexBuffer, offsets);
     vkCmdBindIndexBuffer(cmd, e->meshIndexBuffer, 0, VK_INDEX_TYPE_UINT32);
-    vkCmdDrawIndexed(cmd, e->meshIndexCount, 1, 0, 0, 0);
+
+    if (!e->meshClusterCulling || e->meshClusters.empty()) {
+        vkCmdDrawIndexed(cmd, e->meshIndexCount, 1, 0, 0, 0);
+        e->meshVisibleTriangles = e->meshIndexCount / 3;
+        return;
+    }
+
+    // Cull clusters in mesh space against the camera of mesh.vert (fov as
+    // focal length, near 0.01, far 100, up -Y, positions scaled by meshScale)
+    float eyeW[3], targetW[3];
+    e->camera.getPosition(eyeW);
+    e->camera.getTarget(targetW);
+    float scale = e->meshScale > 0.0f ? e->meshScale : 1.0f;
+    const float focal = 1.5f;  // ubo.cameraPos[3]
+    float aspect = (float)g_framebufferWidth / (float)std::max(1u, g_framebufferHeight);
+
+    mc::Vec3 eye(eyeW[0] / scale, eyeW[1] / scale, eyeW[2] / scale);
+    mc::Vec3 f = mc::Vec3(targetW[0] - eyeW[0], targetW[1] - eyeW[1], targetW[2] - eyeW[2]).normalized();
+    mc::Vec3 r = f.cross(mc::Vec3(0.0f, -1.0f, 0.0f)).normalized();
+    mc::Vec3 u = r.cross(f);
+    // Side planes through the eye, normals pointing out of the frustum
+    mc::Vec3 planes[4] = {
+        (r - f * (aspect / focal)).normalized(), (r * -1.0f - f * (aspect / focal)).normalized(),
+        (u - f * (1.0f / focal)).normalized(), (u * -1.0f - f * (1.0f / focal)).normalized(),
+    };
+    float nearDist = 0.01f / scale, farDist = 100.0f / scale;
+
+    // Clusters are stored in index order, so adjacent visible ones merge into one draw
+    uint32_t runFirst = 0, runCount = 0, visible = 0;
+    for (const mc::MeshCluster& c : e->meshClusters) {
+        mc::Vec3 d = c.center - eye;
+        float depth = d.dot(f);
+        bool inside = depth + c.radius >= nearDist && depth - c.radius <= farDist;
+        for (int i = 0; i < 4 && inside; i++) inside = d.dot(planes[i]) <= c.radius;
+        if (!inside || mc::clusterBackfacing(c, eye)) continue;
+
+        visible += c.indexCount;
+        if (runCount && runFirst + runCount == c.firstIndex) {
+            runCount += c.indexCount;
+            continue;
+        }
+        if (runCount) vkCmdDrawIndexed(cmd, runCount, 1, runFirst, 0, 0);
+        runFirst = c.firstIndex;
+        runCount = c.indexCount;
+    }
+    if (runCount) vkCmdDrawIndexed(cmd, runCount, 1, runFirst, 0, 0);
+    e->meshVisibleTriangles = visible / 3;
 }
 
 // API functions for jank
@@ -6337,6 +7592,73 @@ inline void set_mesh_voxel_size(float size) {
     }
 }
 
+inline float get_mesh_dc_simplify() {
+    auto* e = get_engine();
+    return e ? e->meshDCSimplify : 0.0f;
+}
+
+inline void set_mesh_dc_simplify(float tolerance) {
+    auto* e = get_engine();
+    if (!e) return;
+    tolerance = std::max(0.0f, std::min(1.0f, tolerance));  // Clamp to [0, 1] cells
+    if (e->meshDCSimplify != tolerance) {
+        e->meshDCSimplify = tolerance;
+        if (e->meshUseDualContouring && !e->meshFillWithCubes) {
+            e->meshNeedsRegenerate = true;
+            e->dirty = true;
+        }
+    }
+}
+
+inline float get_mesh_sdf_lipschitz() {
+    auto* e = get_engine();
+    return e ? e->meshSdfLipschitz : 1.0f;
+}
+
+inline void set_mesh_sdf_lipschitz(float bound) {
+    auto* e = get_engine();
+    if (!e) return;
+    bound = std::max(1.0f, std::min(16.0f, bound));
+    if (e->meshSdfLipschitz != bound) {
+        e->meshSdfLipschitz = bound;
+        e->meshNeedsRegenerate = true;
+        e->dirty = true;
+    }
+}
+
+inline float get_mesh_edit_radius() {
+    auto* e = get_engine();
+    return e ? e->meshEditRadius : 1.0f;
+}
+
+inline void set_mesh_edit_radius(float radius) {
+    auto* e = get_engine();
+    if (!e) return;
+    e->meshEditRadius = std::max(0.0f, radius);
+}
+
+inline float get_mesh_export_detail() {
+    auto* e = get_engine();
+    return e ? e->meshExportDetail : 1.0f;
+}
+
+inline void set_mesh_export_detail(float detail) {
+    auto* e = get_engine();
+    if (!e) return;
+    e->meshExportDetail = std::max(0.001f, std::min(1.0f, detail));
+}
+
+inline float get_mesh_export_max_error() {
+    auto* e = get_engine();
+    return e ? e->meshExportMaxError : 0.0f;
+}
+
+inline void set_mesh_export_max_error(float maxError) {
+    auto* e = get_engine();
+    if (!e) return;
+    e->meshExportMaxError = std::max(0.0f, maxError);
+}
+
 inline bool get_mesh_use_gpu_dc() {
     auto* e = get_engine();
     return e ? e->meshUseGpuDC : false;
@@ -6374,6 +7696,63 @@ inline uint32_t get_mesh_preview_triangle_count() {
     return e ? (e->meshIndexCount / 3) : 0;
 }
 
+inline uint32_t get_mesh_visible_triangle_count() {
+    auto* e = get_engine();
+    return e ? e->meshVisibleTriangles : 0;
+}
+
+inline bool get_mesh_optimize_for_gpu() {
+    auto* e = get_engine();
+    return e ? e->meshOptimizeForGPU : true;
+}
+
+inline void set_mesh_optimize_for_gpu(bool enabled) {
+    auto* e = get_engine();
+    if (e) e->meshOptimizeForGPU = enabled;
+}
+
+inline bool get_mesh_export_quantized() {
+    auto* e = get_engine();
+    return e ? e->meshExportQuantized : false;
+}
+
+inline void set_mesh_export_quantized(bool enabled) {
+    auto* e = get_engine();
+    if (e) e->meshExportQuantized = enabled;
+}
+
+inline bool get_mesh_repair_seams() {
+    auto* e = get_engine();
+    return e ? e->meshRepairSeams : true;
+}
+
+inline void set_mesh_repair_seams(bool enabled) {
+    auto* e = get_engine();
+    if (e) e->meshRepairSeams = enabled;
+}
+
+// Boundary (open) edges found by the last repair
+inline uint64_t get_mesh_open_edge_count() {
+    auto* e = get_engine();
+    return e ? e->meshManifold.boundaryEdges : 0;
+}
+
+// Edges shared by three or more triangles in the last repair
+inline uint64_t get_mesh_nonmanifold_edge_count() {
+    auto* e = get_engine();
+    return e ? e->meshManifold.nonManifoldEdges : 0;
+}
+
+inline bool get_mesh_cluster_culling() {
+    auto* e = get_engine();
+    return e ? e->meshClusterCulling : true;
+}
+
+inline void set_mesh_cluster_culling(bool enabled) {
+    auto* e = get_engine();
+    if (e) e->meshClusterCulling = enabled;
+}
+
 inline bool mesh_preview_needs_regenerate() {
     auto* e = get_engine();
     return e ? e->meshNeedsRegenerate : false;
@@ -1,7 +1,8 @@
-// tinygltf implementation compilation unit for standalone builds
-// This file compiles the tinygltf implementation that's defined in marching_cubes.hpp
-// so it can be linked into the standalone executable.
+// Former tinygltf implementation unit for standalone builds.
+// marching_cubes.hpp now reads and writes GLB itself (see GLBFile/writeGLB),
+// so this only compiles the header; it stays so existing AOT link lines
+// (Makefile, bin/run_sdf.sh) keep working.
 
-// Define SDF_ENGINE_IMPLEMENTATION to enable TINYGLTF_IMPLEMENTATION
+// Define SDF_ENGINE_IMPLEMENTATION to match the other implementation units
 #define SDF_ENGINE_IMPLEMENTATION
 #include "marching_cubes.hpp"
@@ -1,9 +1,9 @@
 #version 450
 
-// Vertex input
-layout(location = 0) in vec3 inPosition;
-layout(location = 1) in vec3 inNormal;
-layout(location = 2) in vec3 inColor;
+// Vertex input (quantized, see mc::CompactVertex)
+layout(location = 0) in vec4 inPosition;  // RGBA16 UNORM over the mesh bounds
+layout(location = 1) in vec2 inNormal;    // Octahedral RG16 SNORM
+layout(location = 2) in vec4 inColor;     // RGBA8 UNORM
 
 // Output to fragment shader
 layout(location = 0) out vec3 fragNormal;
@@ -19,6 +19,19 @@ layout(binding = 0) uniform MeshUBO {
     vec4 options;        // x = useVertexColors (0 or 1)
 } ubo;
 
+// Dequantization: position = origin + inPosition.xyz * extent
+layout(push_constant) uniform MeshPush {
+    vec4 quantization;   // xyz = origin, w = extent
+} push;
+
+vec3 decodeOctahedral(vec2 e) {
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    if (n.z < 0.0) {
+        n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+    }
+    return normalize(n);
+}
+
 // Simple view-projection calculation
 mat4 lookAt(vec3 eye, vec3 target, vec3 up) {
     vec3 f = normalize(target - eye);
@@ -57,11 +70,12 @@ void main() {
     mat4 view = lookAt(eye, target, vec3(0.0, -1.0, 0.0));
     mat4 proj = perspective(fov, aspect, 0.01, 100.0);
 
-    vec3 scaledPos = inPosition * scale;
+    vec3 position = push.quantization.xyz + inPosition.xyz * push.quantization.w;
+    vec3 scaledPos = position * scale;
     vec4 worldPos = vec4(scaledPos, 1.0);
     gl_Position = proj * view * worldPos;
 
-    fragNormal = inNormal;
+    fragNormal = decodeOctahedral(inNormal);
     fragWorldPos = scaledPos;
-    fragColor = inColor;
+    fragColor = inColor.rgb;
 }